@@ -0,0 +1,153 @@
+// AreaMomentAccumulator.h: Exact monomial area moments up to a fixed order
+//////////////////////////////////////////////////////////////////////
+
+#ifndef AREA_MOMENT_ACCUMULATOR_H
+#define AREA_MOMENT_ACCUMULATOR_H
+
+#include <vector>
+
+// Position of M_pq in graded order: M00, M10, M01, M20, M11, M02, M30, ...
+constexpr int AreaMomentIndex(int p, int q) { return (p + q) * (p + q + 1) / 2 + q; }
+
+// Number of moments with p + q <= order
+constexpr int AreaMomentCount(int order) { return (order + 1) * (order + 2) / 2; }
+
+// p! q! / (p + q + 2)!, the weight of the triangle integral below
+inline double AreaMomentWeight(int p, int q)
+{
+    double weight = 1.0;
+    for (int i = 2; i <= p; i++)
+        weight *= i;
+    for (int i = 2; i <= q; i++)
+        weight *= i;
+    for (int i = 2; i <= p + q + 2; i++)
+        weight /= i;
+    return weight;
+}
+
+namespace AreaMomentDetail
+{
+    // One vertex's step of the triangle polynomial, for every (p, q) with
+    // 1 <= p + q <= N in graded order, expanded at compile time:
+    //   F(p,q) += x F(p-1,q) + y F(p,q-1)
+    // Each step is a plain loop over W lanes (triangles), which vectorizes.
+    template <int N, int W, int D, int P, bool NextDegree = (P > D), bool Done = (D > N)>
+    struct Sweep
+    {
+        static void Apply(double (*F)[W], const double* x, const double* y)
+        {
+            const int Q = D - P;
+            double* f = F[AreaMomentIndex(P, Q)];
+            const double* fx = F[AreaMomentIndex(P > 0 ? P - 1 : 0, Q)];
+            const double* fy = F[AreaMomentIndex(P, Q > 0 ? Q - 1 : 0)];
+            for (int l = 0; l < W; l++)
+                f[l] += (P > 0 ? x[l] * fx[l] : 0.0) + (Q > 0 ? y[l] * fy[l] : 0.0);
+            Sweep<N, W, D, P + 1>::Apply(F, x, y);
+        }
+    };
+
+    // Past the last term of degree D: continue with degree D + 1
+    template <int N, int W, int D, int P>
+    struct Sweep<N, W, D, P, true, false>
+    {
+        static void Apply(double (*F)[W], const double* x, const double* y)
+        {
+            Sweep<N, W, D + 1, 0>::Apply(F, x, y);
+        }
+    };
+
+    // Past the maximum order
+    template <int N, int W, int D, int P, bool NextDegree>
+    struct Sweep<N, W, D, P, NextDegree, true>
+    {
+        static void Apply(double (*)[W], const double*, const double*) {}
+    };
+}
+
+// Accumulates every monomial moment M_pq = integral of x^p y^q dA with
+// p + q <= N over a triangle mesh, in one pass, exactly.
+//
+// For a triangle with corners (x_k, y_k) and signed area A,
+//   M_pq = 2A p! q! / (p+q+2)! * S_pq
+// where S_pq is the coefficient of s^p t^q in prod_k 1 / (1 - x_k s - y_k t).
+// Multiplying in one corner at a time is the recurrence in Sweep, so a
+// triangle costs three sweeps over the (N+1)(N+2)/2 terms. Triangles are
+// processed LANES at a time, one per lane. Sums keep the triangles'
+// orientation, so clockwise meshes come out negated, as in the calculator.
+template <int N>
+class CAreaMomentAccumulator
+{
+public:
+    enum
+    {
+        ORDER = N,
+        COUNT = AreaMomentCount(N),
+        LANES = 4
+    };
+
+    CAreaMomentAccumulator() { Reset(); }
+
+    void Reset()
+    {
+        for (int k = 0; k < COUNT; k++)
+            m_moments[k] = 0;
+    }
+
+    // Add every triangle of an indexed 2D mesh, with coordinates taken
+    // relative to (originX, originY); pass the centroid for central moments
+    void AddMesh(const std::vector<double>& vertices2D, const std::vector<int>& indices,
+                 double originX = 0, double originY = 0)
+    {
+        double sums[COUNT][LANES] = {};
+        int numTriangles = (int)indices.size() / 3;
+
+        for (int first = 0; first < numTriangles; first += LANES)
+        {
+            // Gather one triangle per lane; missing lanes get zero area
+            double x[3][LANES], y[3][LANES], area2[LANES];
+            for (int l = 0; l < LANES; l++)
+            {
+                int t = first + l;
+                for (int k = 0; k < 3; k++)
+                {
+                    int v = (t < numTriangles) ? indices[t * 3 + k] : -1;
+                    x[k][l] = (v >= 0) ? vertices2D[v * 2] - originX : 0.0;
+                    y[k][l] = (v >= 0) ? vertices2D[v * 2 + 1] - originY : 0.0;
+                }
+                area2[l] = (x[1][l] - x[0][l]) * (y[2][l] - y[0][l]) - (x[2][l] - x[0][l]) * (y[1][l] - y[0][l]);
+            }
+
+            double F[COUNT][LANES] = {};
+            for (int l = 0; l < LANES; l++)
+                F[0][l] = 1.0;
+            for (int k = 0; k < 3; k++)
+                AreaMomentDetail::Sweep<N, LANES, 1, 0>::Apply(F, x[k], y[k]);
+
+            for (int m = 0; m < COUNT; m++)
+                for (int l = 0; l < LANES; l++)
+                    sums[m][l] += area2[l] * F[m][l];
+        }
+
+        for (int d = 0; d <= N; d++)
+        {
+            for (int q = 0; q <= d; q++)
+            {
+                int m = AreaMomentIndex(d - q, q);
+                double total = 0;
+                for (int l = 0; l < LANES; l++)
+                    total += sums[m][l];
+                m_moments[m] += AreaMomentWeight(d - q, q) * total;
+            }
+        }
+    }
+
+    double Get(int p, int q) const { return m_moments[AreaMomentIndex(p, q)]; }
+
+    // All COUNT moments in graded order (see AreaMomentIndex)
+    const double* GetAll() const { return m_moments; }
+
+private:
+    double m_moments[COUNT];
+};
+
+#endif // AREA_MOMENT_ACCUMULATOR_H
@@ -19,14 +19,64 @@ AreaMomentsResult CAreaMomentsCalculator::Calculate(const std::vector<double>& v
 {
     AreaMomentsResult result;
 
-    if (vertices2D.empty() || indices.empty())
+    // First pass: calculate total area and centroid
+    double totalArea = 0;
+    if (!CalculateAreaCentroid(vertices2D, indices, totalArea, result.Cx, result.Cy))
         return result;
 
+    result.area = fabs(totalArea);
+
+    // Second pass: calculate moments about origin, then transfer to centroid
+    double Ix_origin = 0, Iy_origin = 0, Ixy_origin = 0;
+    CalculateOriginMoments(vertices2D, indices, Ix_origin, Iy_origin, Ixy_origin);
+
+    // Use parallel axis theorem to transfer to centroid
+    // I_centroid = I_origin - A * d^2
+    result.Ix = Ix_origin - result.area * result.Cy * result.Cy;
+    result.Iy = Iy_origin - result.area * result.Cx * result.Cx;
+    result.Ixy = Ixy_origin - result.area * result.Cx * result.Cy;
+
+    CalculatePrincipal(result);
+    return result;
+}
+
+void CAreaMomentsCalculator::CalculatePrincipal(AreaMomentsResult& result)
+{
+    // Calculate principal moments
+    // I_principal = (Ix + Iy) / 2 +/- sqrt(((Ix - Iy) / 2)^2 + Ixy^2)
+    double Iavg = (result.Ix + result.Iy) / 2.0;
+    double Idiff = (result.Ix - result.Iy) / 2.0;
+    double R = sqrt(Idiff * Idiff + result.Ixy * result.Ixy);
+
+    result.Imax = Iavg + R;
+    result.Imin = Iavg - R;
+
+    // Principal angle (angle to max principal axis from X-axis)
+    // theta = 0.5 * atan2(-2*Ixy, Ix - Iy)
+    if (fabs(result.Ixy) < 1e-15 && fabs(Idiff) < 1e-15)
+    {
+        result.theta = 0;
+    }
+    else
+    {
+        result.theta = 0.5 * atan2(-2.0 * result.Ixy, result.Ix - result.Iy);
+    }
+}
+
+bool CAreaMomentsCalculator::CalculateAreaCentroid(const std::vector<double>& vertices2D,
+                                                   const std::vector<int>& indices,
+                                                   double& signedArea, double& Cx, double& Cy)
+{
+    signedArea = 0;
+    Cx = Cy = 0;
+
+    if (vertices2D.empty() || indices.empty())
+        return false;
+
     int numTriangles = (int)indices.size() / 3;
     if (numTriangles == 0)
-        return result;
+        return false;
 
-    // First pass: calculate total area and centroid
     double totalArea = 0;
     double sumCx = 0, sumCy = 0;
 
@@ -54,14 +104,21 @@ AreaMomentsResult CAreaMomentsCalculator::Calculate(const std::vector<double>& v
     }
 
     if (fabs(totalArea) < 1e-15)
-        return result;
+        return false;
 
-    result.area = fabs(totalArea);
-    result.Cx = sumCx / totalArea;
-    result.Cy = sumCy / totalArea;
+    signedArea = totalArea;
+    Cx = sumCx / totalArea;
+    Cy = sumCy / totalArea;
+    return true;
+}
 
-    // Second pass: calculate moments about origin, then transfer to centroid
-    double Ix_origin = 0, Iy_origin = 0, Ixy_origin = 0;
+void CAreaMomentsCalculator::CalculateOriginMoments(const std::vector<double>& vertices2D,
+                                                    const std::vector<int>& indices,
+                                                    double& Ixx, double& Iyy, double& Ixy)
+{
+    Ixx = Iyy = Ixy = 0;
+
+    int numTriangles = (int)indices.size() / 3;
 
     for (int t = 0; t < numTriangles; t++)
     {
@@ -81,38 +138,53 @@ AreaMomentsResult CAreaMomentsCalculator::Calculate(const std::vector<double>& v
         double Ix_tri, Iy_tri, Ixy_tri;
         TriangleMomentsAboutOrigin(x1, y1, x2, y2, x3, y3, area, Ix_tri, Iy_tri, Ixy_tri);
 
-        Ix_origin += Ix_tri;
-        Iy_origin += Iy_tri;
-        Ixy_origin += Ixy_tri;
+        Ixx += Ix_tri;
+        Iyy += Iy_tri;
+        Ixy += Ixy_tri;
     }
+}
 
-    // Use parallel axis theorem to transfer to centroid
-    // I_centroid = I_origin - A * d^2
-    result.Ix = Ix_origin - result.area * result.Cy * result.Cy;
-    result.Iy = Iy_origin - result.area * result.Cx * result.Cx;
-    result.Ixy = Ixy_origin - result.area * result.Cx * result.Cy;
-
-    // Calculate principal moments
-    // I_principal = (Ix + Iy) / 2 +/- sqrt(((Ix - Iy) / 2)^2 + Ixy^2)
-    double Iavg = (result.Ix + result.Iy) / 2.0;
-    double Idiff = (result.Ix - result.Iy) / 2.0;
-    double R = sqrt(Idiff * Idiff + result.Ixy * result.Ixy);
+void CAreaMomentsCalculator::CalculateCentroidMoments(const std::vector<double>& vertices2D,
+                                                      const std::vector<int>& indices,
+                                                      double Cx, double Cy,
+                                                      double& Ix, double& Iy, double& Ixy,
+                                                      TriangleContribution* contributions)
+{
+    Ix = Iy = Ixy = 0;
 
-    result.Imax = Iavg + R;
-    result.Imin = Iavg - R;
+    int numTriangles = (int)indices.size() / 3;
 
-    // Principal angle (angle to max principal axis from X-axis)
-    // theta = 0.5 * atan2(-2*Ixy, Ix - Iy)
-    if (fabs(result.Ixy) < 1e-15 && fabs(Idiff) < 1e-15)
-    {
-        result.theta = 0;
-    }
-    else
+    for (int t = 0; t < numTriangles; t++)
     {
-        result.theta = 0.5 * atan2(-2.0 * result.Ixy, result.Ix - result.Iy);
-    }
+        int i0 = indices[t * 3];
+        int i1 = indices[t * 3 + 1];
+        int i2 = indices[t * 3 + 2];
 
-    return result;
+        // Centroid relative coordinates: no parallel axis correction, and
+        // no cancellation for sections far from the local origin
+        double x1 = vertices2D[i0 * 2] - Cx;
+        double y1 = vertices2D[i0 * 2 + 1] - Cy;
+        double x2 = vertices2D[i1 * 2] - Cx;
+        double y2 = vertices2D[i1 * 2 + 1] - Cy;
+        double x3 = vertices2D[i2 * 2] - Cx;
+        double y3 = vertices2D[i2 * 2 + 1] - Cy;
+
+        double area = SignedTriangleArea(x1, y1, x2, y2, x3, y3);
+
+        double Ix_tri, Iy_tri, Ixy_tri;
+        TriangleMomentsAboutOrigin(x1, y1, x2, y2, x3, y3, area, Ix_tri, Iy_tri, Ixy_tri);
+
+        Ix += Ix_tri;
+        Iy += Iy_tri;
+        Ixy += Ixy_tri;
+
+        // The only extra work: one record store per triangle
+        if (contributions != nullptr)
+        {
+            TriangleContribution c = { Ix_tri, Iy_tri };
+            contributions[t] = c;
+        }
+    }
 }
 
 std::vector<double> CAreaMomentsCalculator::ProjectTo2D(const std::vector<double>& vertices3D,
@@ -128,6 +200,30 @@ std::vector<double> CAreaMomentsCalculator::ProjectTo2D(const std::vector<double
     vertices2D.reserve(numVertices * 2);
 
     // Create local coordinate system on the face plane
+    Vector3D xAxis, yAxis;
+    BuildLocalFrame(normal, xAxis, yAxis);
+
+    // Project each vertex to 2D
+    for (int i = 0; i < numVertices; i++)
+    {
+        Vector3D v(vertices3D[i * 3], vertices3D[i * 3 + 1], vertices3D[i * 3 + 2]);
+
+        // Translate to origin
+        Vector3D p = v - origin;
+
+        // Project onto local XY plane
+        double x2d = p.Dot(xAxis);
+        double y2d = p.Dot(yAxis);
+
+        vertices2D.push_back(x2d);
+        vertices2D.push_back(y2d);
+    }
+
+    return vertices2D;
+}
+
+void CAreaMomentsCalculator::BuildLocalFrame(const Vector3D& normal, Vector3D& xAxis, Vector3D& yAxis)
+{
     // Z-axis is the normal
     Vector3D zAxis = normal.Normalize();
 
@@ -136,7 +232,6 @@ std::vector<double> CAreaMomentsCalculator::ProjectTo2D(const std::vector<double
     Vector3D globalY(0, 1, 0);
     Vector3D globalX(1, 0, 0);
 
-    Vector3D xAxis;
     if (fabs(zAxis.Dot(globalY)) < 0.9)
     {
         xAxis = globalY.Cross(zAxis).Normalize();
@@ -147,25 +242,60 @@ std::vector<double> CAreaMomentsCalculator::ProjectTo2D(const std::vector<double
     }
 
     // Y-axis completes the right-handed system
-    Vector3D yAxis = zAxis.Cross(xAxis).Normalize();
+    yAxis = zAxis.Cross(xAxis).Normalize();
+}
 
-    // Project each vertex to 2D
-    for (int i = 0; i < numVertices; i++)
+bool CAreaMomentsCalculator::CalculateAreaCentroidFromFacets(const double* facets, int numTriangles,
+                                                             double& signedArea, double& Cx, double& Cy)
+{
+    signedArea = 0;
+    Cx = Cy = 0;
+
+    if (facets == nullptr || numTriangles <= 0)
+        return false;
+
+    // Same frame as ExtractFaceMesh: normal of the first triangle,
+    // origin at its first vertex
+    Vector3D v0(facets[0], facets[1], facets[2]);
+    Vector3D v1(facets[3], facets[4], facets[5]);
+    Vector3D v2(facets[6], facets[7], facets[8]);
+    Vector3D normal = (v1 - v0).Cross(v2 - v0).Normalize();
+
+    Vector3D xAxis, yAxis;
+    BuildLocalFrame(normal, xAxis, yAxis);
+
+    double ox = v0.Dot(xAxis);
+    double oy = v0.Dot(yAxis);
+
+    // Single pass: project each corner and accumulate area and first moments
+    double totalArea = 0;
+    double sumCx = 0, sumCy = 0;
+
+    for (int t = 0; t < numTriangles; t++)
     {
-        Vector3D v(vertices3D[i * 3], vertices3D[i * 3 + 1], vertices3D[i * 3 + 2]);
+        const double* p = facets + t * 9;
 
-        // Translate to origin
-        Vector3D p = v - origin;
+        double x1 = p[0] * xAxis.x + p[1] * xAxis.y + p[2] * xAxis.z - ox;
+        double y1 = p[0] * yAxis.x + p[1] * yAxis.y + p[2] * yAxis.z - oy;
+        double x2 = p[3] * xAxis.x + p[4] * xAxis.y + p[5] * xAxis.z - ox;
+        double y2 = p[3] * yAxis.x + p[4] * yAxis.y + p[5] * yAxis.z - oy;
+        double x3 = p[6] * xAxis.x + p[7] * xAxis.y + p[8] * xAxis.z - ox;
+        double y3 = p[6] * yAxis.x + p[7] * yAxis.y + p[8] * yAxis.z - oy;
 
-        // Project onto local XY plane
-        double x2d = p.Dot(xAxis);
-        double y2d = p.Dot(yAxis);
+        double area = SignedTriangleArea(x1, y1, x2, y2, x3, y3);
 
-        vertices2D.push_back(x2d);
-        vertices2D.push_back(y2d);
+        totalArea += area;
+        sumCx += area * (x1 + x2 + x3);
+        sumCy += area * (y1 + y2 + y3);
     }
 
-    return vertices2D;
+    if (fabs(totalArea) < 1e-15)
+        return false;
+
+    signedArea = totalArea;
+    Cx = sumCx / (3.0 * totalArea);
+    Cy = sumCy / (3.0 * totalArea);
+    return true;
 }
 
 Vector3D CAreaMomentsCalculator::CalculateNormal(const std::vector<double>& vertices3D,
@@ -23,6 +23,12 @@ struct AreaMomentsResult {
     AreaMomentsResult() : area(0), Cx(0), Cy(0), Ix(0), Iy(0), Ixy(0), Imin(0), Imax(0), theta(0) {}
 };
 
+// One triangle's share of the second moments about the centroid;
+// its share of J is Ix + Iy
+struct TriangleContribution {
+    double Ix, Iy;
+};
+
 // 3D Vector structure for coordinate transformations
 struct Vector3D {
     double x, y, z;
@@ -63,6 +69,29 @@ public:
     static AreaMomentsResult Calculate(const std::vector<double>& vertices2D,
                                         const std::vector<int>& indices);
 
+    // Fill Imin, Imax and theta of 'result' from its Ix, Iy and Ixy
+    static void CalculatePrincipal(AreaMomentsResult& result);
+
+    // First pass only: signed area and centroid of a 2D triangulated mesh
+    // Returns false if the mesh is empty or degenerate (zero area)
+    static bool CalculateAreaCentroid(const std::vector<double>& vertices2D,
+                                      const std::vector<int>& indices,
+                                      double& signedArea, double& Cx, double& Cy);
+
+    // Second pass only: signed second moments about the local origin
+    static void CalculateOriginMoments(const std::vector<double>& vertices2D,
+                                       const std::vector<int>& indices,
+                                       double& Ixx, double& Iyy, double& Ixy);
+
+    // Signed second moments about (Cx, Cy) in one pass. If 'contributions' is
+    // not null it receives each triangle's share, one record per triangle in
+    // index order; the shares add up to Ix and Iy.
+    static void CalculateCentroidMoments(const std::vector<double>& vertices2D,
+                                         const std::vector<int>& indices,
+                                         double Cx, double Cy,
+                                         double& Ix, double& Iy, double& Ixy,
+                                         TriangleContribution* contributions);
+
     // Project 3D vertices to 2D local coordinate system on face plane
     // vertices3D: array of 3D coordinates [x0, y0, z0, x1, y1, z1, ...]
     // normal: face normal vector
@@ -72,6 +101,15 @@ public:
                                             const Vector3D& normal,
                                             const Vector3D& origin);
 
+    // Area and centroid only, in a single pass over raw facet data
+    // facets: 9 doubles per triangle (3D corners), as returned by IADFace::FacetData
+    // Uses the same local frame as CalculateNormal + ProjectTo2D on the first triangle
+    static bool CalculateAreaCentroidFromFacets(const double* facets, int numTriangles,
+                                                double& signedArea, double& Cx, double& Cy);
+
+    // Build the in-plane X/Y axes used for projection from a face normal
+    static void BuildLocalFrame(const Vector3D& normal, Vector3D& xAxis, Vector3D& yAxis);
+
     // Calculate face normal from first triangle
     static Vector3D CalculateNormal(const std::vector<double>& vertices3D,
                                      const std::vector<int>& indices);
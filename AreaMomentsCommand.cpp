@@ -4,7 +4,12 @@
 #include "stdafx.h"
 #include "MyAlibreAddOn.h"
 #include "AreaMomentsCommand.h"
+#include "EventLog.h"
+#include "FacetCodec.h"
+#include "MeshSimplifier.h"
+#include "SharedMetrics.h"
 #include <cmath>
+#include <ctime>
 
 #ifdef _DEBUG
 #undef THIS_FILE
@@ -15,6 +20,31 @@ static char THIS_FILE[] = __FILE__;
 // Access to the application object for IADRoot
 extern CMyAlibreAddOnApp theApp;
 
+// Property nodes evaluated eagerly; they back the tree nodes open by default
+// (section moduli are needed right away for the result history)
+static const unsigned int DEFAULT_PROPERTY_NODES =
+    SECTION_NODE_BIT(SECTION_NODE_AREA_CENTROID) |
+    SECTION_NODE_BIT(SECTION_NODE_CENTROID_MOMENTS) |
+    SECTION_NODE_BIT(SECTION_NODE_PRINCIPAL) |
+    SECTION_NODE_BIT(SECTION_NODE_SECTION_MODULUS);
+
+// Chordal tolerance passed to FacetData, cm; part of the tessellation key
+static const double FACET_SURFACE_TOLERANCE = 0.001;
+
+// Read a property by name through IDispatch, whatever its VARIANT type
+static bool GetDispatchProperty(IDispatch* pDispatch, const wchar_t* name, _variant_t& value)
+{
+    DISPID id = DISPID_UNKNOWN;
+    LPOLESTR names[1] = { const_cast<LPOLESTR>(name) };
+    if (FAILED(pDispatch->GetIDsOfNames(IID_NULL, names, 1, LOCALE_USER_DEFAULT, &id)))
+        return false;
+
+    DISPPARAMS noArguments = { nullptr, nullptr, 0, 0 };
+    value.Clear();
+    return SUCCEEDED(pDispatch->Invoke(id, IID_NULL, LOCALE_USER_DEFAULT, DISPATCH_PROPERTYGET,
+                                       &noArguments, &value, nullptr, nullptr));
+}
+
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
@@ -147,6 +177,8 @@ HRESULT __stdcall CAreaMomentsCommand::OnSelectionChange()
 {
     AFX_MANAGE_STATE(AfxGetStaticModuleState());
 
+    CEventLogScope scope(STAGE_SELECTION);
+
     try
     {
         // Initialize session if needed
@@ -171,47 +203,54 @@ HRESULT __stdcall CAreaMomentsCommand::OnSelectionChange()
             return S_OK;
 
         long count = pSelected->GetCount();
-        int faceIndex = 1;
+
+        // Resolve faces with plain HRESULT calls: most selections hold
+        // non-face objects too, and each failed smart pointer conversion
+        // would cost a _com_error. Type names are looked up later, by the
+        // calculation.
+        std::vector<void*> faces;
+        faces.reserve(count);
 
         for (long i = 0; i < count; i++)
         {
-            IDispatchPtr pObj = pSelected->GetItem(_variant_t(i));
-            if (pObj == nullptr)
+            IDispatch* pObj = nullptr;
+            if (FAILED(pSelected->get_Item(_variant_t(i), &pObj)) || pObj == nullptr)
                 continue;
 
-            try
+            IADTargetProxy* pProxy = nullptr;
+            if (SUCCEEDED(pObj->QueryInterface(__uuidof(IADTargetProxy), (void**)&pProxy)) && pProxy != nullptr)
             {
-                IADTargetProxyPtr pProxy = pObj;
-                if (pProxy != nullptr)
+                IDispatch* pTarget = nullptr;
+                if (SUCCEEDED(pProxy->get_Target(&pTarget)) && pTarget != nullptr)
                 {
-                    IDispatchPtr pTarget = pProxy->GetTarget();
-                    if (pTarget != nullptr)
+                    IADFace* pFace = nullptr;
+                    if (SUCCEEDED(pTarget->QueryInterface(__uuidof(IADFace), (void**)&pFace)) && pFace != nullptr)
                     {
-                        IADFacePtr pFace = pTarget;
-                        if (pFace != nullptr)
-                        {
-                            std::string typeName = GetFaceTypeName(pFace);
-                            char nameBuf[128];
-                            sprintf_s(nameBuf, "%s %d", typeName.c_str(), faceIndex++);
-                            m_pWindow->AddSelection(nameBuf, (void*)pFace.GetInterfacePtr());
-                        }
+                        // The selection keeps the face alive, as before
+                        faces.push_back(pFace);
+                        pFace->Release();
                     }
+                    pTarget->Release();
                 }
+                pProxy->Release();
             }
-            catch (_com_error&)
-            {
-                // Not a face, skip
-            }
+            pObj->Release();
         }
+
+        m_pWindow->AddSelections(faces.empty() ? nullptr : &faces[0], (int)faces.size());
+        scope.SetCount(faces.size());
+        CSharedMetrics::SetGauge(GAUGE_QUEUE_DEPTH, faces.size());
     }
     catch (_com_error& e)
     {
+        CEventLog::Error(SITE_SELECTION, (uint32_t)e.Error());
         CString msg;
         msg.Format(_T("Error processing selection: %s"), (LPCTSTR)e.Description());
         AfxMessageBox(msg);
     }
     catch (...)
     {
+        CEventLog::Error(SITE_SELECTION, (uint32_t)E_UNEXPECTED);
         AfxMessageBox(_T("Unknown error occurred while processing selection."));
     }
 
@@ -233,98 +272,200 @@ void CAreaMomentsCommand::DoCalculate()
     if (m_pWindow == nullptr)
         return;
 
-    std::lock_guard<std::mutex> lock(m_pWindow->GetMutex());
-    auto& selections = m_pWindow->GetSelections();
-
-    for (size_t i = 0; i < selections.size(); i++)
     {
-        if (!selections[i].hasResult)
+        std::lock_guard<std::mutex> lock(m_pWindow->GetMutex());
+        CSectionResultStore& results = m_pWindow->GetResults();
+        CEventLogScope scope(STAGE_CALCULATE, results.GetRowCount());
+
+        bool quickMode = m_pWindow->IsQuickModeEnabled();
+
+        // Quick mode fills empty rows; a full pass also upgrades rows
+        // left over from quick mode
+        std::vector<int> pending;
+        for (int i = 0; i < results.GetRowCount(); i++)
+        {
+            if (!results.HasResult(i) || (!quickMode && results.IsQuickResult(i)))
+                pending.push_back(i);
+        }
+
+        for (size_t n = 0; n < pending.size(); n++)
         {
-            CalculateFace(selections[i]);
+            CSharedMetrics::SetGauge(GAUGE_QUEUE_DEPTH, pending.size() - n);
+            if (quickMode)
+                CalculateFaceQuick(results, pending[n]);
+            else
+                CalculateFace(results, pending[n]);
         }
+        CSharedMetrics::SetGauge(GAUGE_QUEUE_DEPTH, 0);
+
+        CSharedMetrics::SetGauge(GAUGE_RESULT_BYTES, results.GetMemoryBytes());
+        CSharedMetrics::SetGauge(GAUGE_HISTORY_BYTES, m_pWindow->GetHistory().GetMemoryBytes());
     }
+
+    // Wake the window if it is idle
+    m_pWindow->RequestRedraw();
 }
 
-bool CAreaMomentsCommand::CalculateFace(ImGuiSelectionItem& item)
+bool CAreaMomentsCommand::CalculateFace(CSectionResultStore& results, int row)
 {
-    if (item.pFace == nullptr)
+    void* pFaceRaw = results.GetFace(row);
+    if (pFaceRaw == nullptr)
         return false;
 
-    IADFacePtr pFace((AlibreX::IADFace*)item.pFace);
-
-    std::vector<double> vertices2D;
-    std::vector<int> indices;
-    double perimeter = 0;
+    IADFacePtr pFace((AlibreX::IADFace*)pFaceRaw);
+    CEventLogScope scope(STAGE_FACE, 1);
 
-    if (!ExtractFaceMesh(pFace, vertices2D, indices, perimeter))
+    // From the tessellation cache when the face has not changed
+    TessellationMesh mesh;
+    if (!GetFaceMesh(pFace, row, mesh))
         return false;
+    std::vector<double>& vertices2D = mesh.vertices2D;
+    std::vector<int>& indices = mesh.indices;
+    const Vector3D& normal = mesh.normal;
+    const Vector3D& origin = mesh.origin;
+
+    // Results of the same geometry under the same settings are shared by
+    // every instance on the machine; fingerprint the mesh as captured.
+    // Simplifying changes no result, so it is not part of the key.
+    CResultCache& resultCache = m_pWindow->GetResultCache();
+    uint64_t resultKey = 0;
+    if (resultCache.IsOpen())
+    {
+        const double settings[] = { FACET_SURFACE_TOLERANCE, mesh.perimeter };
+        uint64_t fingerprint = CResultCache::FingerprintMesh(vertices2D, indices, CFacetCodec::DEFAULT_TOLERANCE);
+        resultKey = CResultCache::MakeKey(fingerprint, settings, (int)(sizeof(settings) / sizeof(settings[0])));
+    }
 
-    // Calculate basic area moments
-    AreaMomentsResult basicResult = CAreaMomentsCalculator::Calculate(vertices2D, indices);
+    // Hand the mesh to the property graph; only the nodes shown by default
+    // are evaluated now, the rest are computed when the UI or export asks
+    ImGuiAreaMomentsResult r;
+    std::unique_ptr<CSectionPropertyGraph> graph(new CSectionPropertyGraph());
+    graph->SetMesh(std::move(vertices2D), std::move(indices), mesh.perimeter, r);
+
+    // A hit fills the default nodes and the shape descriptor; the graph
+    // still evaluates anything else on demand
+    SectionShapeMoments moments;
+    bool cached = resultKey != 0 && resultCache.Find(resultKey, r, moments);
+    if (resultKey != 0)
+        CEventLog::Cache(CACHE_RESULT, cached, resultKey);
+    if (!cached)
+    {
+        graph->Require(DEFAULT_PROPERTY_NODES, r);
 
-    // Fill in full result
-    ImGuiAreaMomentsResult& r = item.result;
-    r.area = basicResult.area;
-    r.perimeter = perimeter;
-    r.Cx = basicResult.Cx;
-    r.Cy = basicResult.Cy;
+        // Shape descriptor for the section library, while the graph is at hand
+        graph->Require(SECTION_NODE_BIT(SECTION_NODE_PRINCIPAL), r);
+        moments = graph->RequireShapeMoments(r);
+        if (resultKey != 0)
+            resultCache.Store(resultKey, r, moments);
+    }
+    else
+    {
+        graph->Restore(r, moments);
+    }
 
-    // Inertia about origin (using parallel axis theorem)
-    r.Ixx_origin = basicResult.Ix + r.area * r.Cy * r.Cy;
-    r.Iyy_origin = basicResult.Iy + r.area * r.Cx * r.Cx;
-    r.Ixy_origin = basicResult.Ixy + r.area * r.Cx * r.Cy;
+    // The graph keeps its mesh for as long as the row lives; draw a much
+    // smaller one, and drop the captured one once nothing is left to
+    // evaluate from it
+    if (m_pWindow->IsMeshSimplifyEnabled())
+        graph->SetSimplifyTolerance(CMeshSimplifier::DEFAULT_TOLERANCE);
 
-    // Polar moments
-    r.J_origin = r.Ixx_origin + r.Iyy_origin;
-    r.J_centroid = basicResult.Ix + basicResult.Iy;
+    // Face type
+    r.faceType = GetFaceTypeName(pFace);
 
-    // Moments about centroid
-    r.Ix_centroid = basicResult.Ix;
-    r.Iy_centroid = basicResult.Iy;
-    r.Ixy_centroid = basicResult.Ixy;
+    results.SetResult(row, r, std::move(graph));
+
+    // Record the design state under the face and its plane so edits made
+    // between reselections show up as history; coplanar faces keep
+    // separate lineages through their persistent keys
+    std::vector<uint8_t> faceKey;
+    GetPersistentKey(pFace, faceKey);
+    uint64_t lineageKey = CSectionHistory::MakeLineageKey(faceKey.data(), faceKey.size(), normal.x, normal.y,
+                                                          normal.z, origin.x, origin.y, origin.z);
+    results.SetLineageKey(row, lineageKey);
+    uint32_t now = (uint32_t)time(nullptr);
+    m_pWindow->GetHistory().Record(lineageKey, r, now);
+    m_pWindow->GetLibrary().Add(results.GetName(row), r, moments, now);
+    return true;
+}
 
-    // Principal moments
-    r.Ix_principal = basicResult.Imin;
-    r.Iy_principal = basicResult.Imax;
+bool CAreaMomentsCommand::GetPersistentKey(IADFacePtr pFace, std::vector<uint8_t>& keyBytes)
+{
+    // The property type is not assumed: the persistent key may be an
+    // integer array or a string
+    keyBytes.clear();
+    _variant_t key;
+    if (!GetDispatchProperty(pFace, L"Key", key))
+        return false;
 
-    // Rotation angle
-    r.theta_deg = basicResult.theta * 180.0 / 3.14159265358979323846;
+    VARTYPE element = (VARTYPE)(key.vt & VT_TYPEMASK);
+    if ((key.vt & VT_ARRAY) != 0 && (key.vt & VT_BYREF) == 0 && key.parray != nullptr &&
+        SafeArrayGetDim(key.parray) == 1 && element != VT_VARIANT && element != VT_BSTR &&
+        element != VT_DISPATCH && element != VT_UNKNOWN)
+    {
+        long lBound = 0, uBound = -1;
+        SafeArrayGetLBound(key.parray, 1, &lBound);
+        SafeArrayGetUBound(key.parray, 1, &uBound);
+        size_t bytes = (size_t)(uBound - lBound + 1) * SafeArrayGetElemsize(key.parray);
 
-    // Radii of gyration
-    if (r.area > 1e-10)
+        void* pData = nullptr;
+        if (uBound >= lBound && SUCCEEDED(SafeArrayAccessData(key.parray, &pData)))
+        {
+            keyBytes.assign((const uint8_t*)pData, (const uint8_t*)pData + bytes);
+            SafeArrayUnaccessData(key.parray);
+        }
+    }
+    else if (key.vt == VT_BSTR && key.bstrVal != nullptr)
     {
-        r.Rx = sqrt(basicResult.Ix / r.area);
-        r.Ry = sqrt(basicResult.Iy / r.area);
+        const uint8_t* pChars = (const uint8_t*)key.bstrVal;
+        keyBytes.assign(pChars, pChars + SysStringByteLen(key.bstrVal));
     }
+    return !keyBytes.empty();
+}
+
+uint64_t CAreaMomentsCommand::GetTessellationKey(IADFacePtr pFace)
+{
+    // The time stamp may be any number
+    std::vector<uint8_t> keyBytes;
+    _variant_t timeStamp, stamp;
+    if (!GetPersistentKey(pFace, keyBytes) || !GetDispatchProperty(pFace, L"TimeStamp", timeStamp) ||
+        FAILED(VariantChangeType(&stamp, &timeStamp, 0, VT_R8)))
+        return 0;
+
+    return CTessellationCache::MakeKey(keyBytes.data(), keyBytes.size(), stamp.dblVal, FACET_SURFACE_TOLERANCE);
+}
 
-    // Calculate extreme fiber distances from centroid
-    r.cx_max = 0;
-    r.cy_max = 0;
-    for (size_t i = 0; i < vertices2D.size(); i += 2)
+bool CAreaMomentsCommand::GetFaceMesh(IADFacePtr pFace, int row, TessellationMesh& mesh)
+{
+    CTessellationCache& cache = m_pWindow->GetTessellationCache();
+    uint64_t key = cache.IsEnabled() ? GetTessellationKey(pFace) : 0;
+    if (key != 0)
     {
-        double dx = fabs(vertices2D[i] - r.Cx);
-        double dy = fabs(vertices2D[i + 1] - r.Cy);
-        if (dx > r.cx_max) r.cx_max = dx;
-        if (dy > r.cy_max) r.cy_max = dy;
+        const TessellationMesh* cached = cache.Find(key);
+        CEventLog::Cache(CACHE_TESSELLATION, cached != nullptr, key);
+        if (cached != nullptr)
+        {
+            mesh = *cached;
+            return true;
+        }
     }
 
-    // Section modulus
-    if (r.cy_max > 1e-10)
-        r.Sx_min = basicResult.Ix / r.cy_max;
-    if (r.cx_max > 1e-10)
-        r.Sy_min = basicResult.Iy / r.cx_max;
-
-    // Face type
-    r.faceType = GetFaceTypeName(pFace);
+    if (!ExtractFaceMesh(pFace, mesh.vertices2D, mesh.indices, mesh.perimeter, mesh.normal, mesh.origin))
+        return false;
+    CEventLog::Tessellation(row, mesh.indices.size() / 3, mesh.indices.size() * 3 * sizeof(double));
 
-    item.hasResult = true;
+    // Faces without a key or time stamp are never cached, since an edit
+    // could not be told from a reselection
+    if (key != 0)
+        mesh = cache.Insert(key, std::move(mesh));
     return true;
 }
 
 bool CAreaMomentsCommand::ExtractFaceMesh(IADFacePtr pFace,
                                           std::vector<double>& vertices2D,
                                           std::vector<int>& indices,
-                                          double& perimeter)
+                                          double& perimeter,
+                                          Vector3D& normal,
+                                          Vector3D& origin)
 {
     if (pFace == nullptr)
         return false;
@@ -333,38 +474,13 @@ bool CAreaMomentsCommand::ExtractFaceMesh(IADFacePtr pFace,
 
     try
     {
-        double surfaceTol = 0.001;
-        SAFEARRAY* pFacetData = pFace->FacetData(surfaceTol);
-        if (pFacetData == nullptr)
-            return false;
-
         double* pData = nullptr;
-        HRESULT hr = SafeArrayAccessData(pFacetData, (void**)&pData);
-        if (FAILED(hr) || pData == nullptr)
-        {
-            SafeArrayDestroy(pFacetData);
-            return false;
-        }
-
-        long lBound, uBound;
-        SafeArrayGetLBound(pFacetData, 1, &lBound);
-        SafeArrayGetUBound(pFacetData, 1, &uBound);
-        long dataSize = uBound - lBound + 1;
-
-        if (dataSize < 10)
-        {
-            SafeArrayUnaccessData(pFacetData);
-            SafeArrayDestroy(pFacetData);
+        long dataSize = 0;
+        SAFEARRAY* pFacetData = AccessFacetData(pFace, pData, dataSize);
+        if (pFacetData == nullptr)
             return false;
-        }
 
         int numTriangles = (int)(dataSize / 9);
-        if (numTriangles <= 0)
-        {
-            SafeArrayUnaccessData(pFacetData);
-            SafeArrayDestroy(pFacetData);
-            return false;
-        }
 
         std::vector<double> vertices3D;
         vertices3D.reserve(numTriangles * 9);
@@ -383,17 +499,125 @@ bool CAreaMomentsCommand::ExtractFaceMesh(IADFacePtr pFace,
             }
         }
 
-        SafeArrayUnaccessData(pFacetData);
-        SafeArrayDestroy(pFacetData);
+        ReleaseFacetData(pFacetData);
 
-        Vector3D normal = CAreaMomentsCalculator::CalculateNormal(vertices3D, indices);
-        Vector3D origin(vertices3D[0], vertices3D[1], vertices3D[2]);
+        normal = CAreaMomentsCalculator::CalculateNormal(vertices3D, indices);
+        origin = Vector3D(vertices3D[0], vertices3D[1], vertices3D[2]);
         vertices2D = CAreaMomentsCalculator::ProjectTo2D(vertices3D, normal, origin);
 
         return !vertices2D.empty();
     }
     catch (_com_error& e)
     {
+        CEventLog::Error(SITE_CALCULATE_FACE, (uint32_t)e.Error());
+        CString msg;
+        msg.Format(_T("COM Error: %s"), (LPCTSTR)e.Description());
+        TRACE("%s\n", msg);
+        return false;
+    }
+    catch (...)
+    {
+        CEventLog::Error(SITE_CALCULATE_FACE, (uint32_t)E_UNEXPECTED);
+        return false;
+    }
+}
+
+SAFEARRAY* CAreaMomentsCommand::AccessFacetData(IADFacePtr pFace, double*& pData, long& dataSize)
+{
+    pData = nullptr;
+    dataSize = 0;
+
+    SAFEARRAY* pFacetData = pFace->FacetData(FACET_SURFACE_TOLERANCE);
+    if (pFacetData == nullptr)
+        return nullptr;
+
+    HRESULT hr = SafeArrayAccessData(pFacetData, (void**)&pData);
+    if (FAILED(hr) || pData == nullptr)
+    {
+        SafeArrayDestroy(pFacetData);
+        return nullptr;
+    }
+
+    long lBound, uBound;
+    SafeArrayGetLBound(pFacetData, 1, &lBound);
+    SafeArrayGetUBound(pFacetData, 1, &uBound);
+    dataSize = uBound - lBound + 1;
+
+    // Need at least one full triangle
+    if (dataSize < 10 || dataSize / 9 <= 0)
+    {
+        ReleaseFacetData(pFacetData);
+        pData = nullptr;
+        dataSize = 0;
+        return nullptr;
+    }
+
+    return pFacetData;
+}
+
+void CAreaMomentsCommand::ReleaseFacetData(SAFEARRAY* pFacetData)
+{
+    SafeArrayUnaccessData(pFacetData);
+    SafeArrayDestroy(pFacetData);
+}
+
+bool CAreaMomentsCommand::CalculateFaceQuick(CSectionResultStore& results, int row)
+{
+    void* pFaceRaw = results.GetFace(row);
+    if (pFaceRaw == nullptr)
+        return false;
+
+    IADFacePtr pFace((AlibreX::IADFace*)pFaceRaw);
+    CEventLogScope scope(STAGE_FACE_QUICK, 1);
+
+    try
+    {
+        double signedArea = 0, Cx = 0, Cy = 0;
+        bool ok = false;
+        if (m_pWindow->GetTessellationCache().IsEnabled())
+        {
+            // Through the cache, so the full calculation that upgrades
+            // this row reuses the same extraction
+            TessellationMesh mesh;
+            if (!GetFaceMesh(pFace, row, mesh))
+                return false;
+            ok = CAreaMomentsCalculator::CalculateAreaCentroid(mesh.vertices2D, mesh.indices, signedArea, Cx, Cy);
+        }
+        else
+        {
+            double* pData = nullptr;
+            long dataSize = 0;
+            SAFEARRAY* pFacetData = AccessFacetData(pFace, pData, dataSize);
+            if (pFacetData == nullptr)
+                return false;
+            CEventLog::Tessellation(row, dataSize / 9, dataSize * sizeof(double));
+
+            // One reduced pass straight over the facet array: no vertex
+            // copies, no index buffer and no retained mesh
+            ok = CAreaMomentsCalculator::CalculateAreaCentroidFromFacets(
+                pData, (int)(dataSize / 9), signedArea, Cx, Cy);
+
+            ReleaseFacetData(pFacetData);
+        }
+
+        if (!ok)
+            return false;
+
+        ImGuiAreaMomentsResult r;
+        r.area = fabs(signedArea);
+        r.Cx = Cx;
+        r.Cy = Cy;
+        r.computed = SECTION_NODE_BIT(SECTION_NODE_AREA_CENTROID);
+        r.faceType = GetFaceTypeName(pFace);
+
+        // No graph marks the row as quick; a later full
+        // calculation upgrades it in place
+        results.SetResult(row, r, nullptr);
+        return true;
+    }
+    catch (_com_error& e)
+    {
+        CEventLog::Error(SITE_CALCULATE_FACE_QUICK, (uint32_t)e.Error());
         CString msg;
         msg.Format(_T("COM Error: %s"), (LPCTSTR)e.Description());
         TRACE("%s\n", msg);
@@ -401,6 +625,7 @@ bool CAreaMomentsCommand::ExtractFaceMesh(IADFacePtr pFace,
     }
     catch (...)
     {
+        CEventLog::Error(SITE_CALCULATE_FACE_QUICK, (uint32_t)E_UNEXPECTED);
         return false;
     }
 }
@@ -11,6 +11,7 @@
 #include "BaseCommand.h"
 #include "AreaMomentsCalculator.h"
 #include "ImGuiAreaMomentsWindow.h"
+#include "TessellationCache.h"
 
 class CAreaMomentsCommand : public CBaseCommand
 {
@@ -38,13 +39,34 @@ private:
     void DoCalculate();
 
     // Calculate for a single face
-    bool CalculateFace(ImGuiSelectionItem& item);
+    bool CalculateFace(CSectionResultStore& results, int row);
+
+    // Quick mode: area and centroid only, from one pass over the facet data
+    bool CalculateFaceQuick(CSectionResultStore& results, int row);
+
+    // Fetch and lock the face's facet array (9 doubles per triangle)
+    SAFEARRAY* AccessFacetData(IADFacePtr pFace, double*& pData, long& dataSize);
+    void ReleaseFacetData(SAFEARRAY* pFacetData);
+
+    // Bytes of a face's persistent key, which survives design edits;
+    // false if the face does not report one
+    bool GetPersistentKey(IADFacePtr pFace, std::vector<uint8_t>& keyBytes);
+
+    // Cache key of a face's tessellation from its persistent key and
+    // time stamp; 0 if the face does not report them
+    uint64_t GetTessellationKey(IADFacePtr pFace);
+
+    // Welded mesh of a face: from the tessellation cache, or extracted
+    // (and cached) on a miss
+    bool GetFaceMesh(IADFacePtr pFace, int row, TessellationMesh& mesh);
 
     // Extract mesh data from face
     bool ExtractFaceMesh(IADFacePtr pFace,
                          std::vector<double>& vertices2D,
                          std::vector<int>& indices,
-                         double& perimeter);
+                         double& perimeter,
+                         Vector3D& normal,
+                         Vector3D& origin);
 
     // Get face type name
     std::string GetFaceTypeName(IADFacePtr pFace);
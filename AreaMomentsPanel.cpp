@@ -0,0 +1,1649 @@
+// AreaMomentsPanel.cpp: Backend independent content of the Area Moments window
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "AreaMomentsPanel.h"
+#include "UIAllocator.h"
+#include "UIFont.h"
+#include "SharedMetrics.h"
+
+#include "imgui/imgui.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cfloat>
+#include <cstdio>
+#include <cstring>
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+// Unit conversion constants
+static const double CM_TO_MM = 10.0;
+static const double CM_TO_INCH = 1.0 / 2.54;
+
+CAreaMomentsPanel::CAreaMomentsPanel()
+{
+}
+
+void CAreaMomentsPanel::ClearSelections()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_table.ArchiveRun(m_results);
+    m_results.Clear();
+    m_sizing.clear();
+    m_offsets.clear();
+    m_selectedIndex = -1;
+}
+
+unsigned int CAreaMomentsPanel::Render()
+{
+    unsigned int actions = PANEL_ACTION_NONE;
+
+    ImGuiIO& io = ImGui::GetIO();
+
+    // Set next window to fill the client area
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(io.DisplaySize);
+
+    ImGuiWindowFlags flags = ImGuiWindowFlags_NoTitleBar |
+                             ImGuiWindowFlags_NoResize |
+                             ImGuiWindowFlags_NoMove |
+                             ImGuiWindowFlags_NoCollapse;
+
+    ImGui::Begin("AreaMoments", nullptr, flags);
+
+    // Title
+    ImGui::TextColored(ImVec4(0.4f, 0.8f, 1.0f, 1.0f), "Area Moments of Inertia");
+    ImGui::Separator();
+    ImGui::Spacing();
+
+    // Units selector - wider dropdown
+    const char* units[] = { "Centimeters (cm)", "Millimeters (mm)", "Inches (in)" };
+    ImGui::SetNextItemWidth(CUIFont::Scale(350));
+    ImGui::Combo("Units", &m_currentUnits, units, IM_ARRAYSIZE(units));
+    ImGui::Spacing();
+
+    // Auto-calculate toggle
+    ImGui::Checkbox("Auto-Calculate", &m_autoCalculate);
+    ImGui::SameLine();
+
+    // Quick mode toggle; leaving quick mode upgrades quick rows to full results
+    if (ImGui::Checkbox("Quick Mode (area + centroid)", &m_quickMode) && !m_quickMode)
+        actions |= PANEL_ACTION_CALCULATE;
+    ImGui::SameLine();
+
+    // Applies to faces calculated from now on
+    ImGui::Checkbox("Simplify Stored Meshes", &m_simplifyMeshes);
+    if (ImGui::IsItemHovered())
+        ImGui::SetTooltip("Keeps a smaller mesh for the contribution heatmap; every property\n"
+                          "is still computed from the mesh as captured, which is dropped\n"
+                          "once nothing is left to compute from it");
+    ImGui::Spacing();
+
+    // Selections list (hidden when auto-calculate is on)
+    if (!m_autoCalculate)
+    {
+        ImGui::Text("Selected Faces:");
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (m_results.GetRowCount() == 0)
+            {
+                ImGui::TextDisabled("  No faces selected");
+            }
+            else
+            {
+                ImGui::BeginChild("SelectionsList", ImVec2(0, CUIFont::Scale(120)), true);
+                for (int i = 0; i < m_results.GetRowCount(); i++)
+                {
+                    bool isSelected = (m_selectedIndex == i);
+                    if (ImGui::Selectable(m_results.GetName(i), isSelected))
+                    {
+                        m_selectedIndex = i;
+                    }
+                }
+                ImGui::EndChild();
+            }
+        }
+
+        ImGui::Spacing();
+    }
+
+    ImGui::Separator();
+    ImGui::Spacing();
+
+    // Calculate height for results area (leave room for buttons at bottom)
+    float buttonHeight = CUIFont::Scale(50.0f);
+    float buttonAreaHeight = buttonHeight + CUIFont::Scale(30.0f); // button + padding
+    float availableHeight = ImGui::GetContentRegionAvail().y - buttonAreaHeight;
+
+    // Results display
+    ImGui::Text("Results:");
+    if (ImGui::BeginTabBar("ResultViews"))
+    {
+        static const char* viewNames[] = { "Details", "Compare", "Performance" };
+        for (int view = 0; view < PANEL_VIEW_COUNT; view++)
+        {
+            ImGuiTabItemFlags tabFlags = (m_requestedView == view) ? ImGuiTabItemFlags_SetSelected : 0;
+            if (ImGui::BeginTabItem(viewNames[view], nullptr, tabFlags))
+            {
+                m_activeView = view;
+                ImGui::EndTabItem();
+            }
+        }
+        m_requestedView = -1;
+        ImGui::EndTabBar();
+    }
+
+    availableHeight = ImGui::GetContentRegionAvail().y - buttonAreaHeight;
+    ImGui::BeginChild("Results", ImVec2(0, availableHeight), true);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_activeView == PANEL_VIEW_PERFORMANCE)
+        {
+            actions |= RenderPerformance();
+        }
+        else if (m_activeView == PANEL_VIEW_COMPARE)
+        {
+            RenderCustomColumns();
+            m_customColumns.Update(m_results);
+            m_table.Render(m_results, m_customColumns, GetLengthFactor(), GetLengthUnit());
+        }
+        else if (!m_results.HasAnyResult())
+        {
+            ImGui::TextDisabled("Select faces and click Calculate.");
+        }
+        else
+        {
+            double lenFactor = GetLengthFactor();
+            double areaFactor = GetAreaFactor();
+            double inertiaFactor = GetInertiaFactor();
+            double sectionModFactor = lenFactor * lenFactor * lenFactor;
+            const char* lenUnit = GetLengthUnit();
+
+            SectionResultRow item;
+            const auto& r = item.result;
+
+            for (int i = 0; i < m_results.GetRowCount(); i++)
+            {
+                if (!m_results.HasResult(i))
+                    continue;
+
+                m_results.ReadRow(i, item);
+
+                if (i > 0)
+                {
+                    ImGui::Spacing();
+                    ImGui::Separator();
+                    ImGui::Spacing();
+                }
+
+                // Header
+                ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.2f, 1.0f), "%s", item.name);
+                ImGui::Spacing();
+
+                // Every face has the same tree nodes; scope their state to the row
+                ImGui::PushID(i);
+
+                // Area and Centroid
+                // Each tree node only evaluates its properties once it is opened
+                if (ImGui::TreeNodeEx("Basic Properties", ImGuiTreeNodeFlags_DefaultOpen))
+                {
+                    RequireNodes(i, SECTION_NODE_BIT(SECTION_NODE_AREA_CENTROID), item);
+                    ImGui::Text("Area: %.6f %s^2", r.area * areaFactor, lenUnit);
+                    ImGui::Text("Centroid: (%.6f, %.6f) %s", r.Cx * lenFactor, r.Cy * lenFactor, lenUnit);
+                    ImGui::TreePop();
+                }
+
+                // Quick rows stop here; the remaining nodes need the full mesh
+                if (item.quick)
+                {
+                    ImGui::TextDisabled("Quick result (area and centroid only)");
+                    ImGui::PopID();
+                    continue;
+                }
+
+                // First Moments
+                if (ImGui::TreeNode("First Moments"))
+                {
+                    RequireNodes(i, SECTION_NODE_BIT(SECTION_NODE_AREA_CENTROID), item);
+                    double Qx = r.area * r.Cy;
+                    double Qy = r.area * r.Cx;
+                    ImGui::Text("Qx: %.6f %s^3", Qx * sectionModFactor, lenUnit);
+                    ImGui::Text("Qy: %.6f %s^3", Qy * sectionModFactor, lenUnit);
+                    ImGui::TreePop();
+                }
+
+                // Second Moments about Origin
+                if (ImGui::TreeNode("Second Moments (about Origin)"))
+                {
+                    RequireNodes(i, SECTION_NODE_BIT(SECTION_NODE_ORIGIN_MOMENTS), item);
+                    ImGui::Text("Ixx: %.6f %s^4", r.Ixx_origin * inertiaFactor, lenUnit);
+                    ImGui::Text("Iyy: %.6f %s^4", r.Iyy_origin * inertiaFactor, lenUnit);
+                    ImGui::Text("Izz: %.6f %s^4", r.J_origin * inertiaFactor, lenUnit);
+                    ImGui::Text("Ixy: %.6f %s^4", r.Ixy_origin * inertiaFactor, lenUnit);
+                    ImGui::TreePop();
+                }
+
+                // Moments about Centroid
+                if (ImGui::TreeNodeEx("Moments about Centroid", ImGuiTreeNodeFlags_DefaultOpen))
+                {
+                    RequireNodes(i, SECTION_NODE_BIT(SECTION_NODE_CENTROID_MOMENTS), item);
+                    ImGui::Text("Ix: %.6f %s^4", r.Ix_centroid * inertiaFactor, lenUnit);
+                    ImGui::Text("Iy: %.6f %s^4", r.Iy_centroid * inertiaFactor, lenUnit);
+                    ImGui::Text("Iz (polar): %.6f %s^4", r.J_centroid * inertiaFactor, lenUnit);
+                    ImGui::Text("Ixy: %.6f %s^4", r.Ixy_centroid * inertiaFactor, lenUnit);
+                    ImGui::TreePop();
+                }
+
+                // Principal Moments
+                if (ImGui::TreeNodeEx("Principal Moments", ImGuiTreeNodeFlags_DefaultOpen))
+                {
+                    RequireNodes(i, SECTION_NODE_BIT(SECTION_NODE_PRINCIPAL), item);
+                    ImGui::Text("I1 (min): %.6f %s^4", r.Ix_principal * inertiaFactor, lenUnit);
+                    ImGui::Text("I2 (max): %.6f %s^4", r.Iy_principal * inertiaFactor, lenUnit);
+                    ImGui::Text("Principal Angle: %.2f deg", r.theta_deg);
+                    ImGui::TreePop();
+                }
+
+                // Where the stiffness comes from
+                if (ImGui::TreeNode("Contribution Heatmap and Kern"))
+                {
+                    RenderContributions(i, r);
+                    ImGui::TreePop();
+                }
+
+                // Radii of Gyration
+                if (ImGui::TreeNode("Radii of Gyration"))
+                {
+                    RequireNodes(i, SECTION_NODE_BIT(SECTION_NODE_RADII), item);
+                    ImGui::Text("Rx: %.6f %s", r.Rx * lenFactor, lenUnit);
+                    ImGui::Text("Ry: %.6f %s", r.Ry * lenFactor, lenUnit);
+                    double Rz = (r.area > 1e-10) ? sqrt(r.J_centroid / r.area) : 0;
+                    ImGui::Text("Rz: %.6f %s", Rz * lenFactor, lenUnit);
+                    ImGui::TreePop();
+                }
+
+                // Compression members made from this section
+                if (ImGui::TreeNode("Column Buckling"))
+                {
+                    RenderBuckling(i, item);
+                    ImGui::TreePop();
+                }
+
+                // Beams made from this section
+                if (ImGui::TreeNode("Lateral-Torsional Buckling"))
+                {
+                    RenderLateralBuckling(i, item);
+                    ImGui::TreePop();
+                }
+
+                // Resize the section to meet property targets
+                if (ImGui::TreeNode("Section Sizing"))
+                {
+                    RenderSizing(i, item);
+                    ImGui::TreePop();
+                }
+
+                // Properties less a corrosion or plus a coating allowance
+                if (ImGui::TreeNode("Corrosion and Coating"))
+                {
+                    RenderOffset(i, item);
+                    ImGui::TreePop();
+                }
+
+                // Section Modulus
+                if (ImGui::TreeNode("Section Modulus (Elastic)"))
+                {
+                    RequireNodes(i, SECTION_NODE_BIT(SECTION_NODE_SECTION_MODULUS), item);
+                    ImGui::Text("Sx (Ix/c): %.6f %s^3", r.Sx_min * sectionModFactor, lenUnit);
+                    ImGui::Text("Sy (Iy/c): %.6f %s^3", r.Sy_min * sectionModFactor, lenUnit);
+                    ImGui::TreePop();
+                }
+
+                // Shape descriptors for matching and classification
+                if (ImGui::TreeNode("Higher-Order Moments"))
+                {
+                    RenderShapeMoments(i, r);
+                    ImGui::TreePop();
+                }
+
+                // Library sections with the closest shape
+                if (ImGui::TreeNode("Similar Sections"))
+                {
+                    RenderSimilar(i, item);
+                    ImGui::TreePop();
+                }
+
+                // History of this section across design edits
+                if (ImGui::TreeNode("History"))
+                {
+                    RenderHistory(m_results.GetLineageKey(i));
+                    ImGui::TreePop();
+                }
+
+                ImGui::PopID();
+            }
+        }
+
+        m_renderedVersion = m_results.GetVersion();
+        m_renderedUnits = m_currentUnits;
+    }
+
+    ImGui::EndChild();
+
+    // Buttons at the bottom
+    ImGui::Spacing();
+
+    float buttonWidth = CUIFont::Scale(150.0f);
+
+    // Hide Calculate button when auto-calculate is on
+    if (!m_autoCalculate)
+    {
+        if (ImGui::Button("Calculate", ImVec2(buttonWidth, buttonHeight)))
+            actions |= PANEL_ACTION_CALCULATE;
+        ImGui::SameLine();
+    }
+    if (ImGui::Button("Copy Results", ImVec2(buttonWidth, buttonHeight)))
+        actions |= PANEL_ACTION_COPY;
+    ImGui::SameLine();
+    if (ImGui::Button("Close", ImVec2(buttonWidth, buttonHeight)))
+        actions |= PANEL_ACTION_CLOSE;
+
+    ImGui::End();
+    return actions;
+}
+
+void CAreaMomentsPanel::RequireNodes(int row, unsigned int nodeMask, SectionResultRow& view)
+{
+    if (view.result.Has(nodeMask))
+        return;
+
+    m_results.RequireNodes(row, nodeMask);
+    m_results.LoadResult(row, view.result);
+}
+
+// Blue (low) through yellow to red (high), for t in [0, 1]
+static ImU32 HeatmapColor(float t)
+{
+    t = (t < 0.0f) ? 0.0f : (t > 1.0f ? 1.0f : t);
+    float r, g, b;
+    if (t < 0.5f)
+    {
+        float s = t * 2.0f;
+        r = s; g = 0.3f + 0.6f * s; b = 1.0f - s;
+    }
+    else
+    {
+        float s = (t - 0.5f) * 2.0f;
+        r = 1.0f; g = 0.9f * (1.0f - s); b = 0.0f;
+    }
+    return ImGui::ColorConvertFloat4ToU32(ImVec4(r, g, b, 1.0f));
+}
+
+// Start a path through an interleaved x, y polygon mapped into the preview
+static void PathPolygon(ImDrawList* drawList, const std::vector<double>& polygon,
+                        double minX, double minY, double scale, float offsetX, float offsetY)
+{
+    for (size_t k = 0; k + 1 < polygon.size(); k += 2)
+        drawList->PathLineTo(ImVec2(offsetX + (float)((polygon[k] - minX) * scale),
+                                    offsetY - (float)((polygon[k + 1] - minY) * scale)));
+}
+
+void CAreaMomentsPanel::RenderContributions(int row, const ImGuiAreaMomentsResult& result)
+{
+    const CSectionPropertyGraph* graph = m_results.GetGraph(row);
+    if (graph == nullptr || !graph->HasMesh())
+    {
+        ImGui::TextDisabled("Needs a full calculation");
+        return;
+    }
+
+    // The shares come from the centroid moments kernel; the row's stored
+    // values are already current, so only the buffer is kept from this
+    ImGuiAreaMomentsResult scratch = result;
+    const SectionContributions& shares = graph->RequireContributions(scratch);
+    const std::vector<double>& v = graph->GetPreviewVertices2D();
+    const std::vector<int>& idx = graph->GetPreviewIndices();
+    int count = (int)shares.triangles.size();
+    if (count == 0)
+        return;
+
+    ImGui::RadioButton("Ix", &m_heatmapQuantity, HEATMAP_IX);
+    ImGui::SameLine();
+    ImGui::RadioButton("Iy", &m_heatmapQuantity, HEATMAP_IY);
+    ImGui::SameLine();
+    ImGui::RadioButton("J", &m_heatmapQuantity, HEATMAP_J);
+    ImGui::SameLine();
+    ImGui::Checkbox("Kern", &m_showKern);
+
+    // Bounds of the section and a uniform fit into the canvas, Y up
+    double minX = v[0], maxX = v[0], minY = v[1], maxY = v[1];
+    for (size_t k = 2; k + 1 < v.size(); k += 2)
+    {
+        minX = std::min(minX, v[k]);
+        maxX = std::max(maxX, v[k]);
+        minY = std::min(minY, v[k + 1]);
+        maxY = std::max(maxY, v[k + 1]);
+    }
+
+    float width = ImGui::GetContentRegionAvail().x;
+    float height = std::min(width * 0.6f, ImGui::GetFontSize() * 14.0f);
+    ImVec2 origin = ImGui::GetCursorScreenPos();
+    ImGui::InvisibleButton("##preview", ImVec2(width, height));
+    bool hovered = ImGui::IsItemHovered();
+
+    float margin = ImGui::GetFontSize() * 0.5f;
+    double spanX = std::max(maxX - minX, 1e-12);
+    double spanY = std::max(maxY - minY, 1e-12);
+    double scale = std::min((width - 2 * margin) / spanX, (height - 2 * margin) / spanY);
+    float offsetX = origin.x + 0.5f * (float)(width - spanX * scale);
+    float offsetY = origin.y + 0.5f * (float)(height + spanY * scale);
+
+    // Color by share per unit area, so the picture does not depend on how
+    // the face happened to be tessellated
+    std::vector<float>& density = m_heatmapDensity;
+    density.resize(count);
+    float maxDensity = 0;
+    for (int t = 0; t < count; t++)
+    {
+        const TriangleContribution& c = shares.triangles[t];
+        double share = (m_heatmapQuantity == HEATMAP_IX) ? c.Ix :
+                       (m_heatmapQuantity == HEATMAP_IY) ? c.Iy : c.Ix + c.Iy;
+
+        const double* p0 = &v[idx[t * 3] * 2];
+        const double* p1 = &v[idx[t * 3 + 1] * 2];
+        const double* p2 = &v[idx[t * 3 + 2] * 2];
+        double area = 0.5 * fabs((p1[0] - p0[0]) * (p2[1] - p0[1]) - (p2[0] - p0[0]) * (p1[1] - p0[1]));
+        density[t] = (area > 1e-30) ? (float)(share / area) : 0.0f;
+        maxDensity = std::max(maxDensity, density[t]);
+    }
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    drawList->AddRectFilled(origin, ImVec2(origin.x + width, origin.y + height), IM_COL32(30, 30, 32, 255));
+
+    // Flat triangles written straight into the vertex buffer: no
+    // anti-aliasing fringe, so three vertices per triangle
+    ImVec2 uv = ImGui::GetFontTexUvWhitePixel();
+    int hoveredTriangle = -1;
+    ImVec2 mouse = ImGui::GetIO().MousePos;
+    for (int t = 0; t < count; t++)
+    {
+        ImVec2 p[3];
+        for (int k = 0; k < 3; k++)
+        {
+            const double* q = &v[idx[t * 3 + k] * 2];
+            p[k] = ImVec2(offsetX + (float)((q[0] - minX) * scale), offsetY - (float)((q[1] - minY) * scale));
+        }
+
+        ImU32 color = HeatmapColor(maxDensity > 0 ? density[t] / maxDensity : 0.0f);
+        drawList->PrimReserve(3, 3);
+        ImDrawIdx base = (ImDrawIdx)drawList->_VtxCurrentIdx;
+        drawList->PrimWriteVtx(p[0], uv, color);
+        drawList->PrimWriteVtx(p[1], uv, color);
+        drawList->PrimWriteVtx(p[2], uv, color);
+        drawList->PrimWriteIdx(base);
+        drawList->PrimWriteIdx((ImDrawIdx)(base + 1));
+        drawList->PrimWriteIdx((ImDrawIdx)(base + 2));
+
+        if (hovered && hoveredTriangle < 0)
+        {
+            float d0 = (p[1].x - p[0].x) * (mouse.y - p[0].y) - (p[1].y - p[0].y) * (mouse.x - p[0].x);
+            float d1 = (p[2].x - p[1].x) * (mouse.y - p[1].y) - (p[2].y - p[1].y) * (mouse.x - p[1].x);
+            float d2 = (p[0].x - p[2].x) * (mouse.y - p[2].y) - (p[0].y - p[2].y) * (mouse.x - p[2].x);
+            if ((d0 >= 0 && d1 >= 0 && d2 >= 0) || (d0 <= 0 && d1 <= 0 && d2 <= 0))
+                hoveredTriangle = t;
+        }
+    }
+
+    // Hull and kern: a load inside the kern puts the whole section in compression
+    if (m_showKern)
+    {
+        const SectionKern& kern = graph->RequireKern(scratch);
+        PathPolygon(drawList, kern.hull, minX, minY, scale, offsetX, offsetY);
+        drawList->PathStroke(IM_COL32(160, 160, 160, 255), ImDrawFlags_Closed, CUIFont::Scale(1.0f));
+        PathPolygon(drawList, kern.kern, minX, minY, scale, offsetX, offsetY);
+        drawList->PathFillConvex(IM_COL32(255, 255, 255, 60));
+        PathPolygon(drawList, kern.kern, minX, minY, scale, offsetX, offsetY);
+        drawList->PathStroke(IM_COL32(255, 255, 255, 255), ImDrawFlags_Closed, CUIFont::Scale(2.0f));
+    }
+
+    // Centroid
+    ImVec2 c(offsetX + (float)((result.Cx - minX) * scale), offsetY - (float)((result.Cy - minY) * scale));
+    float arm = ImGui::GetFontSize() * 0.5f;
+    drawList->AddLine(ImVec2(c.x - arm, c.y), ImVec2(c.x + arm, c.y), IM_COL32(255, 255, 255, 255));
+    drawList->AddLine(ImVec2(c.x, c.y - arm), ImVec2(c.x, c.y + arm), IM_COL32(255, 255, 255, 255));
+
+    if (hoveredTriangle >= 0)
+    {
+        const TriangleContribution& share = shares.triangles[hoveredTriangle];
+        double J = shares.Ix + shares.Iy;
+        ImGui::SetTooltip("Triangle %d\nIx share: %.3f%%\nIy share: %.3f%%\nJ share: %.3f%%", hoveredTriangle,
+                          shares.Ix > 0 ? 100.0 * share.Ix / shares.Ix : 0.0,
+                          shares.Iy > 0 ? 100.0 * share.Iy / shares.Iy : 0.0,
+                          J > 0 ? 100.0 * (share.Ix + share.Iy) / J : 0.0);
+    }
+    ImGui::TextDisabled("Share per unit area: blue low, red high");
+    if (m_showKern)
+    {
+        const SectionKern& kern = graph->RequireKern(scratch);
+        if (kern.kern.empty())
+            ImGui::TextDisabled("Kern: none, the centroid lies on the hull");
+        else
+            ImGui::Text("Kern: %d vertices, %.6f %s^2 (%.2f%% of the section)", (int)kern.kern.size() / 2,
+                        kern.kernArea * GetAreaFactor(), GetLengthUnit(),
+                        result.area > 0 ? 100.0 * kern.kernArea / result.area : 0.0);
+    }
+}
+
+void CAreaMomentsPanel::RenderShapeMoments(int row, const ImGuiAreaMomentsResult& result)
+{
+    const CSectionPropertyGraph* graph = m_results.GetGraph(row);
+    if (graph == nullptr || !graph->HasMesh())
+    {
+        ImGui::TextDisabled("Needs a full calculation");
+        return;
+    }
+
+    ImGuiAreaMomentsResult scratch = result;
+    const SectionShapeMoments& moments = graph->RequireShapeMoments(scratch);
+    double lenFactor = GetLengthFactor();
+    const char* lenUnit = GetLengthUnit();
+
+    // mu_pq has units of length^(p+q+2)
+    for (int order = 3; order <= SHAPE_MOMENT_ORDER; order++)
+    {
+        double factor = pow(lenFactor, order + 2);
+        for (int q = 0; q <= order; q++)
+        {
+            int p = order - q;
+            ImGui::Text("mu%d%d: %.6g %s^%d", p, q, moments.central[AreaMomentIndex(p, q)] * factor,
+                        lenUnit, order + 2);
+        }
+    }
+
+    ImGui::Spacing();
+    for (int i = 0; i < 7; i++)
+        ImGui::Text("Hu %d: %.6e", i + 1, moments.hu[i]);
+
+    ImGui::Spacing();
+    for (int i = 0; i < 4; i++)
+        ImGui::Text("Affine I%d: %.6e", i + 1, moments.affine[i]);
+}
+
+void CAreaMomentsPanel::RenderBuckling(int row, SectionResultRow& view)
+{
+    RequireNodes(row, SECTION_NODE_BIT(SECTION_NODE_PRINCIPAL) | SECTION_NODE_BIT(SECTION_NODE_RADII), view);
+    const ImGuiAreaMomentsResult& r = view.result;
+    if (r.area <= 0)
+        return;
+
+    static const ImU32 s_curveColors[] =
+    {
+        IM_COL32(90, 170, 255, 255), IM_COL32(120, 220, 120, 255), IM_COL32(255, 200, 80, 255),
+        IM_COL32(255, 120, 80, 255), IM_COL32(220, 110, 230, 255)
+    };
+
+    const int materialCount = CColumnBuckling::GetMaterialCount();
+    if (ImGui::BeginCombo("Material", CColumnBuckling::GetMaterial(m_columnMaterial).name))
+    {
+        for (int m = 0; m < materialCount; m++)
+        {
+            if (ImGui::Selectable(CColumnBuckling::GetMaterial(m).name, m == m_columnMaterial))
+                m_columnMaterial = m;
+        }
+        ImGui::EndCombo();
+    }
+    ImGui::RadioButton("Weak axis", &m_columnAxis, COLUMN_AXIS_WEAK);
+    ImGui::SameLine();
+    ImGui::RadioButton("X axis", &m_columnAxis, COLUMN_AXIS_X);
+    ImGui::SameLine();
+    ImGui::RadioButton("Y axis", &m_columnAxis, COLUMN_AXIS_Y);
+
+    double lenFactor = GetLengthFactor();
+    const char* lenUnit = GetLengthUnit();
+    float maxLength = (float)(m_columnLength * lenFactor);
+    if (ImGui::DragFloat("Max length", &maxLength, maxLength * 0.005f, 0.0f, FLT_MAX, "%.1f"))
+        m_columnLength = std::max((float)(maxLength / lenFactor), 1.0f);
+
+    // End conditions, in the colors of their curves
+    const int endCount = std::min(CColumnBuckling::GetEndConditionCount(), (int)IM_ARRAYSIZE(s_curveColors));
+    int factorEnds[IM_ARRAYSIZE(s_curveColors)];
+    m_columnFactors.clear();
+    for (int e = 0; e < endCount; e++)
+    {
+        const ColumnEndCondition& end = CColumnBuckling::GetEndCondition(e);
+        bool selected = (m_columnEnds & (1u << e)) != 0;
+        if (e > 0)
+            ImGui::SameLine();
+        ImGui::PushStyleColor(ImGuiCol_CheckMark, s_curveColors[e]);
+        if (ImGui::Checkbox(end.name, &selected))
+            m_columnEnds ^= 1u << e;
+        ImGui::PopStyleColor();
+        if (m_columnEnds & (1u << e))
+        {
+            factorEnds[m_columnFactors.size()] = e;
+            m_columnFactors.push_back(end.K);
+        }
+    }
+
+    double radius = (m_columnAxis == COLUMN_AXIS_X) ? r.Rx :
+                    (m_columnAxis == COLUMN_AXIS_Y) ? r.Ry : sqrt(std::max(r.Ix_principal, 0.0) / r.area);
+    ImGui::Text("r = %.4f %s", radius * lenFactor, lenUnit);
+
+    // Every length x end condition in one batch
+    const int lengthCount = 256;
+    m_columnLengths.resize(lengthCount);
+    for (int l = 0; l < lengthCount; l++)
+        m_columnLengths[l] = m_columnLength * (l + 1) / lengthCount;
+    CColumnBuckling::EvaluateBatch(r.area, radius, CColumnBuckling::GetMaterial(m_columnMaterial),
+                                   m_columnLengths.data(), lengthCount, m_columnFactors.data(),
+                                   (int)m_columnFactors.size(), m_columnBatch);
+    const ColumnBucklingBatch& batch = m_columnBatch;
+
+    // Forces in kN, or kips alongside inches
+    bool kips = (m_currentUnits == IMGUI_UNITS_INCH);
+    double forceFactor = kips ? 0.2248089 : 1.0;
+    const char* forceUnit = kips ? "kip" : "kN";
+
+    float width = ImGui::GetContentRegionAvail().x;
+    float height = std::min(width * 0.6f, ImGui::GetFontSize() * 14.0f);
+    ImVec2 origin = ImGui::GetCursorScreenPos();
+    ImGui::InvisibleButton("##capacity", ImVec2(width, height));
+    bool hovered = ImGui::IsItemHovered();
+
+    float margin = ImGui::GetFontSize() * 0.5f;
+    float plotLeft = origin.x + margin, plotRight = origin.x + width - margin;
+    float plotTop = origin.y + margin, plotBottom = origin.y + height - margin;
+    double maxForce = batch.squashLoad * 1.05;
+    float scaleX = (plotRight - plotLeft) / (float)m_columnLength;
+    float scaleY = (plotBottom - plotTop) / (float)std::max(maxForce, 1e-12);
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    drawList->AddRectFilled(origin, ImVec2(origin.x + width, origin.y + height), IM_COL32(30, 30, 32, 255));
+    float squashY = plotBottom - (float)batch.squashLoad * scaleY;
+    drawList->AddLine(ImVec2(plotLeft, squashY), ImVec2(plotRight, squashY), IM_COL32(110, 110, 110, 255));
+
+    // Euler curves faint and clipped at the top, design curves solid;
+    // the design curve dims past the slenderness limit
+    for (int f = 0; f < batch.factorCount; f++)
+    {
+        ImU32 color = s_curveColors[factorEnds[f]];
+        ImU32 faint = (color & ~IM_COL32_A_MASK) | IM_COL32(0, 0, 0, 90);
+
+        for (int l = 0; l < lengthCount; l++)
+        {
+            float x = plotLeft + (float)m_columnLengths[l] * scaleX;
+            float y = plotBottom - (float)std::min(batch.EulerLoad(f, l), maxForce) * scaleY;
+            drawList->PathLineTo(ImVec2(x, y));
+        }
+        drawList->PathStroke(faint, ImDrawFlags_None, CUIFont::Scale(1.0f));
+
+        for (int l = 1; l < lengthCount; l++)
+        {
+            ImVec2 p0(plotLeft + (float)m_columnLengths[l - 1] * scaleX,
+                      plotBottom - (float)batch.DesignLoad(f, l - 1) * scaleY);
+            ImVec2 p1(plotLeft + (float)m_columnLengths[l] * scaleX,
+                      plotBottom - (float)batch.DesignLoad(f, l) * scaleY);
+            bool slender = batch.Slenderness(f, l) > CColumnBuckling::SLENDERNESS_LIMIT;
+            drawList->AddLine(p0, p1, slender ? faint : color, CUIFont::Scale(2.0f));
+        }
+    }
+
+    // Values at the length under the mouse
+    if (hovered && batch.factorCount > 0)
+    {
+        float mouseX = ImGui::GetIO().MousePos.x;
+        int l = (int)((mouseX - plotLeft) / scaleX / m_columnLength * lengthCount + 0.5f) - 1;
+        l = std::max(0, std::min(l, lengthCount - 1));
+        float x = plotLeft + (float)m_columnLengths[l] * scaleX;
+        drawList->AddLine(ImVec2(x, plotTop), ImVec2(x, plotBottom), IM_COL32(200, 200, 200, 120));
+
+        char text[512];
+        int length = snprintf(text, sizeof(text), "L = %.3f %s", m_columnLengths[l] * lenFactor, lenUnit);
+        for (int f = 0; f < batch.factorCount && length > 0 && length < (int)sizeof(text); f++)
+        {
+            length += snprintf(text + length, sizeof(text) - length, "\n%s: KL/r %.0f, Pn %.1f %s (Euler %.1f)",
+                               CColumnBuckling::GetEndCondition(factorEnds[f]).name, batch.Slenderness(f, l),
+                               batch.DesignLoad(f, l) * forceFactor, forceUnit, batch.EulerLoad(f, l) * forceFactor);
+        }
+        ImGui::SetTooltip("%s", text);
+    }
+
+    ImGui::TextDisabled("Py = %.1f %s; AISC 360 E3 nominal strength, faint past KL/r %d",
+                        batch.squashLoad * forceFactor, forceUnit, (int)CColumnBuckling::SLENDERNESS_LIMIT);
+}
+
+void CAreaMomentsPanel::RenderLateralBuckling(int row, SectionResultRow& view)
+{
+    RequireNodes(row, SECTION_NODE_BIT(SECTION_NODE_PRINCIPAL) | SECTION_NODE_BIT(SECTION_NODE_SECTION_MODULUS), view);
+    const ImGuiAreaMomentsResult& r = view.result;
+    if (r.area <= 0)
+        return;
+
+    static const char* s_curveNames[LTB_CURVE_COUNT] = { "a", "b", "c", "d" };
+    MemberCapacitySettings& settings = m_beamSettings;
+
+    if (ImGui::BeginCombo("Material", CColumnBuckling::GetMaterial(settings.material).name))
+    {
+        for (int m = 0; m < CColumnBuckling::GetMaterialCount(); m++)
+        {
+            if (ImGui::Selectable(CColumnBuckling::GetMaterial(m).name, m == settings.material))
+                settings.material = m;
+        }
+        ImGui::EndCombo();
+    }
+    ImGui::Combo("Buckling curve", &settings.curve, s_curveNames, LTB_CURVE_COUNT);
+
+    // Torsion and warping constants in display units; 0 falls back to the estimate
+    double lenFactor = GetLengthFactor();
+    const char* lenUnit = GetLengthUnit();
+    double inertiaFactor = GetInertiaFactor();
+    double warpingFactor = inertiaFactor * lenFactor * lenFactor;
+    double torsion = settings.torsionConstant * inertiaFactor;
+    double warping = settings.warpingConstant * warpingFactor;
+    char label[32];
+    snprintf(label, sizeof(label), "It (%s^4)", lenUnit);
+    if (ImGui::InputDouble(label, &torsion, 0.0, 0.0, "%.6g"))
+        settings.torsionConstant = std::max(torsion / inertiaFactor, 0.0);
+    snprintf(label, sizeof(label), "Iw (%s^6)", lenUnit);
+    if (ImGui::InputDouble(label, &warping, 0.0, 0.0, "%.6g"))
+        settings.warpingConstant = std::max(warping / warpingFactor, 0.0);
+    float maxLength = (float)(settings.maxLength * lenFactor);
+    if (ImGui::DragFloat("Max length", &maxLength, maxLength * 0.005f, 0.0f, FLT_MAX, "%.1f"))
+        settings.maxLength = std::max(maxLength / lenFactor, 1.0);
+
+    const MemberCapacityTable& table = m_beamCapacity.Require(r, settings);
+    ImGui::Text("It = %.6g %s^4%s, Iw = %.6g %s^6", table.torsionConstant * inertiaFactor, lenUnit,
+                settings.torsionConstant > 0 ? "" : " (Saint-Venant estimate)",
+                table.warpingConstant * warpingFactor, lenUnit);
+
+    // Moments in kNm, or kip-ft alongside inches
+    bool kips = (m_currentUnits == IMGUI_UNITS_INCH);
+    double momentFactor = kips ? 0.7375621 : 1.0;
+    const char* momentUnit = kips ? "kip-ft" : "kNm";
+
+    float width = ImGui::GetContentRegionAvail().x;
+    float height = std::min(width * 0.6f, ImGui::GetFontSize() * 14.0f);
+    ImVec2 origin = ImGui::GetCursorScreenPos();
+    ImGui::InvisibleButton("##beam", ImVec2(width, height));
+    bool hovered = ImGui::IsItemHovered();
+
+    float margin = ImGui::GetFontSize() * 0.5f;
+    float plotLeft = origin.x + margin, plotRight = origin.x + width - margin;
+    float plotTop = origin.y + margin, plotBottom = origin.y + height - margin;
+    double maxMoment = table.elasticMoment * 1.05;
+    float scaleX = (plotRight - plotLeft) / (float)settings.maxLength;
+    float scaleY = (plotBottom - plotTop) / (float)std::max(maxMoment, 1e-12);
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    drawList->AddRectFilled(origin, ImVec2(origin.x + width, origin.y + height), IM_COL32(30, 30, 32, 255));
+    float elasticY = plotBottom - (float)table.elasticMoment * scaleY;
+    drawList->AddLine(ImVec2(plotLeft, elasticY), ImVec2(plotRight, elasticY), IM_COL32(110, 110, 110, 255));
+
+    // One curve per end moment ratio, blue for uniform moment (psi = 1)
+    // through red for double curvature (psi = -1); Mcr faint behind
+    for (int g = 0; g < table.gradientCount; g++)
+    {
+        float t = (table.gradientCount > 1) ? (float)g / (table.gradientCount - 1) : 0.0f;
+        ImU32 color = HeatmapColor(t);
+        ImU32 faint = (color & ~IM_COL32_A_MASK) | IM_COL32(0, 0, 0, 70);
+
+        for (int l = 0; l < table.lengthCount; l++)
+            drawList->PathLineTo(ImVec2(plotLeft + (float)table.lengths[l] * scaleX,
+                                        plotBottom - (float)std::min(table.CriticalMoment(g, l), maxMoment) * scaleY));
+        drawList->PathStroke(faint, ImDrawFlags_None, CUIFont::Scale(1.0f));
+
+        for (int l = 0; l < table.lengthCount; l++)
+            drawList->PathLineTo(ImVec2(plotLeft + (float)table.lengths[l] * scaleX,
+                                        plotBottom - (float)table.DesignMoment(g, l) * scaleY));
+        drawList->PathStroke(color, ImDrawFlags_None, CUIFont::Scale((g == 0) ? 2.0f : 1.0f));
+    }
+
+    if (hovered)
+    {
+        float mouseX = ImGui::GetIO().MousePos.x;
+        int l = (int)((mouseX - plotLeft) / scaleX / settings.maxLength * table.lengthCount + 0.5f) - 1;
+        l = std::max(0, std::min(l, table.lengthCount - 1));
+        float x = plotLeft + (float)table.lengths[l] * scaleX;
+        drawList->AddLine(ImVec2(x, plotTop), ImVec2(x, plotBottom), IM_COL32(200, 200, 200, 120));
+
+        // Uniform moment, a linear gradient to zero and double curvature
+        char text[512];
+        int length = snprintf(text, sizeof(text), "Lb = %.3f %s", table.lengths[l] * lenFactor, lenUnit);
+        int shown[3] = { 0, table.gradientCount / 2, table.gradientCount - 1 };
+        for (int k = 0; k < 3 && length > 0 && length < (int)sizeof(text); k++)
+        {
+            int g = shown[k];
+            length += snprintf(text + length, sizeof(text) - length,
+                               "\npsi %.2f (C1 %.2f): Mb %.1f %s, chi %.3f, Mcr %.1f",
+                               table.ratios[g], table.factors[g], table.DesignMoment(g, l) * momentFactor,
+                               momentUnit, table.Reduction(g, l), table.CriticalMoment(g, l) * momentFactor);
+        }
+        ImGui::SetTooltip("%s", text);
+    }
+
+    ImGui::TextDisabled("Wy fy = %.1f %s; EN 1993-1-1 6.3.2.2, psi 1 (blue) to -1 (red)",
+                        table.elasticMoment * momentFactor, momentUnit);
+}
+
+void CAreaMomentsPanel::RenderSizing(int row, SectionResultRow& view)
+{
+    const CSectionPropertyGraph* graph = m_results.GetGraph(row);
+    if (graph == nullptr || !graph->HasMesh())
+    {
+        ImGui::TextDisabled("Needs a full calculation");
+        return;
+    }
+    RequireNodes(row, SECTION_NODE_BIT(SECTION_NODE_CENTROID_MOMENTS), view);
+    const ImGuiAreaMomentsResult& r = view.result;
+
+    // Each row keeps its own sides, targets and solution
+    if ((int)m_sizing.size() < m_results.GetRowCount())
+        m_sizing.resize(m_results.GetRowCount());
+    if (!m_sizing[row])
+        m_sizing[row].reset(new AreaMomentsSizingState());
+    AreaMomentsSizingState& state = *m_sizing[row];
+
+    // The sides come from the mesh boundary once per section; solving
+    // works on the polygon alone
+    uint32_t fingerprint = CSectionHistory::MakeFingerprint(r);
+    if (graph != state.graph || fingerprint != state.fingerprint)
+    {
+        state.sizer.SetBoundary(graph->RequireBoundary());
+        state.sides.assign(state.sizer.GetSideCount(), 0);
+        state.sizedLoops.clear();
+        state.hasResult = false;
+        state.graph = graph;
+        state.fingerprint = fingerprint;
+    }
+    const std::vector<SectionBoundaryLoop>& boundary = graph->RequireBoundary();
+    int sideCount = state.sizer.GetSideCount();
+    if (sideCount == 0)
+    {
+        ImGui::TextDisabled("The boundary has no straight sides");
+        return;
+    }
+
+    static const char* s_quantityNames[SIZING_QUANTITY_COUNT] = { "Area", "Ix", "Iy" };
+    double lenFactor = GetLengthFactor();
+    const char* lenUnit = GetLengthUnit();
+    double factors[SIZING_QUANTITY_COUNT] = { GetAreaFactor(), GetInertiaFactor(), GetInertiaFactor() };
+    double current[SIZING_QUANTITY_COUNT] = { r.area, r.Ix_centroid, r.Iy_centroid };
+
+    // Targets in display units; a new bound starts at the current value
+    if (ImGui::BeginTable("##targets", 3, ImGuiTableFlags_SizingStretchSame))
+    {
+        ImGui::TableSetupColumn("Property");
+        ImGui::TableSetupColumn("Minimum");
+        ImGui::TableSetupColumn("Maximum");
+        ImGui::TableHeadersRow();
+        for (int q = 0; q < SIZING_QUANTITY_COUNT; q++)
+        {
+            SectionSizingTarget& target = state.targets[q];
+            ImGui::PushID(q);
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%s (%s^%d)", s_quantityNames[q], lenUnit, (q == SIZING_AREA) ? 2 : 4);
+
+            for (int bound = 0; bound < 2; bound++)
+            {
+                bool& enabled = (bound == 0) ? target.hasMinimum : target.hasMaximum;
+                double& value = (bound == 0) ? target.minimum : target.maximum;
+                ImGui::TableNextColumn();
+                ImGui::PushID(bound);
+                if (ImGui::Checkbox("##on", &enabled) && enabled && value == 0)
+                    value = current[q];
+                ImGui::SameLine();
+                ImGui::SetNextItemWidth(-FLT_MIN);
+                double shown = value * factors[q];
+                ImGui::BeginDisabled(!enabled);
+                if (ImGui::InputDouble("##value", &shown, 0.0, 0.0, "%.6g"))
+                    value = shown / factors[q];
+                ImGui::EndDisabled();
+                ImGui::PopID();
+            }
+            ImGui::PopID();
+        }
+        ImGui::EndTable();
+    }
+
+    // Sides that may move, listed along each loop
+    int hoveredSide = -1;
+    int selectedCount = 0;
+    for (char selected : state.sides)
+        selectedCount += selected ? 1 : 0;
+    ImGui::Text("Movable sides: %d of %d", selectedCount, sideCount);
+    ImGui::SameLine();
+    if (ImGui::SmallButton("All"))
+        state.sides.assign(sideCount, 1);
+    ImGui::SameLine();
+    if (ImGui::SmallButton("None"))
+        state.sides.assign(sideCount, 0);
+
+    float rowHeight = ImGui::GetFrameHeightWithSpacing();
+    ImGui::BeginChild("##sides", ImVec2(0, rowHeight * std::min(sideCount, 6) + rowHeight * 0.25f), true);
+    for (int s = 0; s < sideCount; s++)
+    {
+        const SectionSide& side = state.sizer.GetSide(s);
+        bool selected = state.sides[s] != 0;
+        ImGui::PushID(s);
+        if (ImGui::Checkbox("##side", &selected))
+            state.sides[s] = selected ? 1 : 0;
+        bool hovered = ImGui::IsItemHovered();
+        ImGui::SameLine();
+        ImGui::Text("Side %d%s: %.4f %s, facing %.0f deg", s, side.hole ? " (hole)" : "",
+                    side.length * lenFactor, lenUnit, atan2(side.ny, side.nx) * 180.0 / 3.14159265358979323846);
+        if (hovered || ImGui::IsItemHovered())
+            hoveredSide = s;
+        ImGui::PopID();
+    }
+    ImGui::EndChild();
+
+    if (ImGui::Button("Solve"))
+    {
+        state.sizer.Solve(state.sides, state.targets, state.result);
+        state.sizer.BuildLoops(state.result.offsets, state.sizedLoops);
+        state.hasResult = true;
+    }
+
+    // Original outline in gray, the sized one in white, movable sides in
+    // orange; a side under the mouse can be clicked on or off
+    double minX = DBL_MAX, maxX = -DBL_MAX, minY = DBL_MAX, maxY = -DBL_MAX;
+    const std::vector<SectionBoundaryLoop>* outlines[2] = { &boundary, &state.sizedLoops };
+    for (const std::vector<SectionBoundaryLoop>* loops : outlines)
+    {
+        for (const SectionBoundaryLoop& loop : *loops)
+        {
+            for (size_t k = 0; k + 1 < loop.points.size(); k += 2)
+            {
+                minX = std::min(minX, loop.points[k]);
+                maxX = std::max(maxX, loop.points[k]);
+                minY = std::min(minY, loop.points[k + 1]);
+                maxY = std::max(maxY, loop.points[k + 1]);
+            }
+        }
+    }
+
+    float width = ImGui::GetContentRegionAvail().x;
+    float height = std::min(width * 0.6f, ImGui::GetFontSize() * 14.0f);
+    ImVec2 origin = ImGui::GetCursorScreenPos();
+    ImGui::InvisibleButton("##sizing", ImVec2(width, height));
+    bool previewHovered = ImGui::IsItemHovered();
+    bool clicked = ImGui::IsItemClicked();
+
+    float margin = ImGui::GetFontSize() * 0.5f;
+    double spanX = std::max(maxX - minX, 1e-12);
+    double spanY = std::max(maxY - minY, 1e-12);
+    double scale = std::min((width - 2 * margin) / spanX, (height - 2 * margin) / spanY);
+    float offsetX = origin.x + 0.5f * (float)(width - spanX * scale);
+    float offsetY = origin.y + 0.5f * (float)(height + spanY * scale);
+    auto toScreen = [&](double x, double y)
+    {
+        return ImVec2(offsetX + (float)((x - minX) * scale), offsetY - (float)((y - minY) * scale));
+    };
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    drawList->AddRectFilled(origin, ImVec2(origin.x + width, origin.y + height), IM_COL32(30, 30, 32, 255));
+    for (const SectionBoundaryLoop& loop : boundary)
+    {
+        PathPolygon(drawList, loop.points, minX, minY, scale, offsetX, offsetY);
+        drawList->PathStroke(IM_COL32(120, 120, 120, 255), ImDrawFlags_Closed, CUIFont::Scale(1.0f));
+    }
+    for (const SectionBoundaryLoop& loop : state.sizedLoops)
+    {
+        PathPolygon(drawList, loop.points, minX, minY, scale, offsetX, offsetY);
+        drawList->PathStroke(IM_COL32(255, 255, 255, 255), ImDrawFlags_Closed, CUIFont::Scale(1.5f));
+    }
+
+    // Nearest side to the mouse, within a few pixels
+    if (previewHovered)
+    {
+        ImVec2 mouse = ImGui::GetIO().MousePos;
+        float best = ImGui::GetFontSize() * 0.4f;
+        best *= best;
+        for (int s = 0; s < sideCount; s++)
+        {
+            const SectionSide& side = state.sizer.GetSide(s);
+            ImVec2 a = toScreen(side.x0, side.y0), b = toScreen(side.x1, side.y1);
+            float dx = b.x - a.x, dy = b.y - a.y;
+            float t = (dx * (mouse.x - a.x) + dy * (mouse.y - a.y)) / std::max(dx * dx + dy * dy, 1e-6f);
+            t = std::max(0.0f, std::min(t, 1.0f));
+            float ex = a.x + t * dx - mouse.x, ey = a.y + t * dy - mouse.y;
+            if (ex * ex + ey * ey < best)
+            {
+                best = ex * ex + ey * ey;
+                hoveredSide = s;
+            }
+        }
+        if (clicked && hoveredSide >= 0)
+            state.sides[hoveredSide] = state.sides[hoveredSide] ? 0 : 1;
+    }
+    for (int s = 0; s < sideCount; s++)
+    {
+        if (!state.sides[s] && s != hoveredSide)
+            continue;
+        const SectionSide& side = state.sizer.GetSide(s);
+        ImU32 color = (s == hoveredSide) ? IM_COL32(255, 255, 0, 255) : IM_COL32(255, 150, 40, 255);
+        drawList->AddLine(toScreen(side.x0, side.y0), toScreen(side.x1, side.y1), color, CUIFont::Scale(3.0f));
+    }
+    if (previewHovered && hoveredSide >= 0)
+        ImGui::SetTooltip("Side %d (click to %s)", hoveredSide, state.sides[hoveredSide] ? "fix" : "free");
+
+    if (state.hasResult)
+    {
+        const SectionSizingResult& result = state.result;
+        ImVec4 statusColor = result.converged ? ImVec4(0.4f, 1.0f, 0.4f, 1.0f) : ImVec4(1.0f, 0.5f, 0.3f, 1.0f);
+        ImGui::TextColored(statusColor, "%s", result.message);
+        ImGui::Text("%d iterations, %.3f ms", result.iterations, result.elapsedMs);
+        for (int q = 0; q < SIZING_QUANTITY_COUNT; q++)
+            ImGui::Text("%s: %.6g -> %.6g %s^%d", s_quantityNames[q], current[q] * factors[q],
+                        result.values[q] * factors[q], lenUnit, (q == SIZING_AREA) ? 2 : 4);
+        for (int s = 0; s < (int)result.offsets.size(); s++)
+        {
+            if (result.offsets[s] != 0)
+                ImGui::Text("Side %d: %+.6f %s %s", s, result.offsets[s] * lenFactor, lenUnit,
+                            result.offsets[s] > 0 ? "outward (adds material)" : "inward (removes material)");
+        }
+    }
+    ImGui::TextDisabled("Sides move parallel to themselves; corners follow");
+}
+
+void CAreaMomentsPanel::RenderOffset(int row, SectionResultRow& view)
+{
+    const CSectionPropertyGraph* graph = m_results.GetGraph(row);
+    if (graph == nullptr || !graph->HasMesh())
+    {
+        ImGui::TextDisabled("Needs a full calculation");
+        return;
+    }
+    RequireNodes(row, SECTION_NODE_BIT(SECTION_NODE_CENTROID_MOMENTS), view);
+    const ImGuiAreaMomentsResult& r = view.result;
+    const std::vector<SectionBoundaryLoop>& boundary = graph->RequireBoundary();
+
+    double lenFactor = GetLengthFactor();
+    double areaFactor = GetAreaFactor();
+    double inertiaFactor = GetInertiaFactor();
+    const char* lenUnit = GetLengthUnit();
+
+    ImGui::RadioButton("Corrosion (remove)", &m_offsetMode, OFFSET_CORROSION);
+    ImGui::SameLine();
+    ImGui::RadioButton("Coating (add)", &m_offsetMode, OFFSET_COATING);
+
+    char label[32];
+    double allowance = m_offsetAllowance * lenFactor;
+    snprintf(label, sizeof(label), "Allowance (%s)", lenUnit);
+    if (ImGui::InputDouble(label, &allowance, 0.0, 0.0, "%.6g"))
+        m_offsetAllowance = std::max(allowance / lenFactor, 0.0);
+    double maxAllowance = m_offsetMaxAllowance * lenFactor;
+    snprintf(label, sizeof(label), "Batch up to (%s)", lenUnit);
+    if (ImGui::InputDouble(label, &maxAllowance, 0.0, 0.0, "%.6g"))
+        m_offsetMaxAllowance = std::max(maxAllowance / lenFactor, 0.0);
+    ImGui::SliderInt("Batch steps", &m_offsetSteps, 2, 64, "%d", ImGuiSliderFlags_AlwaysClamp);
+
+    // Each row keeps its results; recompute only when its section or the
+    // settings change
+    if ((int)m_offsets.size() < m_results.GetRowCount())
+        m_offsets.resize(m_results.GetRowCount());
+    if (!m_offsets[row])
+        m_offsets[row].reset(new AreaMomentsOffsetState());
+    AreaMomentsOffsetState& state = *m_offsets[row];
+
+    double sign = (m_offsetMode == OFFSET_CORROSION) ? -1.0 : 1.0;
+    double key[3] = { sign * m_offsetAllowance, sign * m_offsetMaxAllowance, (double)m_offsetSteps };
+    uint32_t fingerprint = CSectionHistory::MakeFingerprint(r);
+    bool sectionChanged = (graph != state.graph || fingerprint != state.fingerprint);
+    if (sectionChanged || key[0] != state.key[0])
+    {
+        auto start = std::chrono::steady_clock::now();
+        CSectionOffset::Offset(boundary, key[0], true, state.result);
+        state.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+    if (sectionChanged || key[1] != state.key[1] || key[2] != state.key[2])
+    {
+        m_offsetDistances.resize(m_offsetSteps);
+        for (int i = 0; i < m_offsetSteps; i++)
+            m_offsetDistances[i] = key[1] * i / (m_offsetSteps - 1);
+        auto start = std::chrono::steady_clock::now();
+        CSectionOffset::OffsetBatch(boundary, m_offsetDistances.data(), m_offsetSteps, state.batch);
+        state.batchMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+    state.graph = graph;
+    state.fingerprint = fingerprint;
+    memcpy(state.key, key, sizeof(key));
+
+    // Nominal and reduced properties side by side
+    const SectionPolygonMoments& m = state.result.moments;
+    double nominal[7] = { r.area, r.Cx, r.Cy, r.Ix_centroid, r.Iy_centroid, r.Ixy_centroid, r.J_centroid };
+    double offset[7] = { m.area, m.Cx(), m.Cy(), m.IxCentroid(), m.IyCentroid(), m.IxyCentroid(),
+                         m.IxCentroid() + m.IyCentroid() };
+    static const char* s_names[7] = { "Area", "Cx", "Cy", "Ix", "Iy", "Ixy", "J (polar)" };
+    static const int s_powers[7] = { 2, 1, 1, 4, 4, 4, 4 };
+    if (ImGui::BeginTable("##offset", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+    {
+        ImGui::TableSetupColumn("Property");
+        ImGui::TableSetupColumn("Nominal");
+        ImGui::TableSetupColumn(m_offsetMode == OFFSET_CORROSION ? "Corroded" : "Coated");
+        ImGui::TableSetupColumn("Change");
+        ImGui::TableHeadersRow();
+        for (int k = 0; k < 7; k++)
+        {
+            double factor = (s_powers[k] == 1) ? lenFactor : (s_powers[k] == 2) ? areaFactor : inertiaFactor;
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%s (%s^%d)", s_names[k], lenUnit, s_powers[k]);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.6g", nominal[k] * factor);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.6g", offset[k] * factor);
+            ImGui::TableNextColumn();
+            if (s_powers[k] == 1)
+                ImGui::Text("%+.4g %s", (offset[k] - nominal[k]) * factor, lenUnit);
+            else if (nominal[k] != 0)
+                ImGui::Text("%+.2f%%", 100.0 * (offset[k] - nominal[k]) / fabs(nominal[k]));
+        }
+        ImGui::EndTable();
+    }
+    if (m.area <= 0)
+        ImGui::TextColored(ImVec4(1.0f, 0.5f, 0.3f, 1.0f), "The allowance consumes the whole section");
+
+    // Nominal outline in gray, offset boundary in white
+    double minX = DBL_MAX, maxX = -DBL_MAX, minY = DBL_MAX, maxY = -DBL_MAX;
+    for (const SectionBoundaryLoop& loop : boundary)
+    {
+        for (size_t k = 0; k + 1 < loop.points.size(); k += 2)
+        {
+            minX = std::min(minX, loop.points[k]);
+            maxX = std::max(maxX, loop.points[k]);
+            minY = std::min(minY, loop.points[k + 1]);
+            maxY = std::max(maxY, loop.points[k + 1]);
+        }
+    }
+    const std::vector<double>& edges = state.result.edges;
+    for (size_t k = 0; k + 1 < edges.size(); k += 2)
+    {
+        minX = std::min(minX, edges[k]);
+        maxX = std::max(maxX, edges[k]);
+        minY = std::min(minY, edges[k + 1]);
+        maxY = std::max(maxY, edges[k + 1]);
+    }
+
+    float width = ImGui::GetContentRegionAvail().x;
+    float height = std::min(width * 0.6f, ImGui::GetFontSize() * 14.0f);
+    ImVec2 origin = ImGui::GetCursorScreenPos();
+    ImGui::InvisibleButton("##offsetPreview", ImVec2(width, height));
+
+    float margin = ImGui::GetFontSize() * 0.5f;
+    double spanX = std::max(maxX - minX, 1e-12);
+    double spanY = std::max(maxY - minY, 1e-12);
+    double scale = std::min((width - 2 * margin) / spanX, (height - 2 * margin) / spanY);
+    float offsetX = origin.x + 0.5f * (float)(width - spanX * scale);
+    float offsetY = origin.y + 0.5f * (float)(height + spanY * scale);
+
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    drawList->AddRectFilled(origin, ImVec2(origin.x + width, origin.y + height), IM_COL32(30, 30, 32, 255));
+    for (const SectionBoundaryLoop& loop : boundary)
+    {
+        PathPolygon(drawList, loop.points, minX, minY, scale, offsetX, offsetY);
+        drawList->PathStroke(IM_COL32(120, 120, 120, 255), ImDrawFlags_Closed, CUIFont::Scale(1.0f));
+    }
+    for (size_t k = 0; k + 3 < edges.size(); k += 4)
+    {
+        ImVec2 a(offsetX + (float)((edges[k] - minX) * scale), offsetY - (float)((edges[k + 1] - minY) * scale));
+        ImVec2 b(offsetX + (float)((edges[k + 2] - minX) * scale), offsetY - (float)((edges[k + 3] - minY) * scale));
+        drawList->AddLine(a, b, IM_COL32(255, 255, 255, 255), CUIFont::Scale(1.5f));
+    }
+    ImGui::TextDisabled("%d boundary edges, %.3f ms", (int)edges.size() / 4, state.ms);
+
+    // The same properties over a range of allowances
+    if (ImGui::BeginTable("##offsetBatch", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY,
+                          ImVec2(0, ImGui::GetTextLineHeightWithSpacing() * 8)))
+    {
+        char header[32];
+        ImGui::TableSetupScrollFreeze(0, 1);
+        snprintf(header, sizeof(header), "Allowance (%s)", lenUnit);
+        ImGui::TableSetupColumn(header);
+        snprintf(header, sizeof(header), "Area (%s^2)", lenUnit);
+        ImGui::TableSetupColumn(header);
+        snprintf(header, sizeof(header), "Ix (%s^4)", lenUnit);
+        ImGui::TableSetupColumn(header);
+        snprintf(header, sizeof(header), "Iy (%s^4)", lenUnit);
+        ImGui::TableSetupColumn(header);
+        ImGui::TableSetupColumn("Area %");
+        ImGui::TableSetupColumn("Ix %");
+        ImGui::TableSetupColumn("Iy %");
+        ImGui::TableHeadersRow();
+        for (const SectionOffsetResult& result : state.batch)
+        {
+            const SectionPolygonMoments& b = result.moments;
+            double values[3] = { b.area, b.IxCentroid(), b.IyCentroid() };
+            double reference[3] = { r.area, r.Ix_centroid, r.Iy_centroid };
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%.4g", fabs(result.distance) * lenFactor);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.6g", values[0] * areaFactor);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.6g", values[1] * inertiaFactor);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.6g", values[2] * inertiaFactor);
+            for (int k = 0; k < 3; k++)
+            {
+                ImGui::TableNextColumn();
+                ImGui::Text("%.2f", reference[k] != 0 ? 100.0 * values[k] / reference[k] : 0.0);
+            }
+        }
+        ImGui::EndTable();
+    }
+    ImGui::TextDisabled("%d allowances in %.3f ms; %% of nominal", (int)state.batch.size(), state.batchMs);
+}
+
+void CAreaMomentsPanel::RenderSimilar(int row, SectionResultRow& view)
+{
+    const CSectionPropertyGraph* graph = m_results.GetGraph(row);
+    if (graph == nullptr || !graph->HasMesh())
+    {
+        ImGui::TextDisabled("Needs a full calculation");
+        return;
+    }
+    if (m_library.GetCount() == 0)
+    {
+        ImGui::TextDisabled("The library is empty");
+        return;
+    }
+
+    RequireNodes(row, SECTION_NODE_BIT(SECTION_NODE_PRINCIPAL), view);
+    ImGuiAreaMomentsResult scratch = view.result;
+    float features[CSectionLibrary::FEATURE_COUNT];
+    CSectionLibrary::BuildFeatures(scratch, graph->RequireShapeMoments(scratch), features);
+    m_library.Query(features, 5, m_similar);
+
+    double areaFactor = GetAreaFactor();
+    const char* lenUnit = GetLengthUnit();
+    for (const SectionLibraryMatch& match : m_similar)
+    {
+        const SectionLibraryRecord& record = m_library.GetRecord(match.record);
+        if (match.distance < 1e-4f)
+            ImGui::Text("%s (%s): this section", record.name, record.faceType);
+        else
+            ImGui::Text("%s (%s): A = %.4f %s^2, distance %.3f", record.name, record.faceType,
+                        record.area * areaFactor, lenUnit, match.distance);
+    }
+    ImGui::TextDisabled("%d sections in the library", m_library.GetCount());
+}
+
+void CAreaMomentsPanel::RenderHistory(uint64_t lineageKey)
+{
+    ImGui::Checkbox("Keep history between sessions", &m_persistHistory);
+
+    const SectionHistoryLineage* lineage = m_history.Find(lineageKey);
+    if (lineage == nullptr || lineage->count == 0)
+    {
+        ImGui::TextDisabled("No history for this section yet.");
+        return;
+    }
+
+    double lenFactor = GetLengthFactor();
+    double inertiaFactor = GetInertiaFactor();
+    double sectionModFactor = lenFactor * lenFactor * lenFactor;
+    const char* lenUnit = GetLengthUnit();
+
+    // Oldest to newest for the sparklines
+    float ixValues[SECTION_HISTORY_DEPTH];
+    float sxValues[SECTION_HISTORY_DEPTH];
+    for (int k = 0; k < lineage->count; k++)
+    {
+        const SectionHistoryEntry& e = CSectionHistory::GetEntry(*lineage, lineage->count - 1 - k);
+        ixValues[k] = (float)(e.Ix * inertiaFactor);
+        sxValues[k] = (float)(e.Sx * sectionModFactor);
+    }
+
+    const SectionHistoryEntry& latest = CSectionHistory::GetEntry(*lineage, 0);
+    ImGui::Text("%d design state(s) recorded", lineage->count);
+
+    char overlay[64];
+    ImVec2 plotSize(0, CUIFont::Scale(60));
+    snprintf(overlay, sizeof(overlay), "Ix %.4g %s^4", latest.Ix * inertiaFactor, lenUnit);
+    ImGui::PlotLines("##IxHistory", ixValues, lineage->count, 0, overlay, FLT_MAX, FLT_MAX, plotSize);
+    snprintf(overlay, sizeof(overlay), "Sx %.4g %s^3", latest.Sx * sectionModFactor, lenUnit);
+    ImGui::PlotLines("##SxHistory", sxValues, lineage->count, 0, overlay, FLT_MAX, FLT_MAX, plotSize);
+
+    if (lineage->count >= 2)
+    {
+        const SectionHistoryEntry& previous = CSectionHistory::GetEntry(*lineage, 1);
+        double dIx = (double)latest.Ix - previous.Ix;
+        double dSx = (double)latest.Sx - previous.Sx;
+        ImGui::Text("Ix change: %+.6f %s^4 (%+.2f%%)", dIx * inertiaFactor, lenUnit,
+                    previous.Ix != 0 ? 100.0 * dIx / fabs(previous.Ix) : 0.0);
+        ImGui::Text("Sx change: %+.6f %s^3 (%+.2f%%)", dSx * sectionModFactor, lenUnit,
+                    previous.Sx != 0 ? 100.0 * dSx / fabs(previous.Sx) : 0.0);
+    }
+}
+
+void CAreaMomentsPanel::RenderCustomColumns()
+{
+    if (!ImGui::TreeNode("Custom Columns"))
+        return;
+
+    const char* lenUnit = GetLengthUnit();
+    for (int c = 0; c < m_customColumns.GetCount(); c++)
+    {
+        const SectionCustomColumn& column = m_customColumns.GetColumn(c);
+        ImGui::PushID(c);
+        if (ImGui::SmallButton("x"))
+        {
+            m_customColumns.Remove(c);
+            ImGui::PopID();
+            break;
+        }
+        ImGui::SameLine();
+        ImGui::Text("%s = %s", column.name.c_str(), column.expression.c_str());
+        ImGui::SameLine();
+        if (!column.error.empty())
+            ImGui::TextColored(ImVec4(1.0f, 0.5f, 0.3f, 1.0f), "(%s)", column.error.c_str());
+        else if (column.program.GetLengthPower() != 0)
+            ImGui::TextDisabled("(%s^%d)", lenUnit, column.program.GetLengthPower());
+        ImGui::PopID();
+    }
+
+    // New column
+    ImGui::SetNextItemWidth(CUIFont::Scale(120));
+    ImGui::InputTextWithHint("##ColumnName", "name", m_newColumnName, sizeof(m_newColumnName));
+    ImGui::SameLine();
+    ImGui::TextUnformatted("=");
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(CUIFont::Scale(360));
+    bool enter = ImGui::InputTextWithHint("##ColumnExpression", "e.g. A / cm^2 * 0.785", m_newColumnExpression,
+                                          sizeof(m_newColumnExpression), ImGuiInputTextFlags_EnterReturnsTrue);
+    ImGui::SameLine();
+    if ((ImGui::Button("Add Column") || enter) && m_newColumnExpression[0] != '\0')
+    {
+        if (m_customColumns.Add(m_newColumnName, m_newColumnExpression, m_newColumnError) &&
+            m_newColumnError.empty())
+        {
+            m_newColumnName[0] = '\0';
+            m_newColumnExpression[0] = '\0';
+        }
+    }
+    if (!m_newColumnError.empty())
+        ImGui::TextColored(ImVec4(1.0f, 0.5f, 0.3f, 1.0f), "%s", m_newColumnError.c_str());
+
+    // Values are in cm; dividing by a unit gives a plain number
+    std::string names;
+    for (int c = 0; c < RESULT_COL_COUNT; c++)
+    {
+        names += (c > 0) ? ", " : "";
+        names += CSectionResultStore::GetColumnInfo(c).identifier;
+    }
+    ImGui::TextDisabled("Results: %s", names.c_str());
+    ImGui::TextDisabled("Units: mm cm m in ft. Functions: sqrt abs exp log log10 floor ceil min max pow.");
+    ImGui::TextDisabled("Operators: + - * / ^ < <= > >= == != && || ! ?:");
+
+    ImGui::TreePop();
+}
+
+void CAreaMomentsPanel::AppendCustomColumnsText(int row, std::string& text)
+{
+    std::string lines;
+    const char* lenUnit = GetLengthUnit();
+    double lenFactor = GetLengthFactor();
+    for (int c = 0; c < m_customColumns.GetCount(); c++)
+    {
+        const SectionCustomColumn& column = m_customColumns.GetColumn(c);
+        double value = column.values[row];
+        if (value != value)
+            continue;
+
+        char buf[256];
+        int power = column.program.GetLengthPower();
+        value *= pow(lenFactor, power);
+        if (power == 0)
+            snprintf(buf, sizeof(buf), "  %s: %.6f\n", column.name.c_str(), value);
+        else if (power == 1)
+            snprintf(buf, sizeof(buf), "  %s: %.6f %s\n", column.name.c_str(), value, lenUnit);
+        else
+            snprintf(buf, sizeof(buf), "  %s: %.6f %s^%d\n", column.name.c_str(), value, lenUnit, power);
+        lines += buf;
+    }
+
+    if (!lines.empty())
+        text += "Custom Columns:\n" + lines + "\n";
+}
+
+unsigned int CAreaMomentsPanel::RenderPerformance()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    UIAllocatorStats stats = CUIAllocator::GetStats();
+
+    ImGui::Text("Frame: %.2f ms (%.0f FPS)", io.Framerate > 0 ? 1000.0f / io.Framerate : 0.0f, io.Framerate);
+    ImGui::Text("Vertices: %d, indices: %d", io.MetricsRenderVertices, io.MetricsRenderIndices);
+    ImGui::Spacing();
+
+    ImGui::Text("UI allocations last frame: %u (%u freed, %u from the heap)",
+                stats.frameAllocs, stats.frameFrees, stats.frameHeapAllocs);
+    ImGui::Text("UI memory: %.1f KB live, %.1f KB peak, %.1f KB reserved",
+                stats.liveBytes / 1024.0, stats.peakBytes / 1024.0, stats.reservedBytes / 1024.0);
+    ImGui::Text("UI allocations total: %llu (%llu from the heap)",
+                (unsigned long long)stats.totalAllocs, (unsigned long long)stats.heapAllocs);
+    ImGui::Spacing();
+
+    ImGui::Text("Results: %d rows, %.1f KB", m_results.GetRowCount(), m_results.GetMemoryBytes() / 1024.0);
+
+    // Stored meshes against the tessellations they came from
+    int storedTriangles = 0, capturedTriangles = 0, simplifiedRows = 0;
+    size_t meshBytes = 0;
+    for (int row = 0; row < m_results.GetRowCount(); row++)
+    {
+        const CSectionPropertyGraph* graph = m_results.GetGraph(row);
+        if (graph == nullptr || !graph->HasMesh())
+            continue;
+        int triangles = graph->GetTriangleCount();
+        const MeshSimplifyStats& simplify = graph->GetSimplifyStats();
+        storedTriangles += triangles;
+        capturedTriangles += simplify.inputTriangles > 0 ? simplify.inputTriangles : triangles;
+        simplifiedRows += simplify.inputTriangles > 0 ? 1 : 0;
+        meshBytes += graph->GetMeshBytes();
+    }
+    ImGui::Text("Meshes: %d triangles of %d captured (%d simplified), %.1f KB", storedTriangles,
+                capturedTriangles, simplifiedRows, meshBytes / 1024.0);
+    ImGui::Text("History: %.1f KB", m_history.GetMemoryBytes() / 1024.0);
+    ImGui::Text("Earlier runs: %d results, %.1f KB", m_table.GetArchivedRowCount(),
+                m_table.GetArchiveBytes() / 1024.0);
+    ImGui::Text("Library: %d sections, %.1f KB", m_library.GetCount(), m_library.GetMemoryBytes() / 1024.0);
+    ImGui::Text("Tessellations: %d in memory (%.1f KB), %d spilled (%.1f KB)", m_tessellation.GetCount(),
+                m_tessellation.GetMemoryBytes() / 1024.0, m_tessellation.GetSpilledCount(),
+                m_tessellation.GetSpillBytes() / 1024.0);
+    ImGui::Text("Tessellation lookups: %llu hits (%llu from disk), %llu misses",
+                (unsigned long long)(m_tessellation.GetHits() + m_tessellation.GetSpillHits()),
+                (unsigned long long)m_tessellation.GetSpillHits(), (unsigned long long)m_tessellation.GetMisses());
+    ImGui::SetNextItemWidth(CUIFont::Scale(200));
+    if (ImGui::SliderInt("Tessellation cache (MB, 0 = off)", &m_tessellationBudgetMB, 0, 1024, "%d",
+                         ImGuiSliderFlags_AlwaysClamp))
+    {
+        size_t budget = (size_t)m_tessellationBudgetMB << 20;
+        m_tessellation.SetBudget(budget, budget * CTessellationCache::SPILL_BUDGET_FACTOR);
+    }
+
+    // Counters are shared by every instance using the cache file
+    const ResultCacheHeader* resultCache = m_resultCache.GetHeader();
+    if (resultCache != nullptr)
+    {
+        ImGui::Text("Shared results: %llu of %llu slots%s, %llu evicted",
+                    (unsigned long long)resultCache->occupied.load(), (unsigned long long)resultCache->slotCount,
+                    m_resultCache.IsWritable() ? "" : " (read-only)", (unsigned long long)resultCache->evictions.load());
+        ImGui::Text("Shared result lookups: %llu hits of %llu", (unsigned long long)resultCache->hits.load(),
+                    (unsigned long long)resultCache->lookups.load());
+    }
+    else
+        ImGui::TextDisabled("Shared results: not available");
+    ImGui::Text("Beam tables: %d cached, %.1f KB, %llu hits, %llu misses", m_beamCapacity.GetCount(),
+                m_beamCapacity.GetMemoryBytes() / 1024.0, (unsigned long long)m_beamCapacity.GetHits(),
+                (unsigned long long)m_beamCapacity.GetMisses());
+    ImGui::Spacing();
+
+    const char* metricsName = CSharedMetrics::GetName();
+    ImGui::Text("Metrics: %s", metricsName[0] ? metricsName : "not published");
+
+    // Also written when the window closes
+    unsigned int actions = PANEL_ACTION_NONE;
+    if (ImGui::Button("Save Event Log"))
+        actions |= PANEL_ACTION_SAVE_LOG;
+    ImGui::SameLine();
+    ImGui::TextDisabled("events.bin, decoded by tools/EventLogDump");
+    return actions;
+}
+
+double CAreaMomentsPanel::GetLengthFactor() const
+{
+    switch (m_currentUnits)
+    {
+    case IMGUI_UNITS_MM:   return CM_TO_MM;
+    case IMGUI_UNITS_INCH: return CM_TO_INCH;
+    default:               return 1.0;
+    }
+}
+
+double CAreaMomentsPanel::GetAreaFactor() const
+{
+    double len = GetLengthFactor();
+    return len * len;
+}
+
+double CAreaMomentsPanel::GetInertiaFactor() const
+{
+    double len = GetLengthFactor();
+    return len * len * len * len;
+}
+
+const char* CAreaMomentsPanel::GetLengthUnit() const
+{
+    switch (m_currentUnits)
+    {
+    case IMGUI_UNITS_MM:   return "mm";
+    case IMGUI_UNITS_INCH: return "in";
+    default:               return "cm";
+    }
+}
+
+bool CAreaMomentsPanel::HasChangedSinceRender()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_results.GetVersion() != m_renderedVersion || m_currentUnits != m_renderedUnits;
+}
+
+void CAreaMomentsPanel::BuildResultsText(std::string& text)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    text.clear();
+    text += "Area Moments of Inertia Results\n";
+    text += "================================\n\n";
+
+    double lenFactor = GetLengthFactor();
+    double areaFactor = GetAreaFactor();
+    double inertiaFactor = GetInertiaFactor();
+    double sectionModFactor = lenFactor * lenFactor * lenFactor;
+    const char* lenUnit = GetLengthUnit();
+
+    SectionResultRow item;
+    const auto& r = item.result;
+
+    // Custom columns evaluate before the loop reads the rows, since they
+    // may evaluate graph nodes themselves
+    m_customColumns.Update(m_results);
+
+    for (int i = 0; i < m_results.GetRowCount(); i++)
+    {
+        if (!m_results.HasResult(i))
+            continue;
+
+        // The export lists every property, so evaluate whatever is still pending
+        m_results.ReadRow(i, item);
+        RequireNodes(i, SECTION_NODES_ALL, item);
+
+        text += item.name;
+        text += "\n";
+        text += std::string(strlen(item.name), '-') + "\n\n";
+
+        // Basic Properties
+        text += "Basic Properties:\n";
+        char buf[256];
+        snprintf(buf, sizeof(buf), "  Area: %.6f %s^2\n", r.area * areaFactor, lenUnit);
+        text += buf;
+        snprintf(buf, sizeof(buf), "  Centroid: (%.6f, %.6f) %s\n\n", r.Cx * lenFactor, r.Cy * lenFactor, lenUnit);
+        text += buf;
+
+        if (item.quick)
+        {
+            AppendCustomColumnsText(i, text);
+            continue;
+        }
+
+        // First Moments
+        double Qx = r.area * r.Cy;
+        double Qy = r.area * r.Cx;
+        text += "First Moments:\n";
+        snprintf(buf, sizeof(buf), "  Qx: %.6f %s^3\n", Qx * sectionModFactor, lenUnit);
+        text += buf;
+        snprintf(buf, sizeof(buf), "  Qy: %.6f %s^3\n\n", Qy * sectionModFactor, lenUnit);
+        text += buf;
+
+        // Second Moments about Origin
+        text += "Second Moments (about Origin):\n";
+        snprintf(buf, sizeof(buf), "  Ixx: %.6f %s^4\n", r.Ixx_origin * inertiaFactor, lenUnit);
+        text += buf;
+        snprintf(buf, sizeof(buf), "  Iyy: %.6f %s^4\n", r.Iyy_origin * inertiaFactor, lenUnit);
+        text += buf;
+        snprintf(buf, sizeof(buf), "  Izz: %.6f %s^4\n", r.J_origin * inertiaFactor, lenUnit);
+        text += buf;
+        snprintf(buf, sizeof(buf), "  Ixy: %.6f %s^4\n\n", r.Ixy_origin * inertiaFactor, lenUnit);
+        text += buf;
+
+        // Moments about Centroid
+        text += "Moments about Centroid:\n";
+        snprintf(buf, sizeof(buf), "  Ix: %.6f %s^4\n", r.Ix_centroid * inertiaFactor, lenUnit);
+        text += buf;
+        snprintf(buf, sizeof(buf), "  Iy: %.6f %s^4\n", r.Iy_centroid * inertiaFactor, lenUnit);
+        text += buf;
+        snprintf(buf, sizeof(buf), "  Iz (polar): %.6f %s^4\n", r.J_centroid * inertiaFactor, lenUnit);
+        text += buf;
+        snprintf(buf, sizeof(buf), "  Ixy: %.6f %s^4\n\n", r.Ixy_centroid * inertiaFactor, lenUnit);
+        text += buf;
+
+        // Principal Moments
+        text += "Principal Moments:\n";
+        snprintf(buf, sizeof(buf), "  I1 (min): %.6f %s^4\n", r.Ix_principal * inertiaFactor, lenUnit);
+        text += buf;
+        snprintf(buf, sizeof(buf), "  I2 (max): %.6f %s^4\n", r.Iy_principal * inertiaFactor, lenUnit);
+        text += buf;
+        snprintf(buf, sizeof(buf), "  Principal Angle: %.2f deg\n\n", r.theta_deg);
+        text += buf;
+
+        // Radii of Gyration
+        text += "Radii of Gyration:\n";
+        snprintf(buf, sizeof(buf), "  Rx: %.6f %s\n", r.Rx * lenFactor, lenUnit);
+        text += buf;
+        snprintf(buf, sizeof(buf), "  Ry: %.6f %s\n", r.Ry * lenFactor, lenUnit);
+        text += buf;
+        double Rz = (r.area > 1e-10) ? sqrt(r.J_centroid / r.area) : 0;
+        snprintf(buf, sizeof(buf), "  Rz: %.6f %s\n\n", Rz * lenFactor, lenUnit);
+        text += buf;
+
+        // Section Modulus
+        text += "Section Modulus (Elastic):\n";
+        snprintf(buf, sizeof(buf), "  Sx (Ix/c): %.6f %s^3\n", r.Sx_min * sectionModFactor, lenUnit);
+        text += buf;
+        snprintf(buf, sizeof(buf), "  Sy (Iy/c): %.6f %s^3\n", r.Sy_min * sectionModFactor, lenUnit);
+        text += buf;
+
+        text += "\n";
+        AppendCustomColumnsText(i, text);
+    }
+}
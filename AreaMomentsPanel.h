@@ -0,0 +1,232 @@
+// AreaMomentsPanel.h: Backend independent content of the Area Moments window
+//////////////////////////////////////////////////////////////////////
+
+#ifndef AREA_MOMENTS_PANEL_H
+#define AREA_MOMENTS_PANEL_H
+
+#include "SectionPropertyGraph.h"
+#include "SectionResultStore.h"
+#include "ResultComparisonTable.h"
+#include "SectionCustomColumns.h"
+#include "SectionHistory.h"
+#include "SectionLibrary.h"
+#include "ColumnBuckling.h"
+#include "MemberCapacity.h"
+#include "SectionOptimizer.h"
+#include "SectionOffset.h"
+#include "TessellationCache.h"
+#include "ResultCache.h"
+#include <string>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Unit types for display
+enum ImGuiAreaMomentsUnits
+{
+    IMGUI_UNITS_CM = 0,
+    IMGUI_UNITS_MM,
+    IMGUI_UNITS_INCH,
+    IMGUI_UNITS_COUNT
+};
+
+// Requests raised while drawing, handled by the host window after the frame
+enum AreaMomentsPanelAction
+{
+    PANEL_ACTION_NONE = 0,
+    PANEL_ACTION_CALCULATE = 0x01,
+    PANEL_ACTION_COPY = 0x02,
+    PANEL_ACTION_CLOSE = 0x04,
+    PANEL_ACTION_SAVE_LOG = 0x08
+};
+
+// Quantity colored by the contribution heatmap
+enum AreaMomentsHeatmapQuantity
+{
+    HEATMAP_IX = 0,
+    HEATMAP_IY,
+    HEATMAP_J
+};
+
+// Axis checked by the column buckling curves
+enum AreaMomentsColumnAxis
+{
+    COLUMN_AXIS_WEAK = 0,       // Minor principal axis, which governs
+    COLUMN_AXIS_X,
+    COLUMN_AXIS_Y
+};
+
+// Direction of the uniform boundary offset
+enum AreaMomentsOffsetMode
+{
+    OFFSET_CORROSION = 0,       // Material removed from every surface
+    OFFSET_COATING              // Material added to every surface
+};
+
+// Sizing state of one result row, kept while its section is unchanged
+struct AreaMomentsSizingState
+{
+    CSectionOptimizer sizer;                    // Sides of 'graph's boundary
+    const CSectionPropertyGraph* graph = nullptr;
+    uint32_t fingerprint = 0;
+    std::vector<char> sides;                    // Sides allowed to move
+    SectionSizingTarget targets[SIZING_QUANTITY_COUNT];  // cm units
+    SectionSizingResult result;
+    bool hasResult = false;
+    std::vector<SectionBoundaryLoop> sizedLoops;
+};
+
+// Corrosion and coating results of one result row, for the settings in 'key'
+struct AreaMomentsOffsetState
+{
+    const CSectionPropertyGraph* graph = nullptr;
+    uint32_t fingerprint = 0;
+    double key[3] = {};                         // Distance, range and steps computed
+    SectionOffsetResult result;
+    std::vector<SectionOffsetResult> batch;
+    double ms = 0, batchMs = 0;
+};
+
+// Result views
+enum AreaMomentsPanelView
+{
+    PANEL_VIEW_DETAILS = 0,
+    PANEL_VIEW_COMPARE,
+    PANEL_VIEW_PERFORMANCE,
+    PANEL_VIEW_COUNT
+};
+
+// Everything drawn inside the window, using only the ImGui core: the host
+// owns the platform and renderer backends and runs NewFrame/Render around
+// Render(). The results, history and UI state live here, guarded by
+// GetMutex(), so the same panel can be driven headless by the benchmark.
+class CAreaMomentsPanel
+{
+public:
+    CAreaMomentsPanel();
+
+    // Draw into the current frame, filling the display; returns PANEL_ACTION_* flags
+    unsigned int Render();
+
+    // Data (guarded by GetMutex())
+    CSectionResultStore& GetResults() { return m_results; }
+    const CSectionResultStore& GetResults() const { return m_results; }
+    CSectionHistory& GetHistory() { return m_history; }
+    CSectionLibrary& GetLibrary() { return m_library; }
+    CTessellationCache& GetTessellationCache() { return m_tessellation; }
+    CResultCache& GetResultCache() { return m_resultCache; }
+    CSectionCustomColumns& GetCustomColumns() { return m_customColumns; }
+    std::mutex& GetMutex() { return m_mutex; }
+    void ClearSelections();
+
+    // True when the data or units differ from what the last Render() showed
+    bool HasChangedSinceRender();
+
+    // Plain text report of every result, for the clipboard
+    void BuildResultsText(std::string& text);
+
+    // Options
+    bool IsAutoCalculateEnabled() const { return m_autoCalculate; }
+    void SetAutoCalculate(bool enable) { m_autoCalculate = enable; }
+    bool IsQuickModeEnabled() const { return m_quickMode; }
+    bool IsMeshSimplifyEnabled() const { return m_simplifyMeshes; }
+    bool IsHistoryPersistent() const { return m_persistHistory; }
+    void SetHistoryPersistent(bool persist) { m_persistHistory = persist; }
+
+    // Switch the result tab on the next frame (PANEL_VIEW_*)
+    void SelectView(int view) { m_requestedView = view; }
+
+private:
+    // Unit helpers
+    double GetLengthFactor() const;
+    double GetAreaFactor() const;
+    double GetInertiaFactor() const;
+    const char* GetLengthUnit() const;
+
+    // Evaluate property nodes on demand and refresh the row view (caller holds m_mutex)
+    void RequireNodes(int row, unsigned int nodeMask, SectionResultRow& view);
+
+    // Section preview colored by each triangle's share of Ix, Iy or J,
+    // with the convex hull and kern outlined
+    void RenderContributions(int row, const ImGuiAreaMomentsResult& result);
+
+    // Third and fourth order central moments and invariants
+    void RenderShapeMoments(int row, const ImGuiAreaMomentsResult& result);
+
+    // Compression capacity against length for the selected end conditions
+    void RenderBuckling(int row, SectionResultRow& view);
+
+    // Beam capacity against unbraced length for a range of moment gradients
+    void RenderLateralBuckling(int row, SectionResultRow& view);
+
+    // Offsets of chosen boundary sides that meet area and inertia targets
+    void RenderSizing(int row, SectionResultRow& view);
+
+    // Properties with a corrosion or coating allowance on every surface,
+    // for one allowance and for a range of them
+    void RenderOffset(int row, SectionResultRow& view);
+
+    // Nearest sections in the library by shape
+    void RenderSimilar(int row, SectionResultRow& view);
+
+    // Result history
+    void RenderHistory(uint64_t lineageKey);
+
+    // Definitions of the user's computed columns
+    void RenderCustomColumns();
+
+    // "Custom Columns:" block of the results text for one row
+    void AppendCustomColumnsText(int row, std::string& text);
+
+    // Frame, allocator and memory statistics; returns PANEL_ACTION_* flags
+    unsigned int RenderPerformance();
+
+    std::mutex m_mutex;
+    CSectionResultStore m_results;
+    CResultComparisonTable m_table;
+    CSectionCustomColumns m_customColumns;
+    CSectionHistory m_history;
+    CSectionLibrary m_library;
+    CTessellationCache m_tessellation;          // Face meshes by face and time stamp
+    int m_tessellationBudgetMB = CTessellationCache::DEFAULT_MEMORY_MB;
+    CResultCache m_resultCache;                 // Results shared across instances
+    std::vector<SectionLibraryMatch> m_similar;  // Scratch, reused every frame
+
+    // UI state
+    int m_currentUnits = IMGUI_UNITS_CM;
+    int m_selectedIndex = -1;
+    int m_requestedView = -1;
+    int m_activeView = PANEL_VIEW_DETAILS;
+    int m_heatmapQuantity = HEATMAP_IX;
+    bool m_showKern = true;
+    int m_columnMaterial = 2;
+    int m_columnAxis = COLUMN_AXIS_WEAK;
+    unsigned int m_columnEnds = 0x07;           // Bit per end condition
+    float m_columnLength = 1000.0f;             // Longest length plotted, cm
+    std::vector<double> m_columnLengths;        // Scratch, reused every frame
+    std::vector<double> m_columnFactors;
+    ColumnBucklingBatch m_columnBatch;
+    MemberCapacitySettings m_beamSettings;      // Lengths in cm
+    CMemberCapacity m_beamCapacity;             // Tables cached per section
+    std::vector<std::unique_ptr<AreaMomentsSizingState>> m_sizing;  // Per row, made when first opened
+    int m_offsetMode = OFFSET_CORROSION;
+    double m_offsetAllowance = 0.1;             // cm
+    double m_offsetMaxAllowance = 0.5;          // Batch range, cm
+    int m_offsetSteps = 11;
+    std::vector<std::unique_ptr<AreaMomentsOffsetState>> m_offsets;  // Per row, made when first opened
+    std::vector<double> m_offsetDistances;      // Scratch
+    char m_newColumnName[64] = {};
+    char m_newColumnExpression[512] = {};
+    std::string m_newColumnError;
+    std::vector<float> m_heatmapDensity;        // Scratch, reused every frame
+
+    // State shown by the last frame, for retained rendering
+    unsigned int m_renderedVersion = 0;
+    int m_renderedUnits = -1;
+    bool m_persistHistory = false;
+    bool m_autoCalculate = true;
+    bool m_quickMode = false;
+    bool m_simplifyMeshes = true;
+};
+
+#endif // AREA_MOMENTS_PANEL_H
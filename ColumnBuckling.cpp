@@ -0,0 +1,118 @@
+// ColumnBuckling.cpp: Batch flexural buckling checks for compression members
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "ColumnBuckling.h"
+
+#include <cmath>
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+static const ColumnMaterial s_materials[] =
+{
+    { "Steel S235", 210000.0, 235.0 },
+    { "Steel S275", 210000.0, 275.0 },
+    { "Steel S355", 210000.0, 355.0 },
+    { "Steel A36", 200000.0, 250.0 },
+    { "Steel A992", 200000.0, 345.0 },
+};
+
+static const ColumnEndCondition s_endConditions[] =
+{
+    { "Fixed-fixed", 0.65 },
+    { "Fixed-pinned", 0.80 },
+    { "Pinned-pinned", 1.00 },
+    { "Fixed-sway", 1.20 },
+    { "Fixed-free", 2.10 },
+};
+
+// MPa x cm^2 = 100 N
+static const double MPA_CM2_TO_KN = 0.1;
+
+// 0.658^x for 0 <= x <= 2.25, the only range the inelastic branch uses.
+// exp(a) with a = x ln 0.658 in [-0.942, 0] is expanded about the middle
+// of that interval; nine terms are good to 1e-8, and unlike a call to
+// exp() the polynomial vectorizes on every compiler.
+static inline double Pow0658(double x)
+{
+    const double center = -0.471;
+    const double expCenter = 0.62437757841;     // exp(-0.471)
+    double d = x * -0.41855034766 - center;     // ln 0.658
+    double sum = 1.0 / 40320;
+    sum = sum * d + 1.0 / 5040;
+    sum = sum * d + 1.0 / 720;
+    sum = sum * d + 1.0 / 120;
+    sum = sum * d + 1.0 / 24;
+    sum = sum * d + 1.0 / 6;
+    sum = sum * d + 0.5;
+    sum = sum * d + 1.0;
+    sum = sum * d + 1.0;
+    return expCenter * sum;
+}
+
+int CColumnBuckling::GetMaterialCount()
+{
+    return (int)(sizeof(s_materials) / sizeof(s_materials[0]));
+}
+
+const ColumnMaterial& CColumnBuckling::GetMaterial(int index)
+{
+    return s_materials[index];
+}
+
+int CColumnBuckling::GetEndConditionCount()
+{
+    return (int)(sizeof(s_endConditions) / sizeof(s_endConditions[0]));
+}
+
+const ColumnEndCondition& CColumnBuckling::GetEndCondition(int index)
+{
+    return s_endConditions[index];
+}
+
+void CColumnBuckling::EvaluateBatch(double area, double radius, const ColumnMaterial& material,
+                                    const double* lengths, int lengthCount,
+                                    const double* factors, int factorCount,
+                                    ColumnBucklingBatch& batch)
+{
+    // resize() keeps the capacity of earlier batches
+    size_t count = (size_t)lengthCount * factorCount;
+    batch.lengthCount = lengthCount;
+    batch.factorCount = factorCount;
+    batch.slenderness.resize(count);
+    batch.eulerLoad.resize(count);
+    batch.designLoad.resize(count);
+
+    const double pi2E = 3.14159265358979323846 * 3.14159265358979323846 * material.E;
+    const double Fy = material.Fy;
+    const double force = area * MPA_CM2_TO_KN;
+    batch.squashLoad = Fy * force;
+
+    double inverseRadius = (radius > 0) ? 1.0 / radius : 0.0;
+    for (int f = 0; f < factorCount; f++)
+    {
+        double* slenderness = &batch.slenderness[(size_t)f * lengthCount];
+        double* eulerLoad = &batch.eulerLoad[(size_t)f * lengthCount];
+        double* designLoad = &batch.designLoad[(size_t)f * lengthCount];
+        double scale = factors[f] * inverseRadius;
+
+        // Both branches of the curve are computed and blended by a 0/1
+        // weight; a select would need -fno-trapping-math for GCC to vectorize
+        for (int l = 0; l < lengthCount; l++)
+        {
+            double lambda = lengths[l] * scale;
+            double Fe = pi2E / (lambda * lambda + 1e-12);
+            double ratio = Fy / Fe;
+            double inelasticWeight = (double)(ratio <= 2.25);
+            double inelastic = Pow0658(ratio * inelasticWeight) * Fy;
+            double elastic = 0.877 * Fe;
+            slenderness[l] = lambda;
+            eulerLoad[l] = Fe * force;
+            designLoad[l] = (elastic + inelasticWeight * (inelastic - elastic)) * force;
+        }
+    }
+}
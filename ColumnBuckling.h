@@ -0,0 +1,71 @@
+// ColumnBuckling.h: Batch flexural buckling checks for compression members
+//////////////////////////////////////////////////////////////////////
+
+#ifndef COLUMN_BUCKLING_H
+#define COLUMN_BUCKLING_H
+
+#include <vector>
+
+// Structural material for the column curves
+struct ColumnMaterial
+{
+    const char* name;
+    double E;           // Young's modulus, MPa
+    double Fy;          // Yield stress, MPa
+};
+
+// Idealized end restraint and its effective length factor K
+// (AISC Commentary Table C-A-7.1, recommended design values)
+struct ColumnEndCondition
+{
+    const char* name;
+    double K;
+};
+
+// Results of one batch in structure-of-arrays form: entry
+// [f * lengthCount + l] is factor f at length l
+struct ColumnBucklingBatch
+{
+    int lengthCount = 0;
+    int factorCount = 0;
+    double squashLoad = 0;              // A Fy, kN
+    std::vector<double> slenderness;    // KL / r
+    std::vector<double> eulerLoad;      // pi^2 E A / (KL / r)^2, kN
+    std::vector<double> designLoad;     // Nominal strength Pn = Fcr A, kN
+
+    double Slenderness(int factor, int length) const { return slenderness[factor * lengthCount + length]; }
+    double EulerLoad(int factor, int length) const { return eulerLoad[factor * lengthCount + length]; }
+    double DesignLoad(int factor, int length) const { return designLoad[factor * lengthCount + length]; }
+};
+
+// Flexural buckling of a prismatic member from the section's area and a
+// radius of gyration, for every combination of length and end condition
+// at once. The design curve is AISC 360 Section E3:
+//   Fe  = pi^2 E / (KL/r)^2
+//   Fcr = 0.658^(Fy/Fe) Fy      if Fy/Fe <= 2.25 (inelastic)
+//   Fcr = 0.877 Fe              otherwise (elastic)
+// Each factor is one branch-free pass over contiguous lengths with no
+// library calls, so the compiler vectorizes it and thousands of
+// combinations take a few microseconds.
+class CColumnBuckling
+{
+public:
+    enum
+    {
+        // AISC recommends KL/r below this for compression members
+        SLENDERNESS_LIMIT = 200
+    };
+
+    static int GetMaterialCount();
+    static const ColumnMaterial& GetMaterial(int index);
+    static int GetEndConditionCount();
+    static const ColumnEndCondition& GetEndCondition(int index);
+
+    // Evaluate lengths x factors; area in cm^2, radius and lengths in cm
+    static void EvaluateBatch(double area, double radius, const ColumnMaterial& material,
+                              const double* lengths, int lengthCount,
+                              const double* factors, int factorCount,
+                              ColumnBucklingBatch& batch);
+};
+
+#endif // COLUMN_BUCKLING_H
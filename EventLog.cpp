@@ -0,0 +1,166 @@
+// EventLog.cpp: Binary ring-buffer event log for field diagnostics
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "EventLog.h"
+#include "SharedMetrics.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <mutex>
+#include <vector>
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+// One thread's records. Only the owning thread writes; head is published
+// with release order so Flush() can read concurrently.
+struct EventLogRing
+{
+    std::atomic<uint64_t> head;         // Records ever written
+    std::atomic<bool> inUse;
+    uint16_t index;
+    EventLogRecord records[CEventLog::RING_CAPACITY];
+};
+
+// Hands the ring back for reuse when its thread exits
+struct EventLogThreadSlot
+{
+    EventLogRing* ring = nullptr;
+    bool tried = false;
+
+    ~EventLogThreadSlot()
+    {
+        if (ring != nullptr)
+            ring->inUse = false;
+    }
+};
+
+static const std::chrono::steady_clock::time_point s_startTime = std::chrono::steady_clock::now();
+static const uint64_t s_startWallTime = (uint64_t)time(nullptr);
+
+// Rings are allocated on first use and kept for the life of the process
+static std::mutex s_ringMutex;
+static EventLogRing* s_rings[CEventLog::MAX_RINGS];
+static thread_local EventLogThreadSlot t_slot;
+
+static EventLogRing* AcquireRing()
+{
+    std::lock_guard<std::mutex> lock(s_ringMutex);
+    for (int i = 0; i < CEventLog::MAX_RINGS; i++)
+    {
+        if (s_rings[i] == nullptr)
+        {
+            EventLogRing* ring = new EventLogRing();
+            ring->head = 0;
+            ring->index = (uint16_t)i;
+            ring->inUse = true;
+            s_rings[i] = ring;
+            return ring;
+        }
+        if (!s_rings[i]->inUse)
+        {
+            s_rings[i]->inUse = true;
+            return s_rings[i];
+        }
+    }
+    return nullptr;
+}
+
+static FILE* OpenLogFile(const char* path)
+{
+#ifdef _MSC_VER
+    FILE* file = nullptr;
+    return (fopen_s(&file, path, "wb") == 0) ? file : nullptr;
+#else
+    return fopen(path, "wb");
+#endif
+}
+
+uint64_t CEventLog::Now()
+{
+    using namespace std::chrono;
+    return (uint64_t)duration_cast<nanoseconds>(steady_clock::now() - s_startTime).count();
+}
+
+void CEventLog::Write(uint16_t type, uint32_t arg0, uint64_t arg1, uint64_t arg2)
+{
+    uint64_t time = Now();
+    CSharedMetrics::Record(time, type, arg0, arg1, arg2);
+
+    EventLogRing* ring = t_slot.ring;
+    if (ring == nullptr)
+    {
+        // Past MAX_RINGS threads, later ones are not logged
+        if (t_slot.tried)
+            return;
+        t_slot.tried = true;
+        t_slot.ring = ring = AcquireRing();
+        if (ring == nullptr)
+            return;
+    }
+
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+    EventLogRecord& record = ring->records[head & (RING_CAPACITY - 1)];
+    record.time = time;
+    record.type = type;
+    record.thread = ring->index;
+    record.arg0 = arg0;
+    record.arg1 = arg1;
+    record.arg2 = arg2;
+    ring->head.store(head + 1, std::memory_order_release);
+}
+
+bool CEventLog::Flush(const char* path)
+{
+    std::vector<EventLogRecord> records;
+    {
+        std::lock_guard<std::mutex> lock(s_ringMutex);
+        for (int i = 0; i < MAX_RINGS && s_rings[i] != nullptr; i++)
+        {
+            EventLogRing* ring = s_rings[i];
+            uint64_t end = ring->head.load(std::memory_order_acquire);
+            uint64_t begin = (end > RING_CAPACITY) ? end - RING_CAPACITY : 0;
+
+            size_t first = records.size();
+            for (uint64_t n = begin; n < end; n++)
+                records.push_back(ring->records[n & (RING_CAPACITY - 1)]);
+
+            // Drop records the owner overwrote while they were copied
+            std::atomic_thread_fence(std::memory_order_acquire);
+            uint64_t now = ring->head.load(std::memory_order_relaxed);
+            uint64_t valid = (now >= RING_CAPACITY) ? now - RING_CAPACITY + 1 : 0;
+            if (valid > begin)
+            {
+                size_t torn = (size_t)std::min(valid - begin, end - begin);
+                records.erase(records.begin() + first, records.begin() + first + torn);
+            }
+        }
+    }
+
+    std::stable_sort(records.begin(), records.end(),
+        [](const EventLogRecord& a, const EventLogRecord& b) { return a.time < b.time; });
+
+    FILE* file = OpenLogFile(path);
+    if (file == nullptr)
+        return false;
+
+    EventLogFileHeader header;
+    header.magic = EVENT_LOG_MAGIC;
+    header.version = EVENT_LOG_VERSION;
+    header.recordSize = sizeof(EventLogRecord);
+    header.recordCount = (uint32_t)records.size();
+    header.startTime = s_startWallTime;
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    if (ok && !records.empty())
+        ok = fwrite(&records[0], sizeof(EventLogRecord), records.size(), file) == records.size();
+    fclose(file);
+    return ok;
+}
@@ -0,0 +1,123 @@
+// EventLog.h: Binary ring-buffer event log for field diagnostics
+//////////////////////////////////////////////////////////////////////
+
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+#include <cstdint>
+
+// Record types
+enum EventLogType
+{
+    EVENT_STAGE = 1,            // arg0 = EventLogStage, arg1 = duration (ns), arg2 = item count
+    EVENT_TESSELLATION,         // arg0 = row, arg1 = triangles, arg2 = facet bytes
+    EVENT_CACHE,                // arg0 = EventLogCache, arg1 = 1 hit / 0 miss, arg2 = key
+    EVENT_ERROR                 // arg0 = EventLogSite, arg1 = HRESULT or error code
+};
+
+// Timed stages
+enum EventLogStage
+{
+    STAGE_SELECTION = 1,        // Selection change ingestion
+    STAGE_CALCULATE,            // Whole calculation pass
+    STAGE_FACE,                 // One face, tessellation to stored result
+    STAGE_FACE_QUICK,           // One face in quick mode
+    STAGE_FRAME                 // One full UI frame
+};
+
+// Caches reporting hits and misses
+enum EventLogCache
+{
+    CACHE_TESSELLATION = 1,
+    CACHE_RESULT
+};
+
+// Places errors are raised from
+enum EventLogSite
+{
+    SITE_CALCULATE_FACE = 1,
+    SITE_CALCULATE_FACE_QUICK,
+    SITE_SELECTION
+};
+
+// Fixed-size record; everything is stored raw and formatted by the decoder
+struct EventLogRecord
+{
+    uint64_t time;              // Nanoseconds since the log started
+    uint16_t type;              // EventLogType
+    uint16_t thread;            // Log-local thread index
+    uint32_t arg0;
+    uint64_t arg1;
+    uint64_t arg2;
+};
+
+// File layout: header, then recordCount records in time order
+struct EventLogFileHeader
+{
+    uint32_t magic;             // EVENT_LOG_MAGIC
+    uint32_t version;
+    uint32_t recordSize;        // sizeof(EventLogRecord)
+    uint32_t recordCount;
+    uint64_t startTime;         // Wall clock at log start, seconds since the epoch
+};
+
+static const uint32_t EVENT_LOG_MAGIC = 0x4C454D41;    // "AMEL"
+static const uint32_t EVENT_LOG_VERSION = 1;
+
+// Each thread writes to its own ring of RING_CAPACITY records, so writing
+// takes no lock and does no formatting: a clock read and a 32-byte store.
+// Old records are overwritten once a ring is full. Flush() merges the rings
+// into one time-ordered file for tools/EventLogDump. Every record is also
+// counted into the shared metrics block, when one is open.
+class CEventLog
+{
+public:
+    enum
+    {
+        RING_CAPACITY = 4096,   // Records per thread (power of two)
+        MAX_RINGS = 32          // Threads logging at once; more are dropped
+    };
+
+    // Nanoseconds since the log started
+    static uint64_t Now();
+
+    static void Write(uint16_t type, uint32_t arg0, uint64_t arg1, uint64_t arg2);
+
+    static void Stage(uint32_t stage, uint64_t startTime, uint64_t count)
+    {
+        Write(EVENT_STAGE, stage, Now() - startTime, count);
+    }
+    static void Tessellation(uint32_t row, uint64_t triangles, uint64_t bytes)
+    {
+        Write(EVENT_TESSELLATION, row, triangles, bytes);
+    }
+    static void Cache(uint32_t cache, bool hit, uint64_t key)
+    {
+        Write(EVENT_CACHE, cache, hit ? 1 : 0, key);
+    }
+    static void Error(uint32_t site, uint64_t code)
+    {
+        Write(EVENT_ERROR, site, code, 0);
+    }
+
+    // Write every buffered record to 'path'; returns false on I/O errors
+    static bool Flush(const char* path);
+};
+
+// Times a scope as an EVENT_STAGE record
+class CEventLogScope
+{
+public:
+    CEventLogScope(uint32_t stage, uint64_t count = 0)
+        : m_stage(stage), m_count(count), m_start(CEventLog::Now()) {}
+    ~CEventLogScope() { CEventLog::Stage(m_stage, m_start, m_count); }
+
+    void SetCount(uint64_t count) { m_count = count; }
+
+private:
+    uint32_t m_stage;
+    uint64_t m_count;
+    uint64_t m_start;
+};
+
+#endif // EVENT_LOG_H
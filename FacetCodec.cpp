@@ -0,0 +1,501 @@
+// FacetCodec.cpp: Quantized, delta and entropy coded storage of section meshes
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "FacetCodec.h"
+#include "AreaMomentAccumulator.h"
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <unordered_map>
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+static const uint32_t FACET_CODEC_MAGIC = 0x43464D41;  // "AMFC"
+
+const double CFacetCodec::DEFAULT_TOLERANCE = 1e-7;
+
+// Quantized coordinates must stay within 31 bits
+static const double MIN_TOLERANCE = 1e-9;
+static const int64_t MAX_GRID = 0x7FFFFFFF;
+static const uint64_t MAX_DELTA = (uint64_t)MAX_GRID * 2 + 1;   // Zigzag of +/-MAX_GRID
+
+// rANS coder: 12 bit probabilities, 32 bit states kept in [RANS_LOW, 2^31),
+// renormalized a byte at a time
+static const int RANS_PROB_BITS = 12;
+static const uint32_t RANS_PROB_SCALE = 1u << RANS_PROB_BITS;
+static const uint32_t RANS_LOW = 1u << 23;
+
+//////////////////////////////////////////////////////////////////////
+// Byte stream helpers
+//////////////////////////////////////////////////////////////////////
+
+static void PutVarint(std::vector<uint8_t>& out, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back((uint8_t)(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back((uint8_t)value);
+}
+
+static uint64_t ZigZag(int64_t value)
+{
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static int64_t UnZigZag(uint64_t value)
+{
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+// Scale byte counts to frequencies summing to RANS_PROB_SCALE, keeping
+// every byte that occurs at 1 or more
+static void NormalizeFrequencies(const uint32_t counts[256], size_t total, uint32_t frequency[256])
+{
+    uint32_t sum = 0;
+    for (int s = 0; s < 256; s++)
+    {
+        frequency[s] = 0;
+        if (counts[s] == 0)
+            continue;
+        frequency[s] = std::max<uint32_t>(1, (uint32_t)((uint64_t)counts[s] * RANS_PROB_SCALE / total));
+        sum += frequency[s];
+    }
+
+    // Rounding leaves the sum a little off; settle it on the most frequent
+    while (sum != RANS_PROB_SCALE)
+    {
+        int largest = 0;
+        for (int s = 1; s < 256; s++)
+            if (frequency[s] > frequency[largest])
+                largest = s;
+
+        if (sum < RANS_PROB_SCALE)
+        {
+            frequency[largest] += RANS_PROB_SCALE - sum;
+            sum = RANS_PROB_SCALE;
+        }
+        else
+        {
+            uint32_t take = std::min(sum - RANS_PROB_SCALE, frequency[largest] - 1);
+            frequency[largest] -= take;
+            sum -= take;
+        }
+    }
+}
+
+// Code 'bytes' with the symbol table in front; returns false if that is
+// no smaller than the bytes themselves
+static bool RansEncode(const std::vector<uint8_t>& bytes, std::vector<uint8_t>& out)
+{
+    if (bytes.empty())
+        return false;
+
+    uint32_t counts[256] = {};
+    for (uint8_t b : bytes)
+        counts[b]++;
+
+    uint32_t frequency[256], start[256];
+    NormalizeFrequencies(counts, bytes.size(), frequency);
+
+    std::vector<uint8_t> table;
+    uint32_t used = 0, cumulative = 0;
+    for (int s = 0; s < 256; s++)
+    {
+        start[s] = cumulative;
+        cumulative += frequency[s];
+        if (frequency[s] != 0)
+            used++;
+    }
+    table.push_back((uint8_t)(used - 1));
+    for (int s = 0; s < 256; s++)
+    {
+        if (frequency[s] == 0)
+            continue;
+        table.push_back((uint8_t)s);
+        table.push_back((uint8_t)(frequency[s] - 1));
+        table.push_back((uint8_t)((frequency[s] - 1) >> 8));
+    }
+
+    // Symbols are coded last to first, with bytes emitted back to front,
+    // so the decoder reads both forwards. Symbol i uses state i & 1.
+    std::vector<uint8_t> reversed;
+    reversed.reserve(bytes.size() / 2 + 16);
+    uint32_t state[2] = { RANS_LOW, RANS_LOW };
+    for (size_t i = bytes.size(); i-- > 0;)
+    {
+        uint32_t& x = state[i & 1];
+        uint32_t f = frequency[bytes[i]];
+        uint32_t xMax = ((RANS_LOW >> RANS_PROB_BITS) << 8) * f;
+        while (x >= xMax)
+        {
+            reversed.push_back((uint8_t)x);
+            x >>= 8;
+        }
+        x = ((x / f) << RANS_PROB_BITS) + (x % f) + start[bytes[i]];
+
+        if (table.size() + reversed.size() >= bytes.size())
+            return false;
+    }
+    for (int k = 1; k >= 0; k--)
+        for (int shift = 24; shift >= 0; shift -= 8)
+            reversed.push_back((uint8_t)(state[k] >> shift));
+
+    if (table.size() + reversed.size() >= bytes.size())
+        return false;
+
+    out.insert(out.end(), table.begin(), table.end());
+    out.insert(out.end(), reversed.rbegin(), reversed.rend());
+    return true;
+}
+
+// Append a stream to the blob, coded if that helps; returns its size
+static uint32_t PutStream(const std::vector<uint8_t>& bytes, uint32_t rawFlag, std::vector<uint8_t>& blob,
+                          uint32_t& flags)
+{
+    size_t before = blob.size();
+    if (!RansEncode(bytes, blob))
+    {
+        blob.insert(blob.end(), bytes.begin(), bytes.end());
+        flags |= rawFlag;
+    }
+    return (uint32_t)(blob.size() - before);
+}
+
+static bool OpenStream(FacetByteStream& stream, const uint8_t* data, size_t size, uint32_t symbols, bool raw)
+{
+    stream.data = data;
+    stream.end = data + size;
+    stream.raw = raw;
+    stream.symbolCount = 0;
+    stream.symbolLimit = symbols;
+    if (raw)
+        return size == symbols;
+
+    if (size < 1)
+        return false;
+    uint32_t used = (uint32_t)*stream.data++ + 1;
+    if ((size_t)(stream.end - stream.data) < used * 3 + 8)
+        return false;
+
+    memset(stream.frequency, 0, sizeof(stream.frequency));
+    uint32_t cumulative = 0;
+    for (uint32_t k = 0; k < used; k++)
+    {
+        uint8_t s = stream.data[0];
+        uint32_t f = (uint32_t)(stream.data[1] | (stream.data[2] << 8)) + 1;
+        stream.data += 3;
+        if (stream.frequency[s] != 0 || cumulative + f > RANS_PROB_SCALE)
+            return false;
+        stream.frequency[s] = (uint16_t)f;
+        cumulative += f;
+    }
+    if (cumulative != RANS_PROB_SCALE)
+        return false;
+
+    cumulative = 0;
+    for (int s = 0; s < 256; s++)
+    {
+        stream.start[s] = (uint16_t)cumulative;
+        memset(stream.symbols + cumulative, s, stream.frequency[s]);
+        cumulative += stream.frequency[s];
+    }
+
+    for (int k = 0; k < 2; k++)
+    {
+        const uint8_t* p = stream.data;
+        stream.state[k] = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+        stream.data += 4;
+        if (stream.state[k] < RANS_LOW)
+            return false;
+    }
+    return true;
+}
+
+static inline bool GetByte(FacetByteStream& stream, uint8_t& value)
+{
+    if (stream.raw)
+    {
+        if (stream.data == stream.end)
+            return false;
+        value = *stream.data++;
+        return true;
+    }
+    if (stream.symbolCount == stream.symbolLimit)
+        return false;
+
+    uint32_t& x = stream.state[stream.symbolCount++ & 1];
+    uint32_t slot = x & (RANS_PROB_SCALE - 1);
+    uint8_t s = stream.symbols[slot];
+    x = stream.frequency[s] * (x >> RANS_PROB_BITS) + slot - stream.start[s];
+    while (x < RANS_LOW)
+    {
+        if (stream.data == stream.end)
+            return false;
+        x = (x << 8) | *stream.data++;
+    }
+    value = s;
+    return true;
+}
+
+static inline bool GetVarint(FacetByteStream& stream, uint64_t& value)
+{
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        uint8_t b;
+        if (!GetByte(stream, b))
+            return false;
+        value |= (uint64_t)(b & 0x7F) << shift;
+        if ((b & 0x80) == 0)
+            return true;
+    }
+    return false;
+}
+
+//////////////////////////////////////////////////////////////////////
+// CFacetCodec
+//////////////////////////////////////////////////////////////////////
+
+bool CFacetCodec::Encode(const std::vector<double>& vertices2D, const std::vector<int>& indices, double tolerance,
+                         std::vector<uint8_t>& blob)
+{
+    blob.clear();
+
+    int numVertices = (int)vertices2D.size() / 2;
+    int numTriangles = (int)indices.size() / 3;
+    if (numTriangles == 0 || numVertices == 0)
+        return false;
+    for (int i = 0; i < numTriangles * 3; i++)
+        if (indices[i] < 0 || indices[i] >= numVertices)
+            return false;
+
+    // Grid over the box of the vertices actually used
+    double minX = HUGE_VAL, minY = HUGE_VAL, maxX = -HUGE_VAL, maxY = -HUGE_VAL;
+    for (int i = 0; i < numTriangles * 3; i++)
+    {
+        double x = vertices2D[indices[i] * 2];
+        double y = vertices2D[indices[i] * 2 + 1];
+        minX = std::min(minX, x);
+        maxX = std::max(maxX, x);
+        minY = std::min(minY, y);
+        maxY = std::max(maxY, y);
+    }
+    double extent = std::max(maxX - minX, maxY - minY);
+    if (!(extent > 0) || !std::isfinite(extent))
+        return false;
+
+    FacetCodecHeader header = {};
+    header.magic = FACET_CODEC_MAGIC;
+    header.triangleCount = (uint32_t)numTriangles;
+    header.originX = minX;
+    header.originY = minY;
+    header.step = std::max(tolerance, MIN_TOLERANCE) * extent;
+
+    // Renumber in order of first use, welding vertices that round to the
+    // same grid point (facet data repeats every shared corner); new
+    // vertices go to the vertex stream, every corner to the index stream
+    std::vector<int> order(numVertices, -1);
+    std::unordered_map<uint64_t, int> points;
+    points.reserve(numVertices);
+    std::vector<uint8_t> vertexBytes, indexBytes;
+    vertexBytes.reserve(numVertices * 4);
+    indexBytes.reserve(numTriangles * 3);
+    int64_t lastX = 0, lastY = 0;
+    uint32_t nextVertex = 0;
+    for (int i = 0; i < numTriangles * 3; i++)
+    {
+        int v = indices[i];
+        if (order[v] < 0)
+        {
+            int64_t qx = llround((vertices2D[v * 2] - minX) / header.step);
+            int64_t qy = llround((vertices2D[v * 2 + 1] - minY) / header.step);
+            auto point = points.emplace(((uint64_t)qx << 32) | (uint64_t)qy, (int)nextVertex);
+            order[v] = point.first->second;
+            if (point.second)
+            {
+                PutVarint(vertexBytes, ZigZag(qx - lastX));
+                PutVarint(vertexBytes, ZigZag(qy - lastY));
+                lastX = qx;
+                lastY = qy;
+            }
+        }
+        PutVarint(indexBytes, nextVertex - (uint32_t)order[v]);
+        if (order[v] == (int)nextVertex)
+            nextVertex++;
+    }
+    header.vertexCount = nextVertex;
+    header.vertexBytes = (uint32_t)vertexBytes.size();
+    header.indexBytes = (uint32_t)indexBytes.size();
+
+    blob.resize(sizeof(header));
+    header.vertexStored = PutStream(vertexBytes, FACET_STREAM_VERTEX_RAW, blob, header.flags);
+    header.indexStored = PutStream(indexBytes, FACET_STREAM_INDEX_RAW, blob, header.flags);
+    memcpy(blob.data(), &header, sizeof(header));
+    return true;
+}
+
+bool CFacetCodec::ReadHeader(const uint8_t* data, size_t size, FacetCodecHeader& header)
+{
+    if (data == nullptr || size < sizeof(header))
+        return false;
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != FACET_CODEC_MAGIC || !(header.step > 0))
+        return false;
+    return (uint64_t)sizeof(header) + header.vertexStored + header.indexStored <= size;
+}
+
+bool CFacetCodec::Decode(const uint8_t* data, size_t size, std::vector<double>& vertices2D, std::vector<int>& indices)
+{
+    CFacetDecoder decoder;
+    if (!decoder.Open(data, size))
+        return false;
+
+    indices.clear();
+    indices.reserve((size_t)decoder.GetHeader().triangleCount * 3);
+    std::vector<int> chunk;
+    while (decoder.NextChunk(chunk))
+        indices.insert(indices.end(), chunk.begin(), chunk.end());
+    if (indices.size() != (size_t)decoder.GetHeader().triangleCount * 3)
+        return false;
+
+    vertices2D = decoder.GetVertices2D();
+    return true;
+}
+
+bool CFacetCodec::CalculateMoments(const uint8_t* data, size_t size, AreaMomentsResult& result)
+{
+    result = AreaMomentsResult();
+
+    CFacetDecoder decoder;
+    if (!decoder.Open(data, size))
+        return false;
+
+    // Moments about the middle of the box keep the sums well conditioned
+    const FacetCodecHeader& header = decoder.GetHeader();
+    const std::vector<double>& vertices2D = decoder.GetVertices2D();
+    double maxX = header.originX, maxY = header.originY;
+    for (size_t i = 0; i < vertices2D.size(); i += 2)
+    {
+        maxX = std::max(maxX, vertices2D[i]);
+        maxY = std::max(maxY, vertices2D[i + 1]);
+    }
+    double midX = (header.originX + maxX) / 2;
+    double midY = (header.originY + maxY) / 2;
+
+    CAreaMomentAccumulator<2> moments;
+    std::vector<int> chunk;
+    uint32_t triangles = 0;
+    while (decoder.NextChunk(chunk))
+    {
+        moments.AddMesh(vertices2D, chunk, midX, midY);
+        triangles += (uint32_t)chunk.size() / 3;
+    }
+    if (triangles != header.triangleCount)
+        return false;
+
+    // Clockwise meshes sum to negated moments
+    double signedArea = moments.Get(0, 0);
+    if (fabs(signedArea) < 1e-15)
+        return false;
+    double sign = (signedArea < 0) ? -1.0 : 1.0;
+
+    result.area = fabs(signedArea);
+    double cx = moments.Get(1, 0) / signedArea;
+    double cy = moments.Get(0, 1) / signedArea;
+    result.Cx = midX + cx;
+    result.Cy = midY + cy;
+    result.Ix = sign * moments.Get(0, 2) - result.area * cy * cy;
+    result.Iy = sign * moments.Get(2, 0) - result.area * cx * cx;
+    result.Ixy = sign * moments.Get(1, 1) - result.area * cx * cy;
+
+    CAreaMomentsCalculator::CalculatePrincipal(result);
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////
+// CFacetDecoder
+//////////////////////////////////////////////////////////////////////
+
+bool CFacetDecoder::Open(const uint8_t* data, size_t size)
+{
+    m_vertices2D.clear();
+    m_triangle = 0;
+    m_nextVertex = 0;
+
+    if (!CFacetCodec::ReadHeader(data, size, m_header))
+        return false;
+
+    const uint8_t* vertexData = data + sizeof(m_header);
+    const uint8_t* indexData = vertexData + m_header.vertexStored;
+
+    FacetByteStream vertexStream;
+    if (!OpenStream(vertexStream, vertexData, m_header.vertexStored, m_header.vertexBytes,
+                    (m_header.flags & FACET_STREAM_VERTEX_RAW) != 0))
+        return false;
+    if (!OpenStream(m_indexStream, indexData, m_header.indexStored, m_header.indexBytes,
+                    (m_header.flags & FACET_STREAM_INDEX_RAW) != 0))
+        return false;
+
+    // Every vertex takes at least two bytes, every corner one
+    if (m_header.vertexCount > m_header.vertexBytes / 2 || m_header.triangleCount > m_header.indexBytes / 3)
+        return false;
+
+    m_vertices2D.resize((size_t)m_header.vertexCount * 2);
+    int64_t qx = 0, qy = 0;
+    for (uint32_t v = 0; v < m_header.vertexCount; v++)
+    {
+        uint64_t dx, dy;
+        if (!GetVarint(vertexStream, dx) || !GetVarint(vertexStream, dy) || dx > MAX_DELTA || dy > MAX_DELTA)
+            return false;
+        qx += UnZigZag(dx);
+        qy += UnZigZag(dy);
+        if (qx < 0 || qy < 0 || qx > MAX_GRID || qy > MAX_GRID)
+            return false;
+        m_vertices2D[v * 2] = m_header.originX + qx * m_header.step;
+        m_vertices2D[v * 2 + 1] = m_header.originY + qy * m_header.step;
+    }
+    return true;
+}
+
+bool CFacetDecoder::NextChunk(std::vector<int>& indices)
+{
+    indices.clear();
+    uint32_t count = std::min<uint32_t>(m_header.triangleCount - m_triangle, CFacetCodec::CHUNK_TRIANGLES);
+    if (count == 0)
+        return false;
+
+    indices.resize(count * 3);
+    for (uint32_t i = 0; i < count * 3; i++)
+    {
+        uint64_t back;
+        if (!GetVarint(m_indexStream, back) || back > m_nextVertex)
+        {
+            indices.clear();
+            m_triangle = m_header.triangleCount;
+            return false;
+        }
+        if (back == 0)
+        {
+            if (m_nextVertex == m_header.vertexCount)
+            {
+                indices.clear();
+                m_triangle = m_header.triangleCount;
+                return false;
+            }
+            indices[i] = (int)m_nextVertex++;
+        }
+        else
+        {
+            indices[i] = (int)(m_nextVertex - back);
+        }
+    }
+    m_triangle += count;
+    return true;
+}
@@ -0,0 +1,113 @@
+// FacetCodec.h: Quantized, delta and entropy coded storage of section meshes
+//////////////////////////////////////////////////////////////////////
+
+#ifndef FACET_CODEC_H
+#define FACET_CODEC_H
+
+#include "AreaMomentsCalculator.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Blob layout: header, then the vertex stream, then the index stream. A
+// coded stream starts with its symbol frequencies.
+struct FacetCodecHeader
+{
+    uint32_t magic;             // FACET_CODEC_MAGIC
+    uint32_t vertexCount;
+    uint32_t triangleCount;
+    uint32_t flags;             // FACET_STREAM_*_RAW for streams stored as is
+    double originX, originY;    // Grid origin, the mesh's lower left corner
+    double step;                // Grid spacing
+    uint32_t vertexBytes;       // Varint bytes in each stream
+    uint32_t indexBytes;
+    uint32_t vertexStored;      // Size of each stream in the blob
+    uint32_t indexStored;
+};
+
+enum FacetCodecFlags
+{
+    FACET_STREAM_VERTEX_RAW = 1,
+    FACET_STREAM_INDEX_RAW = 2
+};
+
+// Codes an indexed 2D mesh in a fraction of its 16 bytes per vertex and
+// 12 per triangle.
+//
+// Coordinates are rounded to a grid over the mesh's bounding box, with a
+// spacing of 'tolerance' times the larger side; corners that round to the
+// same point become one vertex, so raw facet soups weld as they are coded.
+// Vertices are renumbered in order of first use, so a corner is either
+// the next new vertex or one used shortly before. Corners are stored as
+// the distance back from the next new vertex (0 for a new one) and each
+// new vertex as its zigzagged grid step from the previous one, all as
+// varints; each byte stream is then coded with a static two-way
+// interleaved rANS coder.
+//
+// The vertex stream is decoded in one pass; the index stream can then be
+// decoded CHUNK_TRIANGLES at a time, straight into the moment kernels, so
+// the triangles of a large mesh never need to be held at once.
+class CFacetCodec
+{
+public:
+    enum
+    {
+        CHUNK_TRIANGLES = 4096
+    };
+
+    // Grid spacing as a fraction of the mesh extent. Rounding moves a
+    // vertex by at most half of it, well below the displayed precision.
+    static const double DEFAULT_TOLERANCE;
+
+    // Code a mesh; returns false if it is empty, has no extent or has
+    // an index out of range. 'tolerance' is raised to at least 1e-9.
+    static bool Encode(const std::vector<double>& vertices2D, const std::vector<int>& indices, double tolerance,
+                       std::vector<uint8_t>& blob);
+
+    // Whole mesh, vertices in first use order
+    static bool Decode(const uint8_t* data, size_t size, std::vector<double>& vertices2D, std::vector<int>& indices);
+
+    // Area, centroid and second moments of a coded mesh, decoded chunk by
+    // chunk; moments are about axes through the centroid, as Calculate()
+    static bool CalculateMoments(const uint8_t* data, size_t size, AreaMomentsResult& result);
+
+    static bool ReadHeader(const uint8_t* data, size_t size, FacetCodecHeader& header);
+};
+
+// One coded byte stream being read
+struct FacetByteStream
+{
+    const uint8_t* data = nullptr;
+    const uint8_t* end = nullptr;
+    bool raw = false;
+    uint32_t state[2] = { 0, 0 };
+    uint32_t symbolCount = 0;   // Bytes decoded so far
+    uint32_t symbolLimit = 0;   // Bytes in the stream
+    uint16_t frequency[256];
+    uint16_t start[256];
+    uint8_t symbols[4096];      // Symbol of each slot
+};
+
+// Streaming decoder: Open() decodes the vertices, then NextChunk() gives
+// the triangles a chunk at a time
+class CFacetDecoder
+{
+public:
+    bool Open(const uint8_t* data, size_t size);
+
+    const FacetCodecHeader& GetHeader() const { return m_header; }
+    const std::vector<double>& GetVertices2D() const { return m_vertices2D; }
+
+    // Replace 'indices' with up to CHUNK_TRIANGLES more triangles into
+    // GetVertices2D(); false when there are none left or the data is bad
+    bool NextChunk(std::vector<int>& indices);
+
+private:
+    FacetCodecHeader m_header;
+    std::vector<double> m_vertices2D;
+    FacetByteStream m_indexStream;
+    uint32_t m_triangle = 0;
+    uint32_t m_nextVertex = 0;
+};
+
+#endif // FACET_CODEC_H
@@ -8,19 +8,37 @@
 #include "imgui/imgui.h"
 #include "imgui/imgui_impl_dx9.h"
 #include "imgui/imgui_impl_win32.h"
+#include "UIFont.h"
+#include "UIAllocator.h"
+#include "EventLog.h"
+#include "SharedMetrics.h"
 
-#include <cmath>
+#include <shlobj.h>
 
 // Forward declare message handler from imgui_impl_win32.cpp
 extern IMGUI_IMPL_API LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
 
-// Unit conversion constants
-static const double CM_TO_MM = 10.0;
-static const double CM_TO_INCH = 1.0 / 2.54;
-
 // Static window pointer for WndProc
 static ImGuiAreaMomentsWindow* g_pWindow = nullptr;
 
+// Frames still rebuilt after the last change, so hover delays, tooltips
+// and other time based ImGui state settle before the window goes idle
+static const int RETAINED_SETTLE_FRAMES = 30;
+
+// Upper bound on an idle wait; changes normally wake the thread at once
+static const DWORD RETAINED_IDLE_TIMEOUT_MS = 250;
+
+// Messages that can change what ImGui draws
+static bool IsInputMessage(UINT msg)
+{
+    return (msg >= WM_MOUSEFIRST && msg <= WM_MOUSELAST) ||
+           (msg >= WM_KEYFIRST && msg <= WM_KEYLAST) ||
+           msg == WM_MOUSELEAVE || msg == WM_NCMOUSEMOVE ||
+           msg == WM_SETFOCUS || msg == WM_KILLFOCUS ||
+           msg == WM_SETCURSOR || msg == WM_INPUTLANGCHANGE ||
+           msg == WM_DEVICECHANGE;
+}
+
 ImGuiAreaMomentsWindow::ImGuiAreaMomentsWindow()
 {
 }
@@ -38,6 +56,13 @@ bool ImGuiAreaMomentsWindow::Create(HINSTANCE hInstance)
     m_hInstance = hInstance;
     g_pWindow = this;
 
+    // Time to first frame is measured from here
+    ::QueryPerformanceCounter(&m_createTicks);
+    m_firstFrameMs = -1.0;
+
+    // Monitor scale; the window, font and every layout size use it
+    float dpiScale = GetDpiScale(nullptr);
+
     // Register window class
     m_wc = {};
     m_wc.cbSize = sizeof(m_wc);
@@ -54,7 +79,7 @@ bool ImGuiAreaMomentsWindow::Create(HINSTANCE hInstance)
         m_wc.lpszClassName,
         L"Area Moments of Inertia",
         WS_OVERLAPPEDWINDOW,
-        100, 100, 800, 1000,
+        100, 100, (int)(800 * dpiScale), (int)(1000 * dpiScale),
         nullptr, nullptr, hInstance, nullptr);
 
     if (!m_hWnd)
@@ -75,23 +100,57 @@ bool ImGuiAreaMomentsWindow::Create(HINSTANCE hInstance)
 
     // Setup Dear ImGui context
     IMGUI_CHECKVERSION();
+    CUIAllocator::Install();
     ImGui::CreateContext();
     ImGuiIO& io = ImGui::GetIO();
     io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
 
-    // Setup style
+    // Setup style, scaled for the monitor DPI
     ImGui::StyleColorsDark();
     ImGuiStyle& style = ImGui::GetStyle();
     style.WindowRounding = 5.0f;
     style.FrameRounding = 3.0f;
     style.ScrollbarRounding = 3.0f;
+    style.ScaleAllSizes(dpiScale);
+    style.FontSizeBase = UI_FONT_SIZE;
+    style.FontScaleDpi = dpiScale;
 
     // Setup Platform/Renderer backends
     ImGui_ImplWin32_Init(m_hWnd);
     ImGui_ImplDX9_Init(m_pd3dDevice);
 
-    // Load a nicer font (32pt for better readability)
-    io.Fonts->AddFontFromFileTTF("C:\\Windows\\Fonts\\segoeui.ttf", 32.0f);
+    // Embedded font; glyphs are rasterized on first use
+    CUIFont::AddToAtlas(io.Fonts, UI_FONT_SIZE);
+
+    // A history file only exists if the user asked to keep history
+    char historyPath[MAX_PATH];
+    if (GetDataFilePath("history.bin", historyPath, sizeof(historyPath)))
+        m_panel.SetHistoryPersistent(m_panel.GetHistory().Load(historyPath));
+
+    // The section library is always kept; each calculation appends to it
+    char libraryPath[MAX_PATH];
+    if (GetDataFilePath("library.bin", libraryPath, sizeof(libraryPath)))
+        m_panel.GetLibrary().Open(libraryPath);
+
+    // Tessellations past the cache budget; one file per window, deleted
+    // with the panel
+    char spillName[64], spillPath[MAX_PATH];
+    sprintf_s(spillName, sizeof(spillName), "tessellation_%lu_%p.bin", ::GetCurrentProcessId(), (void*)this);
+    if (GetDataFilePath(spillName, spillPath, sizeof(spillPath)))
+        m_panel.GetTessellationCache().OpenSpillFile(spillPath);
+
+    // Results shared by every instance on the machine
+    char resultCachePath[MAX_PATH];
+    if (GetDataFilePath("results.cache", resultCachePath, sizeof(resultCachePath), true))
+        m_panel.GetResultCache().Open(resultCachePath);
+
+    // The user's computed columns, also read by tools/SectionLibraryTool
+    char columnsPath[MAX_PATH];
+    if (GetDataFilePath("columns.txt", columnsPath, sizeof(columnsPath)))
+        m_panel.GetCustomColumns().Open(columnsPath);
+
+    m_wakeEvent = ::CreateEventW(nullptr, FALSE, FALSE, nullptr);
+    m_redrawRequested = true;
 
     m_running = true;
     m_shouldClose = false;
@@ -109,16 +168,36 @@ void ImGuiAreaMomentsWindow::Destroy()
 
     m_shouldClose = true;
     m_running = false;
+    RequestRedraw();
 
     if (m_renderThread.joinable())
         m_renderThread.join();
 
+    if (m_wakeEvent)
+    {
+        ::CloseHandle(m_wakeEvent);
+        m_wakeEvent = nullptr;
+    }
+
     ImGui_ImplDX9_Shutdown();
     ImGui_ImplWin32_Shutdown();
     ImGui::DestroyContext();
+    CUIAllocator::ReleaseUnused();
 
     CleanupDeviceD3D();
 
+    char historyPath[MAX_PATH];
+    if (GetDataFilePath("history.bin", historyPath, sizeof(historyPath)))
+    {
+        if (m_panel.IsHistoryPersistent())
+            m_panel.GetHistory().Save(historyPath);
+        else
+            ::DeleteFileA(historyPath);
+    }
+
+    // Keep the last session's events for field diagnostics
+    SaveEventLog();
+
     if (m_hWnd)
     {
         ::DestroyWindow(m_hWnd);
@@ -136,6 +215,7 @@ void ImGuiAreaMomentsWindow::Show()
         ::ShowWindow(m_hWnd, SW_SHOW);
         ::UpdateWindow(m_hWnd);
         m_visible = true;
+        RequestRedraw();
     }
 }
 
@@ -148,6 +228,13 @@ void ImGuiAreaMomentsWindow::Hide()
     }
 }
 
+void ImGuiAreaMomentsWindow::RequestRedraw()
+{
+    m_redrawRequested = true;
+    if (m_wakeEvent)
+        ::SetEvent(m_wakeEvent);
+}
+
 bool ImGuiAreaMomentsWindow::IsVisible() const
 {
     return m_visible;
@@ -160,34 +247,43 @@ bool ImGuiAreaMomentsWindow::IsRunning() const
 
 void ImGuiAreaMomentsWindow::ClearSelections()
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_selections.clear();
-    m_selectedIndex = -1;
+    m_panel.ClearSelections();
+    RequestRedraw();
 }
 
 void ImGuiAreaMomentsWindow::AddSelection(const char* name, void* pFace)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    ImGuiSelectionItem item;
-    item.name = name;
-    item.pFace = pFace;
-    item.hasResult = false;
-    m_selections.push_back(item);
+    std::lock_guard<std::mutex> lock(m_panel.GetMutex());
+    m_panel.GetResults().AddRow(name, pFace);
+    RequestRedraw();
+}
+
+void ImGuiAreaMomentsWindow::AddSelections(void* const* faces, int count)
+{
+    if (count <= 0)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_panel.GetMutex());
+        m_panel.GetResults().AddFaceRows(faces, count);
+    }
+    RequestRedraw();
 }
 
 void ImGuiAreaMomentsWindow::SetSelectionResult(int index, const ImGuiAreaMomentsResult& result)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    if (index >= 0 && index < (int)m_selections.size())
+    std::lock_guard<std::mutex> lock(m_panel.GetMutex());
+    CSectionResultStore& results = m_panel.GetResults();
+    if (index >= 0 && index < results.GetRowCount())
     {
-        m_selections[index].result = result;
-        m_selections[index].hasResult = true;
+        results.SetResult(index, result, nullptr);
     }
+    RequestRedraw();
 }
 
 int ImGuiAreaMomentsWindow::GetSelectionCount() const
 {
-    return (int)m_selections.size();
+    return m_panel.GetResults().GetRowCount();
 }
 
 void ImGuiAreaMomentsWindow::SetCloseCallback(ImGuiCloseCallback callback, void* pContext)
@@ -202,18 +298,21 @@ void ImGuiAreaMomentsWindow::SetCalculateCallback(ImGuiCalculateCallback callbac
     m_calculateContext = pContext;
 }
 
-std::vector<ImGuiSelectionItem>& ImGuiAreaMomentsWindow::GetSelections()
+CSectionResultStore& ImGuiAreaMomentsWindow::GetResults()
 {
-    return m_selections;
+    return m_panel.GetResults();
 }
 
 std::mutex& ImGuiAreaMomentsWindow::GetMutex()
 {
-    return m_mutex;
+    return m_panel.GetMutex();
 }
 
 LRESULT CALLBACK ImGuiAreaMomentsWindow::WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
+    if (g_pWindow && IsInputMessage(msg))
+        g_pWindow->RequestRedraw();
+
     if (ImGui_ImplWin32_WndProcHandler(hWnd, msg, wParam, lParam))
         return true;
 
@@ -226,9 +325,20 @@ LRESULT CALLBACK ImGuiAreaMomentsWindow::WndProc(HWND hWnd, UINT msg, WPARAM wPa
         {
             g_pWindow->m_resizeWidth = (UINT)LOWORD(lParam);
             g_pWindow->m_resizeHeight = (UINT)HIWORD(lParam);
+            g_pWindow->RequestRedraw();
         }
         return 0;
 
+    case WM_PAINT:
+        // Uncovered or invalidated: show the last frame again, no rebuild needed
+        if (g_pWindow)
+        {
+            g_pWindow->m_repaintRequested = true;
+            if (g_pWindow->m_wakeEvent)
+                ::SetEvent(g_pWindow->m_wakeEvent);
+        }
+        break;
+
     case WM_SYSCOMMAND:
         if ((wParam & 0xfff0) == SC_KEYMENU)
             return 0;
@@ -264,7 +374,7 @@ void ImGuiAreaMomentsWindow::RenderThread()
 
         if (!m_visible)
         {
-            ::Sleep(50);
+            ::WaitForSingleObject(m_wakeEvent, RETAINED_IDLE_TIMEOUT_MS);
             continue;
         }
 
@@ -288,6 +398,7 @@ void ImGuiAreaMomentsWindow::RenderThread()
                 }
             }
             m_deviceLost = false;
+            m_redrawRequested = true;
         }
 
         // Handle resize by recreating D3D device (more reliable than Reset)
@@ -302,6 +413,7 @@ void ImGuiAreaMomentsWindow::RenderThread()
             {
                 ImGui_ImplDX9_Init(m_pd3dDevice);
                 m_deviceLost = false;
+                m_redrawRequested = true;
             }
             else
             {
@@ -311,20 +423,78 @@ void ImGuiAreaMomentsWindow::RenderThread()
             }
         }
 
-        RenderFrame();
+        // Retained mode: rebuild only when something changed, re-present the
+        // previous draw data for plain repaints, otherwise sleep until woken
+        if (NeedsFullFrame())
+        {
+            RenderFrame();
+        }
+        else if (m_repaintRequested.exchange(false))
+        {
+            PresentDrawData();
+        }
+        else
+        {
+            ::WaitForSingleObject(m_wakeEvent, RETAINED_IDLE_TIMEOUT_MS);
+            continue;
+        }
         ::Sleep(16); // ~60 FPS
     }
 }
 
+bool ImGuiAreaMomentsWindow::NeedsFullFrame()
+{
+    if (m_redrawRequested.exchange(false) || m_panel.HasChangedSinceRender())
+    {
+        m_settleFrames = RETAINED_SETTLE_FRAMES;
+        return true;
+    }
+    if (m_settleFrames > 0)
+    {
+        m_settleFrames--;
+        return true;
+    }
+
+    // A focused text field keeps its caret blinking
+    return ImGui::GetIO().WantTextInput;
+}
+
 void ImGuiAreaMomentsWindow::RenderFrame()
 {
+    CEventLogScope scope(STAGE_FRAME);
+    CUIAllocator::BeginFrame();
     ImGui_ImplDX9_NewFrame();
     ImGui_ImplWin32_NewFrame();
     ImGui::NewFrame();
 
     RenderUI();
 
-    ImGui::EndFrame();
+    ImGui::Render();
+    PresentDrawData();
+
+    UIAllocatorStats stats = CUIAllocator::GetStats();
+    CSharedMetrics::SetGauge(GAUGE_UI_LIVE_BYTES, stats.liveBytes);
+    CSharedMetrics::SetGauge(GAUGE_UI_RESERVED_BYTES, stats.reservedBytes);
+
+    if (m_firstFrameMs < 0)
+    {
+        LARGE_INTEGER now, frequency;
+        ::QueryPerformanceCounter(&now);
+        ::QueryPerformanceFrequency(&frequency);
+        m_firstFrameMs = 1000.0 * (double)(now.QuadPart - m_createTicks.QuadPart) / (double)frequency.QuadPart;
+        TRACE("Area moments window: first frame after %.1f ms\n", m_firstFrameMs);
+    }
+}
+
+void ImGuiAreaMomentsWindow::PresentDrawData()
+{
+    ImDrawData* drawData = ImGui::GetDrawData();
+    if (drawData == nullptr || !drawData->Valid)
+    {
+        // Nothing retained yet (e.g. first paint before the first frame)
+        m_redrawRequested = true;
+        return;
+    }
 
     m_pd3dDevice->SetRenderState(D3DRS_ZENABLE, FALSE);
     m_pd3dDevice->SetRenderState(D3DRS_ALPHABLENDENABLE, FALSE);
@@ -335,8 +505,7 @@ void ImGuiAreaMomentsWindow::RenderFrame()
 
     if (m_pd3dDevice->BeginScene() >= 0)
     {
-        ImGui::Render();
-        ImGui_ImplDX9_RenderDrawData(ImGui::GetDrawData());
+        ImGui_ImplDX9_RenderDrawData(drawData);
         m_pd3dDevice->EndScene();
     }
 
@@ -347,218 +516,28 @@ void ImGuiAreaMomentsWindow::RenderFrame()
 
 void ImGuiAreaMomentsWindow::RenderUI()
 {
-    ImGuiIO& io = ImGui::GetIO();
-
-    // Set next window to fill the client area
-    ImGui::SetNextWindowPos(ImVec2(0, 0));
-    ImGui::SetNextWindowSize(io.DisplaySize);
-
-    ImGuiWindowFlags flags = ImGuiWindowFlags_NoTitleBar |
-                             ImGuiWindowFlags_NoResize |
-                             ImGuiWindowFlags_NoMove |
-                             ImGuiWindowFlags_NoCollapse;
-
-    ImGui::Begin("AreaMoments", nullptr, flags);
+    unsigned int actions = m_panel.Render();
 
-    // Title
-    ImGui::TextColored(ImVec4(0.4f, 0.8f, 1.0f, 1.0f), "Area Moments of Inertia");
-    ImGui::Separator();
-    ImGui::Spacing();
-
-    // Units selector - wider dropdown
-    const char* units[] = { "Centimeters (cm)", "Millimeters (mm)", "Inches (in)" };
-    ImGui::SetNextItemWidth(350);
-    ImGui::Combo("Units", &m_currentUnits, units, IM_ARRAYSIZE(units));
-    ImGui::Spacing();
-
-    // Auto-calculate toggle
-    ImGui::Checkbox("Auto-Calculate", &m_autoCalculate);
-    ImGui::Spacing();
-
-    // Selections list (hidden when auto-calculate is on)
-    if (!m_autoCalculate)
+    if (actions & PANEL_ACTION_CALCULATE)
     {
-        ImGui::Text("Selected Faces:");
-        {
-            std::lock_guard<std::mutex> lock(m_mutex);
-
-            if (m_selections.empty())
-            {
-                ImGui::TextDisabled("  No faces selected");
-            }
-            else
-            {
-                ImGui::BeginChild("SelectionsList", ImVec2(0, 120), true);
-                for (int i = 0; i < (int)m_selections.size(); i++)
-                {
-                    bool isSelected = (m_selectedIndex == i);
-                    if (ImGui::Selectable(m_selections[i].name.c_str(), isSelected))
-                    {
-                        m_selectedIndex = i;
-                    }
-                }
-                ImGui::EndChild();
-            }
-        }
-
-        ImGui::Spacing();
-    }
-
-    ImGui::Separator();
-    ImGui::Spacing();
-
-    // Calculate height for results area (leave room for buttons at bottom)
-    float buttonHeight = 50.0f;
-    float buttonAreaHeight = buttonHeight + 30.0f; // button + padding
-    float availableHeight = ImGui::GetContentRegionAvail().y - buttonAreaHeight;
-
-    // Results display
-    ImGui::Text("Results:");
-    ImGui::BeginChild("Results", ImVec2(0, availableHeight - 30), true);
-
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
-
-        bool hasAnyResult = false;
-        for (const auto& item : m_selections)
-        {
-            if (item.hasResult)
-            {
-                hasAnyResult = true;
-                break;
-            }
-        }
-
-        if (!hasAnyResult)
-        {
-            ImGui::TextDisabled("Select faces and click Calculate.");
-        }
-        else
-        {
-            double lenFactor = GetLengthFactor();
-            double areaFactor = GetAreaFactor();
-            double inertiaFactor = GetInertiaFactor();
-            double sectionModFactor = lenFactor * lenFactor * lenFactor;
-            const char* lenUnit = GetLengthUnit();
-
-            for (size_t i = 0; i < m_selections.size(); i++)
-            {
-                const auto& item = m_selections[i];
-                if (!item.hasResult)
-                    continue;
-
-                const auto& r = item.result;
-
-                if (i > 0)
-                {
-                    ImGui::Spacing();
-                    ImGui::Separator();
-                    ImGui::Spacing();
-                }
-
-                // Header
-                ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.2f, 1.0f), "%s", item.name.c_str());
-                ImGui::Spacing();
-
-                // Area and Centroid
-                if (ImGui::TreeNodeEx("Basic Properties", ImGuiTreeNodeFlags_DefaultOpen))
-                {
-                    ImGui::Text("Area: %.6f %s^2", r.area * areaFactor, lenUnit);
-                    ImGui::Text("Centroid: (%.6f, %.6f) %s", r.Cx * lenFactor, r.Cy * lenFactor, lenUnit);
-                    ImGui::TreePop();
-                }
-
-                // First Moments
-                if (ImGui::TreeNode("First Moments"))
-                {
-                    double Qx = r.area * r.Cy;
-                    double Qy = r.area * r.Cx;
-                    ImGui::Text("Qx: %.6f %s^3", Qx * sectionModFactor, lenUnit);
-                    ImGui::Text("Qy: %.6f %s^3", Qy * sectionModFactor, lenUnit);
-                    ImGui::TreePop();
-                }
-
-                // Second Moments about Origin
-                if (ImGui::TreeNode("Second Moments (about Origin)"))
-                {
-                    ImGui::Text("Ixx: %.6f %s^4", r.Ixx_origin * inertiaFactor, lenUnit);
-                    ImGui::Text("Iyy: %.6f %s^4", r.Iyy_origin * inertiaFactor, lenUnit);
-                    ImGui::Text("Izz: %.6f %s^4", r.J_origin * inertiaFactor, lenUnit);
-                    ImGui::Text("Ixy: %.6f %s^4", r.Ixy_origin * inertiaFactor, lenUnit);
-                    ImGui::TreePop();
-                }
-
-                // Moments about Centroid
-                if (ImGui::TreeNodeEx("Moments about Centroid", ImGuiTreeNodeFlags_DefaultOpen))
-                {
-                    ImGui::Text("Ix: %.6f %s^4", r.Ix_centroid * inertiaFactor, lenUnit);
-                    ImGui::Text("Iy: %.6f %s^4", r.Iy_centroid * inertiaFactor, lenUnit);
-                    ImGui::Text("Iz (polar): %.6f %s^4", r.J_centroid * inertiaFactor, lenUnit);
-                    ImGui::Text("Ixy: %.6f %s^4", r.Ixy_centroid * inertiaFactor, lenUnit);
-                    ImGui::TreePop();
-                }
-
-                // Principal Moments
-                if (ImGui::TreeNodeEx("Principal Moments", ImGuiTreeNodeFlags_DefaultOpen))
-                {
-                    ImGui::Text("I1 (min): %.6f %s^4", r.Ix_principal * inertiaFactor, lenUnit);
-                    ImGui::Text("I2 (max): %.6f %s^4", r.Iy_principal * inertiaFactor, lenUnit);
-                    ImGui::Text("Principal Angle: %.2f deg", r.theta_deg);
-                    ImGui::TreePop();
-                }
-
-                // Radii of Gyration
-                if (ImGui::TreeNode("Radii of Gyration"))
-                {
-                    ImGui::Text("Rx: %.6f %s", r.Rx * lenFactor, lenUnit);
-                    ImGui::Text("Ry: %.6f %s", r.Ry * lenFactor, lenUnit);
-                    double Rz = (r.area > 1e-10) ? sqrt(r.J_centroid / r.area) : 0;
-                    ImGui::Text("Rz: %.6f %s", Rz * lenFactor, lenUnit);
-                    ImGui::TreePop();
-                }
-
-                // Section Modulus
-                if (ImGui::TreeNode("Section Modulus (Elastic)"))
-                {
-                    ImGui::Text("Sx (Ix/c): %.6f %s^3", r.Sx_min * sectionModFactor, lenUnit);
-                    ImGui::Text("Sy (Iy/c): %.6f %s^3", r.Sy_min * sectionModFactor, lenUnit);
-                    ImGui::TreePop();
-                }
-            }
-        }
+        m_calculateRequested = true;
+        if (m_calculateCallback)
+            m_calculateCallback(m_calculateContext);
     }
-
-    ImGui::EndChild();
-
-    // Buttons at the bottom
-    ImGui::Spacing();
-
-    float buttonWidth = 150.0f;
-
-    // Hide Calculate button when auto-calculate is on
-    if (!m_autoCalculate)
+    if (actions & PANEL_ACTION_COPY)
     {
-        if (ImGui::Button("Calculate", ImVec2(buttonWidth, buttonHeight)))
-        {
-            m_calculateRequested = true;
-            if (m_calculateCallback)
-                m_calculateCallback(m_calculateContext);
-        }
-        ImGui::SameLine();
+        CopyResultsToClipboard();
     }
-    if (ImGui::Button("Copy Results", ImVec2(buttonWidth, buttonHeight)))
+    if (actions & PANEL_ACTION_SAVE_LOG)
     {
-        CopyResultsToClipboard();
+        SaveEventLog();
     }
-    ImGui::SameLine();
-    if (ImGui::Button("Close", ImVec2(buttonWidth, buttonHeight)))
+    if (actions & PANEL_ACTION_CLOSE)
     {
         Hide();
         if (m_closeCallback)
             m_closeCallback(m_closeContext);
     }
-
-    ImGui::End();
 }
 
 bool ImGuiAreaMomentsWindow::CreateDeviceD3D(HWND hWnd)
@@ -621,130 +600,44 @@ void ImGuiAreaMomentsWindow::ResetDevice()
     }
 }
 
-double ImGuiAreaMomentsWindow::GetLengthFactor() const
+float ImGuiAreaMomentsWindow::GetDpiScale(HWND hWnd)
 {
-    switch (m_currentUnits)
-    {
-    case IMGUI_UNITS_MM:   return CM_TO_MM;
-    case IMGUI_UNITS_INCH: return CM_TO_INCH;
-    default:               return 1.0;
-    }
+    HDC hdc = ::GetDC(hWnd);
+    if (hdc == nullptr)
+        return 1.0f;
+    int dpi = ::GetDeviceCaps(hdc, LOGPIXELSY);
+    ::ReleaseDC(hWnd, hdc);
+    return dpi > 0 ? (float)dpi / 96.0f : 1.0f;
 }
 
-double ImGuiAreaMomentsWindow::GetAreaFactor() const
+bool ImGuiAreaMomentsWindow::GetDataFilePath(const char* fileName, char* path, size_t size, bool machineWide)
 {
-    double len = GetLengthFactor();
-    return len * len;
-}
+    char appData[MAX_PATH];
+    int folder = machineWide ? CSIDL_COMMON_APPDATA : CSIDL_LOCAL_APPDATA;
+    if (FAILED(SHGetFolderPathA(nullptr, folder, nullptr, 0, appData)))
+        return false;
 
-double ImGuiAreaMomentsWindow::GetInertiaFactor() const
-{
-    double len = GetLengthFactor();
-    return len * len * len * len;
+    sprintf_s(path, size, "%s\\AreaMomentTool", appData);
+    ::CreateDirectoryA(path, nullptr);
+    sprintf_s(path, size, "%s\\AreaMomentTool\\%s", appData, fileName);
+    return true;
 }
 
-const char* ImGuiAreaMomentsWindow::GetLengthUnit() const
+bool ImGuiAreaMomentsWindow::SaveEventLog()
 {
-    switch (m_currentUnits)
-    {
-    case IMGUI_UNITS_MM:   return "mm";
-    case IMGUI_UNITS_INCH: return "in";
-    default:               return "cm";
-    }
+    char logPath[MAX_PATH];
+    if (!GetDataFilePath("events.bin", logPath, sizeof(logPath)))
+        return false;
+
+    bool saved = CEventLog::Flush(logPath);
+    TRACE("Area moments window: event log %s %s\n", saved ? "saved to" : "could not be saved to", logPath);
+    return saved;
 }
 
 void ImGuiAreaMomentsWindow::CopyResultsToClipboard()
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-
     std::string text;
-    text += "Area Moments of Inertia Results\n";
-    text += "================================\n\n";
-
-    double lenFactor = GetLengthFactor();
-    double areaFactor = GetAreaFactor();
-    double inertiaFactor = GetInertiaFactor();
-    double sectionModFactor = lenFactor * lenFactor * lenFactor;
-    const char* lenUnit = GetLengthUnit();
-
-    for (size_t i = 0; i < m_selections.size(); i++)
-    {
-        const auto& item = m_selections[i];
-        if (!item.hasResult)
-            continue;
-
-        const auto& r = item.result;
-
-        text += item.name + "\n";
-        text += std::string(item.name.length(), '-') + "\n\n";
-
-        // Basic Properties
-        text += "Basic Properties:\n";
-        char buf[256];
-        sprintf_s(buf, "  Area: %.6f %s^2\n", r.area * areaFactor, lenUnit);
-        text += buf;
-        sprintf_s(buf, "  Centroid: (%.6f, %.6f) %s\n\n", r.Cx * lenFactor, r.Cy * lenFactor, lenUnit);
-        text += buf;
-
-        // First Moments
-        double Qx = r.area * r.Cy;
-        double Qy = r.area * r.Cx;
-        text += "First Moments:\n";
-        sprintf_s(buf, "  Qx: %.6f %s^3\n", Qx * sectionModFactor, lenUnit);
-        text += buf;
-        sprintf_s(buf, "  Qy: %.6f %s^3\n\n", Qy * sectionModFactor, lenUnit);
-        text += buf;
-
-        // Second Moments about Origin
-        text += "Second Moments (about Origin):\n";
-        sprintf_s(buf, "  Ixx: %.6f %s^4\n", r.Ixx_origin * inertiaFactor, lenUnit);
-        text += buf;
-        sprintf_s(buf, "  Iyy: %.6f %s^4\n", r.Iyy_origin * inertiaFactor, lenUnit);
-        text += buf;
-        sprintf_s(buf, "  Izz: %.6f %s^4\n", r.J_origin * inertiaFactor, lenUnit);
-        text += buf;
-        sprintf_s(buf, "  Ixy: %.6f %s^4\n\n", r.Ixy_origin * inertiaFactor, lenUnit);
-        text += buf;
-
-        // Moments about Centroid
-        text += "Moments about Centroid:\n";
-        sprintf_s(buf, "  Ix: %.6f %s^4\n", r.Ix_centroid * inertiaFactor, lenUnit);
-        text += buf;
-        sprintf_s(buf, "  Iy: %.6f %s^4\n", r.Iy_centroid * inertiaFactor, lenUnit);
-        text += buf;
-        sprintf_s(buf, "  Iz (polar): %.6f %s^4\n", r.J_centroid * inertiaFactor, lenUnit);
-        text += buf;
-        sprintf_s(buf, "  Ixy: %.6f %s^4\n\n", r.Ixy_centroid * inertiaFactor, lenUnit);
-        text += buf;
-
-        // Principal Moments
-        text += "Principal Moments:\n";
-        sprintf_s(buf, "  I1 (min): %.6f %s^4\n", r.Ix_principal * inertiaFactor, lenUnit);
-        text += buf;
-        sprintf_s(buf, "  I2 (max): %.6f %s^4\n", r.Iy_principal * inertiaFactor, lenUnit);
-        text += buf;
-        sprintf_s(buf, "  Principal Angle: %.2f deg\n\n", r.theta_deg);
-        text += buf;
-
-        // Radii of Gyration
-        text += "Radii of Gyration:\n";
-        sprintf_s(buf, "  Rx: %.6f %s\n", r.Rx * lenFactor, lenUnit);
-        text += buf;
-        sprintf_s(buf, "  Ry: %.6f %s\n", r.Ry * lenFactor, lenUnit);
-        text += buf;
-        double Rz = (r.area > 1e-10) ? sqrt(r.J_centroid / r.area) : 0;
-        sprintf_s(buf, "  Rz: %.6f %s\n\n", Rz * lenFactor, lenUnit);
-        text += buf;
-
-        // Section Modulus
-        text += "Section Modulus (Elastic):\n";
-        sprintf_s(buf, "  Sx (Ix/c): %.6f %s^3\n", r.Sx_min * sectionModFactor, lenUnit);
-        text += buf;
-        sprintf_s(buf, "  Sy (Iy/c): %.6f %s^3\n", r.Sy_min * sectionModFactor, lenUnit);
-        text += buf;
-
-        text += "\n";
-    }
+    m_panel.BuildResultsText(text);
 
     // Copy to clipboard using Windows API
     if (OpenClipboard(m_hWnd))
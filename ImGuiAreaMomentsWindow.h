@@ -5,49 +5,15 @@
 #define IMGUI_AREAMOMENTS_WINDOW_H
 
 #include "AreaMomentsCalculator.h"
+#include "AreaMomentsPanel.h"
 #include <vector>
 #include <string>
 #include <thread>
 #include <atomic>
 #include <mutex>
+#include <memory>
 #include <d3d9.h>
 
-// Unit types for display
-enum ImGuiAreaMomentsUnits
-{
-    IMGUI_UNITS_CM = 0,
-    IMGUI_UNITS_MM,
-    IMGUI_UNITS_INCH,
-    IMGUI_UNITS_COUNT
-};
-
-// Result structure
-struct ImGuiAreaMomentsResult
-{
-    double area = 0;
-    double perimeter = 0;
-    double Cx = 0, Cy = 0;
-    double Ixx_origin = 0, Ixy_origin = 0, Iyy_origin = 0;
-    double J_origin = 0;
-    double Ix_centroid = 0, Iy_centroid = 0, Ixy_centroid = 0;
-    double Ix_principal = 0, Iy_principal = 0;
-    double J_centroid = 0;
-    double theta_deg = 0;
-    double Rx = 0, Ry = 0;
-    double Sx_min = 0, Sy_min = 0;
-    double cx_max = 0, cy_max = 0;
-    std::string faceType;
-};
-
-// Selection item
-struct ImGuiSelectionItem
-{
-    std::string name;
-    void* pFace = nullptr;  // IADFace* stored as void* to avoid namespace issues
-    ImGuiAreaMomentsResult result;
-    bool hasResult = false;
-};
-
 // Callback types
 typedef void (*ImGuiCloseCallback)(void* pContext);
 typedef void (*ImGuiCalculateCallback)(void* pContext);
@@ -69,6 +35,7 @@ public:
     // Data management
     void ClearSelections();
     void AddSelection(const char* name, void* pFace);
+    void AddSelections(void* const* faces, int count);
     void SetSelectionResult(int index, const ImGuiAreaMomentsResult& result);
     int GetSelectionCount() const;
 
@@ -77,15 +44,33 @@ public:
     void SetCalculateCallback(ImGuiCalculateCallback callback, void* pContext);
 
     // Access selections for calculation
-    std::vector<ImGuiSelectionItem>& GetSelections();
+    CSectionResultStore& GetResults();
+
+    // Result history across design edits (guarded by GetMutex())
+    CSectionHistory& GetHistory() { return m_panel.GetHistory(); }
+    CSectionLibrary& GetLibrary() { return m_panel.GetLibrary(); }
+    CTessellationCache& GetTessellationCache() { return m_panel.GetTessellationCache(); }
+    CResultCache& GetResultCache() { return m_panel.GetResultCache(); }
     std::mutex& GetMutex();
 
+    // Rebuild the UI on the next frame, e.g. after results changed
+    void RequestRedraw();
+
     // Process pending requests (call from main thread)
     bool HasPendingCalculation() const { return m_calculateRequested; }
     void ClearCalculationRequest() { m_calculateRequested = false; }
 
     // Auto-calculate
-    bool IsAutoCalculateEnabled() const { return m_autoCalculate; }
+    bool IsAutoCalculateEnabled() const { return m_panel.IsAutoCalculateEnabled(); }
+
+    // Quick mode (area and centroid only)
+    bool IsQuickModeEnabled() const { return m_panel.IsQuickModeEnabled(); }
+
+    // Simplify meshes kept for the property graph
+    bool IsMeshSimplifyEnabled() const { return m_panel.IsMeshSimplifyEnabled(); }
+
+    // Milliseconds from Create to the first presented frame (-1 until then)
+    double GetTimeToFirstFrameMs() const { return m_firstFrameMs; }
 
 private:
     // Window procedure
@@ -95,17 +80,23 @@ private:
     void RenderThread();
     void RenderFrame();
     void RenderUI();
+    void PresentDrawData();
+    bool NeedsFullFrame();
 
     // DirectX setup
     bool CreateDeviceD3D(HWND hWnd);
     void CleanupDeviceD3D();
     void ResetDevice();
 
-    // Unit helpers
-    double GetLengthFactor() const;
-    double GetAreaFactor() const;
-    double GetInertiaFactor() const;
-    const char* GetLengthUnit() const;
+    // Monitor scale relative to 96 DPI (null for the primary screen)
+    static float GetDpiScale(HWND hWnd);
+
+    // File under %LOCALAPPDATA%\AreaMomentTool, or %PROGRAMDATA% if
+    // machine wide, creating the folder
+    static bool GetDataFilePath(const char* fileName, char* path, size_t size, bool machineWide = false);
+
+    // Write the event log next to the history file
+    bool SaveEventLog();
 
     // Clipboard
     void CopyResultsToClipboard();
@@ -128,14 +119,20 @@ private:
     std::atomic<bool> m_running{ false };
     std::atomic<bool> m_visible{ false };
     std::atomic<bool> m_shouldClose{ false };
-    std::mutex m_mutex;
 
-    // UI state
-    int m_currentUnits = IMGUI_UNITS_CM;
-    int m_selectedIndex = -1;
-    std::vector<ImGuiSelectionItem> m_selections;
+    // Retained frames
+    HANDLE m_wakeEvent = nullptr;
+    std::atomic<bool> m_redrawRequested{ true };
+    std::atomic<bool> m_repaintRequested{ false };
+    int m_settleFrames = 0;
+
+    // Startup timing
+    LARGE_INTEGER m_createTicks = {};
+    double m_firstFrameMs = -1.0;
+
+    // UI state and data
+    CAreaMomentsPanel m_panel;
     std::atomic<bool> m_calculateRequested{ false };
-    bool m_autoCalculate = true;
 
     // Callbacks
     ImGuiCloseCallback m_closeCallback = nullptr;
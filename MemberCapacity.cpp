@@ -0,0 +1,213 @@
+// MemberCapacity.cpp: Lateral-torsional buckling capacity tables for beams
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "MemberCapacity.h"
+#include "ColumnBuckling.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+static const double PI = 3.14159265358979323846;
+
+static const double s_curveAlpha[LTB_CURVE_COUNT] = { 0.21, 0.34, 0.49, 0.76 };
+
+// MPa = 100 N/cm^2, and N cm = 1e-5 kNm
+static const double MPA_TO_N_PER_CM2 = 100.0;
+static const double NCM_TO_KNM = 1e-5;
+
+// Poisson's ratio of steel, for G = E / (2 (1 + nu))
+static const double POISSON_RATIO = 0.3;
+
+size_t MemberCapacityTable::GetMemoryBytes() const
+{
+    return sizeof(*this) +
+           (lengths.capacity() + ratios.capacity() + factors.capacity() +
+            criticalMoment.capacity() + reduction.capacity() + designMoment.capacity()) * sizeof(double);
+}
+
+CMemberCapacity::CMemberCapacity()
+    : m_sequence(0), m_hits(0), m_misses(0)
+{
+}
+
+double CMemberCapacity::EstimateTorsionConstant(const ImGuiAreaMomentsResult& result)
+{
+    if (result.J_centroid <= 0)
+        return 0;
+    double a2 = result.area * result.area;
+    return a2 * a2 / (4.0 * PI * PI * result.J_centroid);
+}
+
+double CMemberCapacity::MomentGradientFactor(double psi)
+{
+    return std::min(1.88 - 1.40 * psi + 0.52 * psi * psi, 2.70);
+}
+
+// Section and material constants shared by every cell of a table, in N and cm
+struct MemberCapacityInputs
+{
+    double piSquaredEIz;    // pi^2 E Iz
+    double warpingRatio;    // Iw / Iz
+    double torsionRatio;    // G It / (pi^2 E Iz)
+    double elasticMoment;   // Wy fy
+    double alpha;
+};
+
+static void EvaluateCells(const MemberCapacityInputs& in, MemberCapacityTable& table, int first, int last)
+{
+    for (int cell = first; cell < last; cell++)
+    {
+        double L = table.lengths[cell % table.lengthCount];
+        double C1 = table.factors[cell / table.lengthCount];
+        double L2 = L * L;
+        double Mcr = C1 * in.piSquaredEIz / L2 * sqrt(in.warpingRatio + L2 * in.torsionRatio);
+
+        double chi = 0.0;
+        if (Mcr > 0)
+        {
+            double lambda = sqrt(in.elasticMoment / Mcr);
+            double phi = 0.5 * (1.0 + in.alpha * (lambda - 0.2) + lambda * lambda);
+            chi = std::min(1.0, 1.0 / (phi + sqrt(std::max(phi * phi - lambda * lambda, 0.0))));
+        }
+
+        table.criticalMoment[cell] = Mcr * NCM_TO_KNM;
+        table.reduction[cell] = chi;
+        table.designMoment[cell] = chi * in.elasticMoment * NCM_TO_KNM;
+    }
+}
+
+void CMemberCapacity::Evaluate(const ImGuiAreaMomentsResult& result, const MemberCapacitySettings& settings,
+                               MemberCapacityTable& table)
+{
+    const ColumnMaterial& material = CColumnBuckling::GetMaterial(settings.material);
+    double E = material.E * MPA_TO_N_PER_CM2;
+    double G = E / (2.0 * (1.0 + POISSON_RATIO));
+    double fy = material.Fy * MPA_TO_N_PER_CM2;
+
+    // Strong axis is the stiffer centroidal one; Iz is the minor principal moment
+    double Wy = (result.Ix_centroid >= result.Iy_centroid) ? result.Sx_min : result.Sy_min;
+    double Iz = std::max(result.Ix_principal, 1e-30);
+
+    table.lengthCount = std::max(settings.lengthCount, 1);
+    table.gradientCount = std::max(settings.gradientCount, 1);
+    table.torsionConstant = (settings.torsionConstant > 0) ? settings.torsionConstant
+                                                           : EstimateTorsionConstant(result);
+    table.warpingConstant = std::max(settings.warpingConstant, 0.0);
+
+    MemberCapacityInputs in;
+    in.piSquaredEIz = PI * PI * E * Iz;
+    in.warpingRatio = table.warpingConstant / Iz;
+    in.torsionRatio = G * table.torsionConstant / in.piSquaredEIz;
+    in.elasticMoment = Wy * fy;
+    in.alpha = s_curveAlpha[std::max(0, std::min(settings.curve, (int)LTB_CURVE_COUNT - 1))];
+    table.elasticMoment = in.elasticMoment * NCM_TO_KNM;
+
+    table.lengths.resize(table.lengthCount);
+    for (int l = 0; l < table.lengthCount; l++)
+        table.lengths[l] = settings.maxLength * (l + 1) / table.lengthCount;
+    table.ratios.resize(table.gradientCount);
+    table.factors.resize(table.gradientCount);
+    for (int g = 0; g < table.gradientCount; g++)
+    {
+        table.ratios[g] = (table.gradientCount > 1) ? 1.0 - 2.0 * g / (table.gradientCount - 1) : 1.0;
+        table.factors[g] = MomentGradientFactor(table.ratios[g]);
+    }
+
+    int cells = table.lengthCount * table.gradientCount;
+    table.criticalMoment.resize(cells);
+    table.reduction.resize(cells);
+    table.designMoment.resize(cells);
+
+    // Contiguous cell ranges per thread; the caller's thread takes the first
+    int workers = std::max(1, std::min((int)std::thread::hardware_concurrency(),
+                                       cells / (int)MIN_CELLS_PER_THREAD));
+    int chunk = (cells + workers - 1) / workers;
+    std::vector<std::thread> threads;
+    for (int w = 1; w < workers; w++)
+    {
+        int first = w * chunk, last = std::min(cells, first + chunk);
+        if (first < last)
+            threads.emplace_back(EvaluateCells, std::cref(in), std::ref(table), first, last);
+    }
+    EvaluateCells(in, table, 0, std::min(cells, chunk));
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+uint64_t CMemberCapacity::MakeKey(const ImGuiAreaMomentsResult& result, const MemberCapacitySettings& settings)
+{
+    // Every input Evaluate() reads, so sections that only share area and
+    // centroidal moments (mirrored, or with other extreme fibers) differ
+    double values[14] =
+    {
+        (double)settings.material, (double)settings.curve, settings.torsionConstant,
+        settings.warpingConstant, settings.maxLength, (double)settings.lengthCount,
+        (double)settings.gradientCount,
+        result.area, result.Ix_centroid, result.Iy_centroid, result.Ix_principal,
+        result.J_centroid, result.Sx_min, result.Sy_min
+    };
+
+    uint64_t hash = 14695981039346656037ULL;
+    for (int i = 0; i < 14; i++)
+    {
+        uint64_t bits;
+        memcpy(&bits, &values[i], sizeof(bits));
+        hash = (hash ^ bits) * 1099511628211ULL;
+        hash ^= hash >> 29;
+    }
+    return hash;
+}
+
+const MemberCapacityTable& CMemberCapacity::Require(const ImGuiAreaMomentsResult& result,
+                                                    const MemberCapacitySettings& settings)
+{
+    uint64_t key = MakeKey(result, settings);
+    auto found = m_tables.find(key);
+    if (found != m_tables.end())
+    {
+        m_hits++;
+        found->second.lastUsed = ++m_sequence;
+        return found->second.table;
+    }
+
+    // Recycle the least recently used table's buffers
+    m_misses++;
+    CachedTable entry;
+    if (m_tables.size() >= CACHE_CAPACITY)
+    {
+        auto oldest = m_tables.begin();
+        for (auto it = m_tables.begin(); it != m_tables.end(); ++it)
+        {
+            if (it->second.lastUsed < oldest->second.lastUsed)
+                oldest = it;
+        }
+        entry = std::move(oldest->second);
+        m_tables.erase(oldest);
+    }
+
+    Evaluate(result, settings, entry.table);
+    entry.lastUsed = ++m_sequence;
+    return m_tables.emplace(key, std::move(entry)).first->second.table;
+}
+
+void CMemberCapacity::Clear()
+{
+    m_tables.clear();
+}
+
+size_t CMemberCapacity::GetMemoryBytes() const
+{
+    size_t bytes = 0;
+    for (const auto& entry : m_tables)
+        bytes += sizeof(entry) + entry.second.table.GetMemoryBytes();
+    return bytes;
+}
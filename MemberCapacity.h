@@ -0,0 +1,118 @@
+// MemberCapacity.h: Lateral-torsional buckling capacity tables for beams
+//////////////////////////////////////////////////////////////////////
+
+#ifndef MEMBER_CAPACITY_H
+#define MEMBER_CAPACITY_H
+
+#include "SectionPropertyGraph.h"
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+// Imperfection factors of the EN 1993-1-1 6.3.2.2 buckling curves
+enum MemberCapacityCurve
+{
+    LTB_CURVE_A = 0,    // alpha 0.21
+    LTB_CURVE_B,        // alpha 0.34
+    LTB_CURVE_C,        // alpha 0.49
+    LTB_CURVE_D,        // alpha 0.76
+    LTB_CURVE_COUNT
+};
+
+// What a table is evaluated for; part of the cache key
+struct MemberCapacitySettings
+{
+    int material = 2;                   // CColumnBuckling::GetMaterial index
+    int curve = LTB_CURVE_B;
+    double torsionConstant = 0;         // It, cm^4; 0 = estimate from the section
+    double warpingConstant = 0;         // Iw, cm^6
+    double maxLength = 1000;            // Longest unbraced length, cm
+    int lengthCount = 128;
+    int gradientCount = 9;              // End moment ratios from 1 to -1
+};
+
+// Capacity over unbraced length x moment gradient, entry
+// [g * lengthCount + l] for ratio g and length l
+struct MemberCapacityTable
+{
+    int lengthCount = 0;
+    int gradientCount = 0;
+    double torsionConstant = 0;         // It used, cm^4
+    double warpingConstant = 0;         // Iw used, cm^6
+    double elasticMoment = 0;           // Wy fy, kNm
+    std::vector<double> lengths;        // cm
+    std::vector<double> ratios;         // End moment ratio psi
+    std::vector<double> factors;        // C1 for each ratio
+    std::vector<double> criticalMoment; // Mcr, kNm
+    std::vector<double> reduction;      // chi_LT
+    std::vector<double> designMoment;   // chi_LT Wy fy, kNm
+
+    double CriticalMoment(int g, int l) const { return criticalMoment[g * lengthCount + l]; }
+    double Reduction(int g, int l) const { return reduction[g * lengthCount + l]; }
+    double DesignMoment(int g, int l) const { return designMoment[g * lengthCount + l]; }
+    size_t GetMemoryBytes() const;
+};
+
+// Lateral-torsional buckling of a doubly symmetric beam bent about its
+// strong axis, per EN 1993-1-1 6.3.2.2 with gamma_M1 = 1:
+//   Mcr = C1 pi^2 E Iz / L^2 sqrt(Iw / Iz + L^2 G It / (pi^2 E Iz))
+//   lambda = sqrt(Wy fy / Mcr), Phi = 0.5 (1 + alpha (lambda - 0.2) + lambda^2)
+//   chi = min(1, 1 / (Phi + sqrt(Phi^2 - lambda^2)))
+// with C1 = 1.88 - 1.40 psi + 0.52 psi^2 <= 2.70 for a linear moment
+// diagram with end moment ratio psi. Iz is the minor principal moment and
+// Wy the elastic modulus about the stronger centroidal axis.
+//
+// The mesh gives no wall thicknesses, so without a user value It falls
+// back to Saint-Venant's approximation A^4 / (4 pi^2 Ip), exact for
+// ellipses and generous for thin-walled open sections; Iw has no estimate
+// and defaults to 0 (pure St. Venant torsion, conservative).
+//
+// Tables are split across threads by cell and kept per section
+// fingerprint and settings, so returning to a face costs a lookup.
+class CMemberCapacity
+{
+public:
+    enum
+    {
+        CACHE_CAPACITY = 64,            // Tables kept, least recently used evicted
+        MIN_CELLS_PER_THREAD = 4096     // Smaller tables are evaluated inline
+    };
+
+    CMemberCapacity();
+
+    // Saint-Venant's estimate of the torsion constant, cm^4
+    static double EstimateTorsionConstant(const ImGuiAreaMomentsResult& result);
+
+    // C1 for a linear moment diagram with end moment ratio psi
+    static double MomentGradientFactor(double psi);
+
+    // Evaluate a table; 'result' needs the principal and section modulus nodes
+    static void Evaluate(const ImGuiAreaMomentsResult& result, const MemberCapacitySettings& settings,
+                         MemberCapacityTable& table);
+
+    // Cached table for a section, evaluated on a miss
+    const MemberCapacityTable& Require(const ImGuiAreaMomentsResult& result,
+                                       const MemberCapacitySettings& settings);
+
+    void Clear();
+    int GetCount() const { return (int)m_tables.size(); }
+    uint64_t GetHits() const { return m_hits; }
+    uint64_t GetMisses() const { return m_misses; }
+    size_t GetMemoryBytes() const;
+
+private:
+    struct CachedTable
+    {
+        MemberCapacityTable table;
+        uint64_t lastUsed = 0;
+    };
+
+    static uint64_t MakeKey(const ImGuiAreaMomentsResult& result, const MemberCapacitySettings& settings);
+
+    std::unordered_map<uint64_t, CachedTable> m_tables;
+    uint64_t m_sequence;
+    uint64_t m_hits;
+    uint64_t m_misses;
+};
+
+#endif // MEMBER_CAPACITY_H
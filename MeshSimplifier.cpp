@@ -0,0 +1,656 @@
+// MeshSimplifier.cpp: Moment-preserving simplification of section meshes
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "MeshSimplifier.h"
+#include "SectionBoundary.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <queue>
+#include <unordered_map>
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+const double CMeshSimplifier::DEFAULT_TOLERANCE = 1e-3;
+
+// The correction stops once every moment is this close, relative to its scale
+static const double MOMENT_TOLERANCE = 1e-13;
+
+// Area, Qx, Qy, Ixx, Iyy and Ixy
+static const int MOMENT_COUNT = 6;
+
+// Neighbours tried as the target of an interior vertex; the hub of a fan
+// has hundreds, and rarely any that works
+static const int MAX_INTERIOR_TARGETS = 8;
+
+static void MomentVector(const SectionPolygonMoments& m, double* values)
+{
+    values[0] = m.area;
+    values[1] = m.Qx;
+    values[2] = m.Qy;
+    values[3] = m.Ixx;
+    values[4] = m.Iyy;
+    values[5] = m.Ixy;
+}
+
+// Partial derivatives of one directed edge's Green's terms (as in
+// SectionPolygonMoments::AddEdge, MomentVector order) by x0, y0, x1, y1
+static void EdgeGradient(double x0, double y0, double x1, double y1, double gradient[MOMENT_COUNT][4])
+{
+    double cross = x0 * y1 - x1 * y0;
+    const double dCross[4] = { y1, -x1, -y0, x0 };
+
+    // Each term is poly * cross / divisor
+    const double poly[MOMENT_COUNT] =
+    {
+        1.0, y0 + y1, x0 + x1, y0 * y0 + y0 * y1 + y1 * y1, x0 * x0 + x0 * x1 + x1 * x1,
+        x0 * y1 + 2 * x0 * y0 + 2 * x1 * y1 + x1 * y0
+    };
+    const double dPoly[MOMENT_COUNT][4] =
+    {
+        { 0, 0, 0, 0 },
+        { 0, 1, 0, 1 },
+        { 1, 0, 1, 0 },
+        { 0, 2 * y0 + y1, 0, y0 + 2 * y1 },
+        { 2 * x0 + x1, 0, x0 + 2 * x1, 0 },
+        { y1 + 2 * y0, 2 * x0 + x1, 2 * y1 + y0, x0 + 2 * x1 }
+    };
+    const double divisor[MOMENT_COUNT] = { 2, 6, 6, 12, 12, 24 };
+
+    for (int q = 0; q < MOMENT_COUNT; q++)
+    {
+        for (int k = 0; k < 4; k++)
+            gradient[q][k] = (dPoly[q][k] * cross + poly[q] * dCross[k]) / divisor[q];
+    }
+}
+
+static double TriangleArea(const double* a, const double* b, const double* c)
+{
+    return 0.5 * ((b[0] - a[0]) * (c[1] - a[1]) - (c[0] - a[0]) * (b[1] - a[1]));
+}
+
+// Distance from q to the segment a-b
+static double SegmentDistance(const double* q, const double* a, const double* b)
+{
+    double dx = b[0] - a[0], dy = b[1] - a[1];
+    double length2 = dx * dx + dy * dy;
+    double t = (length2 > 0) ? ((q[0] - a[0]) * dx + (q[1] - a[1]) * dy) / length2 : 0.0;
+    t = std::max(0.0, std::min(t, 1.0));
+    double ex = a[0] + t * dx - q[0], ey = a[1] + t * dy - q[1];
+    return sqrt(ex * ex + ey * ey);
+}
+
+struct CollapseCandidate
+{
+    double error;
+    int vertex;
+    unsigned int stamp;
+
+    // Cheapest on top of the priority queue
+    bool operator<(const CollapseCandidate& other) const { return error > other.error; }
+};
+
+// Indexed mesh with vertex-triangle adjacency and boundary links, counter-
+// clockwise and shifted so the original centroid is at the origin
+class SimplifyMesh
+{
+public:
+    void Build(const std::vector<double>& vertices2D, const std::vector<int>& indices, double shiftX, double shiftY);
+    void Decimate(double tolerance, MeshSimplifyStats& stats);
+    bool Correct(const double* target, const double* scale, MeshSimplifyStats& stats);
+    void MeshMoments(SectionPolygonMoments& moments) const;
+    void Output(std::vector<double>& vertices2D, std::vector<int>& indices, MeshSimplifyStats& stats) const;
+
+private:
+    const double* Point(int v) const { return &m_points[v * 2]; }
+    bool IsBoundary(int v) const { return m_next[v] >= 0; }
+    bool NearExtreme(int v) const;
+    void Neighbors(int v, std::vector<int>& neighbors) const;
+    double ChordError(int v);
+    bool CanCollapse(int v, int u);
+    bool Evaluate(int v, double& error, int& target);
+    void Collapse(int v, int u);
+    void Unlink(int triangle, int v);
+
+    std::vector<double> m_points;
+    std::vector<int> m_triangles;
+    std::vector<char> m_alive;
+    std::vector<std::vector<int>> m_rings;      // Triangles around each vertex
+    std::vector<int> m_prev, m_next;            // Boundary neighbours, -1 inside
+    std::vector<char> m_locked, m_removed;
+    std::vector<std::vector<double>> m_dropped; // Original points cut from the boundary edge leaving each vertex
+    std::vector<double> m_chordErrors;          // Of removing each boundary vertex, -1 until known
+    std::vector<unsigned int> m_stamps;
+    std::vector<unsigned int> m_marks;          // Link check scratch
+    unsigned int m_mark = 0;
+    double m_shiftX = 0, m_shiftY = 0;
+    double m_minX = 0, m_maxX = 0, m_minY = 0, m_maxY = 0;
+    double m_minArea = 0;
+    bool m_flipped = false;
+    double m_tolerance = 0;
+};
+
+void SimplifyMesh::Build(const std::vector<double>& vertices2D, const std::vector<int>& indices,
+                         double shiftX, double shiftY)
+{
+    std::vector<int> weld, first;
+    CSectionBoundary::WeldVertices(vertices2D, weld, first);
+    int vertexCount = (int)first.size();
+    m_shiftX = shiftX;
+    m_shiftY = shiftY;
+    m_points.resize(vertexCount * 2);
+    for (int v = 0; v < vertexCount; v++)
+    {
+        m_points[v * 2] = vertices2D[first[v] * 2] - shiftX;
+        m_points[v * 2 + 1] = vertices2D[first[v] * 2 + 1] - shiftY;
+    }
+
+    double signedArea = 0;
+    for (size_t t = 0; t + 2 < indices.size(); t += 3)
+    {
+        int a = weld[indices[t]], b = weld[indices[t + 1]], c = weld[indices[t + 2]];
+        if (a == b || b == c || c == a)
+            continue;
+        m_triangles.push_back(a);
+        m_triangles.push_back(b);
+        m_triangles.push_back(c);
+        signedArea += TriangleArea(Point(a), Point(b), Point(c));
+    }
+    m_flipped = signedArea < 0;
+    int triangleCount = (int)m_triangles.size() / 3;
+    if (m_flipped)
+    {
+        for (int t = 0; t < triangleCount; t++)
+            std::swap(m_triangles[t * 3 + 1], m_triangles[t * 3 + 2]);
+    }
+
+    m_alive.assign(triangleCount, 1);
+    m_rings.assign(vertexCount, std::vector<int>());
+    for (int t = 0; t < triangleCount; t++)
+    {
+        for (int k = 0; k < 3; k++)
+            m_rings[m_triangles[t * 3 + k]].push_back(t);
+    }
+
+    // Boundary edges are those not matched by a reversed twin; vertices
+    // where the boundary touches itself are locked in place
+    std::unordered_map<uint64_t, int> edges;
+    edges.reserve(m_triangles.size());
+    for (int t = 0; t < triangleCount; t++)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            uint32_t a = (uint32_t)m_triangles[t * 3 + k], b = (uint32_t)m_triangles[t * 3 + (k + 1) % 3];
+            auto twin = edges.find(((uint64_t)b << 32) | a);
+            if (twin != edges.end() && twin->second > 0)
+            {
+                if (--twin->second == 0)
+                    edges.erase(twin);
+            }
+            else
+            {
+                edges[((uint64_t)a << 32) | b]++;
+            }
+        }
+    }
+    m_prev.assign(vertexCount, -1);
+    m_next.assign(vertexCount, -1);
+    m_locked.assign(vertexCount, 0);
+    for (const auto& edge : edges)
+    {
+        int a = (int)(edge.first >> 32), b = (int)(edge.first & 0xFFFFFFFFu);
+        if (edge.second != 1 || m_next[a] >= 0 || m_prev[b] >= 0)
+            m_locked[a] = m_locked[b] = 1;
+        m_next[a] = b;
+        m_prev[b] = a;
+    }
+    for (int v = 0; v < vertexCount; v++)
+    {
+        if ((m_prev[v] >= 0) != (m_next[v] >= 0))
+            m_locked[v] = 1;
+    }
+
+    m_removed.assign(vertexCount, 0);
+    m_dropped.assign(vertexCount, std::vector<double>());
+    m_chordErrors.assign(vertexCount, -1.0);
+    m_stamps.assign(vertexCount, 0);
+    m_marks.assign(vertexCount, 0);
+
+    m_minX = m_minY = 1e300;
+    m_maxX = m_maxY = -1e300;
+    for (int v = 0; v < vertexCount; v++)
+    {
+        m_minX = std::min(m_minX, m_points[v * 2]);
+        m_maxX = std::max(m_maxX, m_points[v * 2]);
+        m_minY = std::min(m_minY, m_points[v * 2 + 1]);
+        m_maxY = std::max(m_maxY, m_points[v * 2 + 1]);
+    }
+    double extent = std::max(m_maxX - m_minX, m_maxY - m_minY);
+    m_minArea = 1e-14 * extent * extent;
+}
+
+bool SimplifyMesh::NearExtreme(int v) const
+{
+    const double* p = Point(v);
+    return p[0] - m_minX <= m_tolerance || m_maxX - p[0] <= m_tolerance ||
+           p[1] - m_minY <= m_tolerance || m_maxY - p[1] <= m_tolerance;
+}
+
+void SimplifyMesh::Neighbors(int v, std::vector<int>& neighbors) const
+{
+    neighbors.clear();
+    for (int t : m_rings[v])
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            if (m_triangles[t * 3 + k] != v)
+                neighbors.push_back(m_triangles[t * 3 + k]);
+        }
+    }
+    std::sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+}
+
+double SimplifyMesh::ChordError(int v)
+{
+    // Every original point between the neighbours must stay near the chord
+    if (m_chordErrors[v] < 0)
+    {
+        const double* a = Point(m_prev[v]);
+        const double* b = Point(m_next[v]);
+        double error = SegmentDistance(Point(v), a, b);
+        for (const std::vector<double>* dropped : { &m_dropped[m_prev[v]], &m_dropped[v] })
+        {
+            for (size_t k = 0; k + 1 < dropped->size(); k += 2)
+                error = std::max(error, SegmentDistance(&(*dropped)[k], a, b));
+        }
+        m_chordErrors[v] = error;
+    }
+    return m_chordErrors[v];
+}
+
+bool SimplifyMesh::CanCollapse(int v, int u)
+{
+    // A boundary vertex only slides along the boundary, and an interior
+    // edge between two boundary vertices would pinch the mesh
+    if (IsBoundary(v) && m_prev[v] != u && m_next[v] != u)
+        return false;
+    if (!IsBoundary(v) && m_locked[u])
+        return false;
+
+    // The triangles on the edge go; no other triangle may fold over or
+    // flatten when v moves to u
+    int opposite[2];
+    int shared = 0;
+    for (int t : m_rings[v])
+    {
+        const int* tri = &m_triangles[t * 3];
+        if (tri[0] == u || tri[1] == u || tri[2] == u)
+        {
+            if (shared == 2)
+                return false;
+            opposite[shared++] = tri[0] + tri[1] + tri[2] - u - v;
+            continue;
+        }
+        const double* p[3];
+        for (int k = 0; k < 3; k++)
+            p[k] = Point(tri[k] == v ? u : tri[k]);
+        if (TriangleArea(p[0], p[1], p[2]) <= m_minArea)
+            return false;
+    }
+    if (shared == 0)
+        return false;
+
+    // Link condition: u and v may only share the neighbours across those
+    // triangles
+    m_mark++;
+    for (int t : m_rings[u])
+    {
+        for (int k = 0; k < 3; k++)
+            m_marks[m_triangles[t * 3 + k]] = m_mark;
+    }
+    for (int t : m_rings[v])
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            int w = m_triangles[t * 3 + k];
+            if (w != u && w != v && m_marks[w] == m_mark && w != opposite[0] && (shared == 1 || w != opposite[1]))
+                return false;
+        }
+    }
+    return true;
+}
+
+bool SimplifyMesh::Evaluate(int v, double& error, int& target)
+{
+    if (m_removed[v] || m_locked[v])
+        return false;
+
+    if (!IsBoundary(v))
+    {
+        // Inside, the region does not change whichever neighbour takes over
+        int tries = std::min((int)m_rings[v].size(), MAX_INTERIOR_TARGETS);
+        for (int i = 0; i < tries; i++)
+        {
+            const int* tri = &m_triangles[m_rings[v][i] * 3];
+            int u = (tri[0] == v) ? tri[1] : (tri[1] == v) ? tri[2] : tri[0];
+            if (CanCollapse(v, u))
+            {
+                error = 0;
+                target = u;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    int u = m_prev[v], w = m_next[v];
+    if (m_prev[u] == w)
+        return false;   // Keep at least a triangle per loop
+
+    // Extreme fibers stay put unless a neighbour is just as far out
+    const double* p = Point(v);
+    const double* pu = Point(u);
+    const double* pw = Point(w);
+    if ((p[0] == m_minX && pu[0] != m_minX && pw[0] != m_minX) ||
+        (p[0] == m_maxX && pu[0] != m_maxX && pw[0] != m_maxX) ||
+        (p[1] == m_minY && pu[1] != m_minY && pw[1] != m_minY) ||
+        (p[1] == m_maxY && pu[1] != m_maxY && pw[1] != m_maxY))
+        return false;
+
+    error = ChordError(v);
+    if (error > m_tolerance)
+        return false;
+
+    if (CanCollapse(v, u))
+        target = u;
+    else if (CanCollapse(v, w))
+        target = w;
+    else
+        return false;
+    return true;
+}
+
+void SimplifyMesh::Unlink(int triangle, int v)
+{
+    std::vector<int>& ring = m_rings[v];
+    auto found = std::find(ring.begin(), ring.end(), triangle);
+    if (found != ring.end())
+    {
+        *found = ring.back();
+        ring.pop_back();
+    }
+}
+
+void SimplifyMesh::Collapse(int v, int u)
+{
+    for (int t : m_rings[v])
+    {
+        int* tri = &m_triangles[t * 3];
+        if (tri[0] == u || tri[1] == u || tri[2] == u)
+        {
+            m_alive[t] = 0;
+            for (int k = 0; k < 3; k++)
+            {
+                if (tri[k] != v)
+                    Unlink(t, tri[k]);
+            }
+        }
+        else
+        {
+            for (int k = 0; k < 3; k++)
+            {
+                if (tri[k] == v)
+                    tri[k] = u;
+            }
+            m_rings[u].push_back(t);
+        }
+    }
+    m_rings[v].clear();
+    m_removed[v] = 1;
+
+    if (IsBoundary(v))
+    {
+        // The merged edge owns v and the points both edges had dropped
+        int before = m_prev[v], after = m_next[v];
+        std::vector<double>& dropped = m_dropped[before];
+        dropped.push_back(m_points[v * 2]);
+        dropped.push_back(m_points[v * 2 + 1]);
+        dropped.insert(dropped.end(), m_dropped[v].begin(), m_dropped[v].end());
+        std::vector<double>().swap(m_dropped[v]);
+        m_next[before] = after;
+        m_prev[after] = before;
+        m_prev[v] = m_next[v] = -1;
+        m_chordErrors[before] = m_chordErrors[after] = -1.0;
+    }
+}
+
+void SimplifyMesh::Decimate(double tolerance, MeshSimplifyStats& stats)
+{
+    m_tolerance = tolerance;
+    std::priority_queue<CollapseCandidate> queue;
+    int vertexCount = (int)m_removed.size();
+    double error;
+    int target;
+    for (int v = 0; v < vertexCount; v++)
+    {
+        if (Evaluate(v, error, target))
+            queue.push({ error, v, m_stamps[v] });
+    }
+
+    std::vector<int> affected;
+    while (!queue.empty())
+    {
+        CollapseCandidate candidate = queue.top();
+        queue.pop();
+        int v = candidate.vertex;
+        if (m_removed[v] || candidate.stamp != m_stamps[v])
+            continue;
+        if (!Evaluate(v, error, target))
+            continue;
+
+        if (IsBoundary(v))
+            stats.boundaryRemoved++;
+        Neighbors(v, affected);
+        Collapse(v, target);
+
+        // Links and triangles change around v, chords at its neighbours
+        for (int w : affected)
+        {
+            m_stamps[w]++;
+            if (Evaluate(w, error, target))
+                queue.push({ error, w, m_stamps[w] });
+        }
+    }
+}
+
+void SimplifyMesh::MeshMoments(SectionPolygonMoments& moments) const
+{
+    // Summed over the triangles rather than the boundary links, which are
+    // incomplete where the boundary touches itself
+    moments = SectionPolygonMoments();
+    for (int t = 0; t < (int)m_alive.size(); t++)
+    {
+        if (!m_alive[t])
+            continue;
+        for (int k = 0; k < 3; k++)
+        {
+            const double* a = Point(m_triangles[t * 3 + k]);
+            const double* b = Point(m_triangles[t * 3 + (k + 1) % 3]);
+            moments.AddEdge(a[0], a[1], b[0], b[1]);
+        }
+    }
+}
+
+bool SimplifyMesh::Correct(const double* target, const double* scale, MeshSimplifyStats& stats)
+{
+    // Free boundary vertices may move, none near enough to the extremes
+    // to pass them
+    std::vector<int> movable;
+    for (int v = 0; v < (int)m_next.size(); v++)
+    {
+        if (!m_removed[v] && !m_locked[v] && IsBoundary(v) && !NearExtreme(v))
+            movable.push_back(v);
+    }
+    int count = (int)movable.size();
+
+    // Unknowns are the x and y moves of each vertex
+    std::vector<double> jacobian((size_t)MOMENT_COUNT * count * 2), rhs(MOMENT_COUNT), step;
+    double values[MOMENT_COUNT];
+    for (int iteration = 0; ; iteration++)
+    {
+        SectionPolygonMoments moments;
+        MeshMoments(moments);
+        MomentVector(moments, values);
+        stats.residual = 0;
+        for (int q = 0; q < MOMENT_COUNT; q++)
+        {
+            rhs[q] = (target[q] - values[q]) / scale[q];
+            stats.residual = std::max(stats.residual, fabs(rhs[q]));
+        }
+        if (stats.residual < MOMENT_TOLERANCE)
+            break;
+        if (iteration == CMeshSimplifier::MAX_CORRECTION_STEPS || count < MOMENT_COUNT)
+            return false;
+
+        // Only the two boundary edges at a vertex depend on it
+        for (int k = 0; k < count; k++)
+        {
+            int v = movable[k];
+            const double* a = Point(m_prev[v]);
+            const double* p = Point(v);
+            const double* b = Point(m_next[v]);
+            double before[MOMENT_COUNT][4], after[MOMENT_COUNT][4];
+            EdgeGradient(a[0], a[1], p[0], p[1], before);
+            EdgeGradient(p[0], p[1], b[0], b[1], after);
+            for (int q = 0; q < MOMENT_COUNT; q++)
+            {
+                jacobian[(q * count + k) * 2] = (before[q][2] + after[q][0]) / scale[q];
+                jacobian[(q * count + k) * 2 + 1] = (before[q][3] + after[q][1]) / scale[q];
+            }
+        }
+        if (!CSectionBoundary::MinimumNormStep(jacobian, MOMENT_COUNT, count * 2, rhs, step))
+            return false;
+
+        for (int k = 0; k < count; k++)
+        {
+            double move = sqrt(step[k * 2] * step[k * 2] + step[k * 2 + 1] * step[k * 2 + 1]);
+            if (move > m_tolerance)
+                return false;   // Not a small correction of the chords
+            m_points[movable[k] * 2] += step[k * 2];
+            m_points[movable[k] * 2 + 1] += step[k * 2 + 1];
+            stats.largestMove = std::max(stats.largestMove, move);
+        }
+        stats.correctionSteps++;
+    }
+
+    // The moves are below the chord tolerance, but check for folds
+    for (int t = 0; t < (int)m_alive.size(); t++)
+    {
+        const int* tri = &m_triangles[t * 3];
+        if (m_alive[t] && TriangleArea(Point(tri[0]), Point(tri[1]), Point(tri[2])) <= 0)
+            return false;
+    }
+    return true;
+}
+
+void SimplifyMesh::Output(std::vector<double>& vertices2D, std::vector<int>& indices, MeshSimplifyStats& stats) const
+{
+    std::vector<int> remap(m_removed.size(), -1);
+    vertices2D.clear();
+    indices.clear();
+    for (int t = 0; t < (int)m_alive.size(); t++)
+    {
+        if (!m_alive[t])
+            continue;
+        int order[3] = { 0, m_flipped ? 2 : 1, m_flipped ? 1 : 2 };
+        for (int k : order)
+        {
+            int v = m_triangles[t * 3 + k];
+            if (remap[v] < 0)
+            {
+                remap[v] = (int)vertices2D.size() / 2;
+                vertices2D.push_back(m_points[v * 2] + m_shiftX);
+                vertices2D.push_back(m_points[v * 2 + 1] + m_shiftY);
+            }
+            indices.push_back(remap[v]);
+        }
+    }
+    stats.outputTriangles = (int)indices.size() / 3;
+    stats.outputVertices = (int)vertices2D.size() / 2;
+}
+
+bool CMeshSimplifier::Simplify(std::vector<double>& vertices2D, std::vector<int>& indices, double tolerance,
+                               MeshSimplifyStats& stats)
+{
+    stats = MeshSimplifyStats();
+    stats.inputTriangles = (int)indices.size() / 3;
+    if (stats.inputTriangles < 2)
+        return false;
+
+    // Targets come from the mesh as given, about its centroid so that
+    // the second moments are not swamped by the parallel axis terms
+    SectionPolygonMoments raw;
+    for (size_t t = 0; t + 2 < indices.size(); t += 3)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            const double* a = &vertices2D[indices[t + k] * 2];
+            const double* b = &vertices2D[indices[t + (k + 1) % 3] * 2];
+            raw.AddEdge(a[0], a[1], b[0], b[1]);
+        }
+    }
+    if (raw.area == 0)
+        return false;
+    double shiftX = raw.Cx(), shiftY = raw.Cy();
+
+    SectionPolygonMoments centered;
+    double extent = 0;
+    for (size_t t = 0; t + 2 < indices.size(); t += 3)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            const double* a = &vertices2D[indices[t + k] * 2];
+            const double* b = &vertices2D[indices[t + (k + 1) % 3] * 2];
+            centered.AddEdge(a[0] - shiftX, a[1] - shiftY, b[0] - shiftX, b[1] - shiftY);
+            extent = std::max(extent, std::max(fabs(a[0] - shiftX), fabs(a[1] - shiftY)));
+        }
+    }
+    double target[MOMENT_COUNT];
+    MomentVector(centered, target);
+    double sign = (centered.area < 0) ? -1.0 : 1.0;
+    for (int q = 0; q < MOMENT_COUNT; q++)
+        target[q] *= sign;
+    double area = fabs(centered.area);
+    double scale[MOMENT_COUNT] = { area, area * extent, area * extent, area * extent * extent,
+                                   area * extent * extent, area * extent * extent };
+
+    SimplifyMesh mesh;
+    mesh.Build(vertices2D, indices, shiftX, shiftY);
+    mesh.Decimate(tolerance * extent, stats);
+    if (!mesh.Correct(target, scale, stats))
+    {
+        // Some regions cannot keep their moments with fewer boundary points:
+        // no polygon of fewer sides has the area and polar moment of a fine
+        // one inscribed in a circle. Keep only the collapses that leave the
+        // region exactly as it was.
+        int inputTriangles = stats.inputTriangles;
+        stats = MeshSimplifyStats();
+        stats.inputTriangles = inputTriangles;
+        stats.exactOnly = true;
+        mesh = SimplifyMesh();
+        mesh.Build(vertices2D, indices, shiftX, shiftY);
+        mesh.Decimate(0, stats);
+        if (!mesh.Correct(target, scale, stats))
+            return false;
+    }
+
+    mesh.Output(vertices2D, indices, stats);
+    return true;
+}
@@ -0,0 +1,58 @@
+// MeshSimplifier.h: Moment-preserving simplification of section meshes
+//////////////////////////////////////////////////////////////////////
+
+#ifndef MESH_SIMPLIFIER_H
+#define MESH_SIMPLIFIER_H
+
+#include <vector>
+
+struct MeshSimplifyStats
+{
+    int inputTriangles = 0;
+    int outputTriangles = 0;
+    int outputVertices = 0;
+    int boundaryRemoved = 0;    // Boundary vertices collapsed away
+    int correctionSteps = 0;
+    double largestMove = 0;     // Largest vertex move by the correction
+    double residual = 0;        // Largest relative moment error left
+    bool exactOnly = false;     // Boundary kept as it was; see Simplify()
+};
+
+// Shrinks the triangle soup of a planar face to a small indexed mesh
+// with the same area, first and second moments.
+//
+// The soup is welded and then decimated by edge collapse, cheapest
+// first. Interior vertices collapse freely: the region is unchanged, so
+// the moments are too. A boundary vertex collapses into a boundary
+// neighbour when every original point between its neighbours lies
+// within 'tolerance' of the new chord. Vertices at the extreme x and y
+// stay, so extreme fiber distances do not change either. A collapse that
+// would fold a triangle over, or pinch the mesh, is skipped.
+//
+// Cutting chords changes the moments slightly, so the remaining boundary
+// vertices are then moved by the smallest amounts that restore the six
+// moments (area, two first, three second), with Newton steps on their
+// exact polynomial expressions. No move may exceed the tolerance, and
+// vertices that close to the extremes do not move. That is not always
+// possible: of all regions with a given area the disc has the least polar
+// moment, so a coarser polygon in a circle cannot match a fine one. When the
+// correction fails, only the collapses that keep the region exactly (inside
+// and along straight edges) are made.
+class CMeshSimplifier
+{
+public:
+    enum
+    {
+        MAX_CORRECTION_STEPS = 4
+    };
+
+    // Largest boundary deviation as a fraction of the mesh extent
+    static const double DEFAULT_TOLERANCE;
+
+    // Replace the mesh with its simplification. Returns false, leaving the
+    // mesh as it was, if even the exact collapses lose precision.
+    static bool Simplify(std::vector<double>& vertices2D, std::vector<int>& indices, double tolerance,
+                         MeshSimplifyStats& stats);
+};
+
+#endif // MESH_SIMPLIFIER_H
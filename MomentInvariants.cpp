@@ -0,0 +1,76 @@
+// MomentInvariants.cpp: Higher-order central moments and moment invariants
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "MomentInvariants.h"
+
+#include <cmath>
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+void CMomentInvariants::Calculate(const std::vector<double>& vertices2D, const std::vector<int>& indices,
+                                  double Cx, double Cy, SectionShapeMoments& moments)
+{
+    CAreaMomentAccumulator<SHAPE_MOMENT_ORDER> accumulator;
+    accumulator.AddMesh(vertices2D, indices, Cx, Cy);
+
+    // Clockwise meshes sum to a negative area; flip everything together
+    const double* raw = accumulator.GetAll();
+    double sign = (raw[0] < 0) ? -1.0 : 1.0;
+    for (int k = 0; k < AreaMomentCount(SHAPE_MOMENT_ORDER); k++)
+        moments.central[k] = sign * raw[k];
+
+    CalculateInvariants(moments);
+}
+
+void CMomentInvariants::CalculateInvariants(SectionShapeMoments& moments)
+{
+    const double* mu = moments.central;
+    double m00 = mu[AreaMomentIndex(0, 0)];
+    for (int i = 0; i < 7; i++)
+        moments.hu[i] = 0;
+    for (int i = 0; i < 4; i++)
+        moments.affine[i] = 0;
+    if (m00 <= 0)
+        return;
+
+    double u20 = mu[AreaMomentIndex(2, 0)], u11 = mu[AreaMomentIndex(1, 1)], u02 = mu[AreaMomentIndex(0, 2)];
+    double u30 = mu[AreaMomentIndex(3, 0)], u21 = mu[AreaMomentIndex(2, 1)];
+    double u12 = mu[AreaMomentIndex(1, 2)], u03 = mu[AreaMomentIndex(0, 3)];
+
+    // Scale normalized moments: eta_pq = mu_pq / mu00^(1 + (p+q)/2)
+    double s2 = m00 * m00;
+    double s3 = s2 * sqrt(m00);
+    double n20 = u20 / s2, n11 = u11 / s2, n02 = u02 / s2;
+    double n30 = u30 / s3, n21 = u21 / s3, n12 = u12 / s3, n03 = u03 / s3;
+
+    double a = n30 + n12, b = n21 + n03;
+    double c = n30 - 3 * n12, d = 3 * n21 - n03;
+    double* hu = moments.hu;
+    hu[0] = n20 + n02;
+    hu[1] = (n20 - n02) * (n20 - n02) + 4 * n11 * n11;
+    hu[2] = c * c + d * d;
+    hu[3] = a * a + b * b;
+    hu[4] = c * a * (a * a - 3 * b * b) + d * b * (3 * a * a - b * b);
+    hu[5] = (n20 - n02) * (a * a - b * b) + 4 * n11 * a * b;
+    hu[6] = d * a * (a * a - 3 * b * b) - c * b * (3 * a * a - b * b);
+
+    // Affine invariants are normalized by powers of mu00 matching their weight
+    double m4 = s2 * s2, m7 = m4 * s2 * m00, m10 = m7 * s2 * m00, m11 = m10 * m00;
+    double* I = moments.affine;
+    I[0] = (u20 * u02 - u11 * u11) / m4;
+    I[1] = (u30 * u30 * u03 * u03 - 6 * u30 * u21 * u12 * u03 + 4 * u30 * u12 * u12 * u12
+            + 4 * u21 * u21 * u21 * u03 - 3 * u21 * u21 * u12 * u12) / m10;
+    I[2] = (u20 * (u21 * u03 - u12 * u12) - u11 * (u30 * u03 - u21 * u12)
+            + u02 * (u30 * u12 - u21 * u21)) / m7;
+    I[3] = (u20 * u20 * u20 * u03 * u03 - 6 * u20 * u20 * u11 * u12 * u03 - 6 * u20 * u20 * u02 * u21 * u03
+            + 9 * u20 * u20 * u02 * u12 * u12 + 12 * u20 * u11 * u11 * u21 * u03
+            + 6 * u20 * u11 * u02 * u30 * u03 - 18 * u20 * u11 * u02 * u21 * u12
+            - 8 * u11 * u11 * u11 * u30 * u03 - 6 * u20 * u02 * u02 * u30 * u12
+            + 9 * u20 * u02 * u02 * u21 * u21 + 12 * u11 * u11 * u02 * u30 * u12
+            - 6 * u11 * u02 * u02 * u30 * u21 + u02 * u02 * u02 * u30 * u30) / m11;
+}
@@ -0,0 +1,37 @@
+// MomentInvariants.h: Higher-order central moments and moment invariants
+//////////////////////////////////////////////////////////////////////
+
+#ifndef MOMENT_INVARIANTS_H
+#define MOMENT_INVARIANTS_H
+
+#include "AreaMomentAccumulator.h"
+
+// Highest order of the central moments kept per section
+static const int SHAPE_MOMENT_ORDER = 4;
+
+// Central moments of one section and the invariants derived from them
+struct SectionShapeMoments
+{
+    // mu_pq about the centroid in graded order (AreaMomentIndex), positive area
+    double central[AreaMomentCount(SHAPE_MOMENT_ORDER)] = {};
+
+    // Hu's seven invariants: translation, scale and rotation invariant;
+    // hu[6] changes sign under reflection
+    double hu[7] = {};
+
+    // Flusser-Suk affine invariants I1..I4 (orders 2 and 3)
+    double affine[4] = {};
+};
+
+class CMomentInvariants
+{
+public:
+    // Central moments of an indexed 2D mesh about (Cx, Cy), plus invariants
+    static void Calculate(const std::vector<double>& vertices2D, const std::vector<int>& indices,
+                          double Cx, double Cy, SectionShapeMoments& moments);
+
+    // Invariants from central moments up to order 3; leaves zeros if mu00 is 0
+    static void CalculateInvariants(SectionShapeMoments& moments);
+};
+
+#endif // MOMENT_INVARIANTS_H
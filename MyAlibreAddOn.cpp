@@ -4,6 +4,7 @@
 #include "stdafx.h"
 #include "MyAlibreAddOn.h"
 #include "CSampleAddOnInterface.h"
+#include "SharedMetrics.h"
 
 #ifdef _DEBUG
 #define new DEBUG_NEW
@@ -74,6 +75,9 @@ APICLIENTAPP_API void AddOnLoad (HWND windowHandle,
 		theApp.m_pRoot = pHook->GetRoot ();
 	}
 	theApp.m_windowHandle = windowHandle;
+
+	// Health counters for external monitoring; optional
+	CSharedMetrics::Open();
 }
 
 APICLIENTAPP_API void AddOnUnload (HWND windowHandle,
@@ -88,6 +92,8 @@ APICLIENTAPP_API void AddOnUnload (HWND windowHandle,
 	// Release the AddonInterface pointer by setting the reference to the smart pointer to NULL
 	theApp.m_pAddOnInterface = NULL;
 	theApp.m_pRoot = NULL;
+
+	CSharedMetrics::Close();
 }
 
 
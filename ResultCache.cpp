@@ -0,0 +1,402 @@
+// ResultCache.cpp: Machine-wide result cache in a memory-mapped hash table
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "ResultCache.h"
+#include "MomentInvariants.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+static const uint32_t RESULT_CACHE_MAGIC = 0x43524D41;  // "AMRC"
+static const uint32_t RESULT_CACHE_VERSION = 1;
+
+// How long to wait for another process to finish creating the table
+static const int INITIALIZE_WAIT_MS = 200;
+
+// A hit refreshes a slot's recency once it is older than this fraction
+// (a power of two) of the table's stores
+static const int RECENCY_SHIFT = 4;
+
+static uint64_t HashWord(uint64_t hash, uint64_t word)
+{
+    return (hash ^ word) * 1099511628211ULL;
+}
+
+static uint64_t DoubleBits(double value)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+CResultCache::CResultCache()
+    : m_header(nullptr)
+    , m_slots(nullptr)
+    , m_mask(0)
+    , m_mappedBytes(0)
+    , m_writable(false)
+    , m_mapping(nullptr)
+{
+}
+
+CResultCache::~CResultCache()
+{
+    Close();
+}
+
+bool CResultCache::Open(const char* path, uint64_t slotCount)
+{
+    Close();
+
+    uint64_t count = 1;
+    while (count < slotCount)
+        count <<= 1;
+    if (!Map(path, count))
+        return false;
+
+    // A table still being created by another process gets a moment
+    ResultCacheHeader* header = m_header;
+    for (int waited = 0; header->magic.load(std::memory_order_acquire) == 0 && waited < INITIALIZE_WAIT_MS;
+         waited++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    uint64_t slots = header->slotCount;
+    bool valid = header->magic.load(std::memory_order_acquire) == RESULT_CACHE_MAGIC &&
+                 header->version == RESULT_CACHE_VERSION &&
+                 header->headerSize == sizeof(ResultCacheHeader) &&
+                 header->slotSize == sizeof(ResultCacheSlot) &&
+                 slots != 0 && (slots & (slots - 1)) == 0 &&
+                 sizeof(ResultCacheHeader) + slots * sizeof(ResultCacheSlot) <= m_mappedBytes;
+    if (!valid)
+    {
+        Close();
+        return false;
+    }
+
+    m_slots = (ResultCacheSlot*)(header + 1);
+    m_mask = slots - 1;
+    return true;
+}
+
+void CResultCache::Close()
+{
+    if (m_header != nullptr)
+        Unmap();
+    m_header = nullptr;
+    m_slots = nullptr;
+    m_mask = 0;
+    m_mappedBytes = 0;
+    m_writable = false;
+}
+
+#ifdef _WIN32
+bool CResultCache::Map(const char* path, uint64_t slotCount)
+{
+    // Every instance shares the file; read-only if another user created it
+    m_writable = true;
+    HANDLE file = ::CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                                nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        m_writable = false;
+        file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+    }
+
+    LARGE_INTEGER size;
+    bool created = false;
+    if (!::GetFileSizeEx(file, &size))
+    {
+        ::CloseHandle(file);
+        return false;
+    }
+    if (size.QuadPart == 0 && m_writable)
+    {
+        size.QuadPart = (LONGLONG)(sizeof(ResultCacheHeader) + slotCount * sizeof(ResultCacheSlot));
+        if (!::SetFilePointerEx(file, size, nullptr, FILE_BEGIN) || !::SetEndOfFile(file))
+        {
+            ::CloseHandle(file);
+            return false;
+        }
+        created = true;
+    }
+    if (size.QuadPart < (LONGLONG)sizeof(ResultCacheHeader))
+    {
+        ::CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = ::CreateFileMappingA(file, nullptr, m_writable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, nullptr);
+    ::CloseHandle(file);
+    if (mapping == nullptr)
+        return false;
+
+    void* view = ::MapViewOfFile(mapping, m_writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr)
+    {
+        ::CloseHandle(mapping);
+        return false;
+    }
+
+    m_mapping = mapping;
+    m_header = (ResultCacheHeader*)view;
+    m_mappedBytes = (size_t)size.QuadPart;
+    if (created)
+    {
+        m_header->version = RESULT_CACHE_VERSION;
+        m_header->headerSize = sizeof(ResultCacheHeader);
+        m_header->slotSize = sizeof(ResultCacheSlot);
+        m_header->slotCount = slotCount;
+        m_header->magic.store(RESULT_CACHE_MAGIC, std::memory_order_release);
+    }
+    return true;
+}
+
+void CResultCache::Unmap()
+{
+    ::UnmapViewOfFile(m_header);
+    ::CloseHandle((HANDLE)m_mapping);
+    m_mapping = nullptr;
+}
+#else
+bool CResultCache::Map(const char* path, uint64_t slotCount)
+{
+    m_writable = true;
+    int fd = open(path, O_RDWR | O_CREAT, 0666);
+    if (fd < 0)
+    {
+        m_writable = false;
+        fd = open(path, O_RDONLY);
+        if (fd < 0)
+            return false;
+    }
+
+    struct stat info;
+    bool created = false;
+    if (fstat(fd, &info) != 0)
+    {
+        close(fd);
+        return false;
+    }
+    if (info.st_size == 0 && m_writable)
+    {
+        info.st_size = (off_t)(sizeof(ResultCacheHeader) + slotCount * sizeof(ResultCacheSlot));
+        if (ftruncate(fd, info.st_size) != 0)
+        {
+            close(fd);
+            return false;
+        }
+        created = true;
+    }
+    if (info.st_size < (off_t)sizeof(ResultCacheHeader))
+    {
+        close(fd);
+        return false;
+    }
+
+    int protection = m_writable ? PROT_READ | PROT_WRITE : PROT_READ;
+    void* view = mmap(nullptr, (size_t)info.st_size, protection, MAP_SHARED, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED)
+        return false;
+
+    m_header = (ResultCacheHeader*)view;
+    m_mappedBytes = (size_t)info.st_size;
+    if (created)
+    {
+        m_header->version = RESULT_CACHE_VERSION;
+        m_header->headerSize = sizeof(ResultCacheHeader);
+        m_header->slotSize = sizeof(ResultCacheSlot);
+        m_header->slotCount = slotCount;
+        m_header->magic.store(RESULT_CACHE_MAGIC, std::memory_order_release);
+    }
+    return true;
+}
+
+void CResultCache::Unmap()
+{
+    munmap(m_header, m_mappedBytes);
+}
+#endif
+
+uint64_t CResultCache::FingerprintMesh(const std::vector<double>& vertices2D, const std::vector<int>& indices,
+                                       double tolerance)
+{
+    double minX = HUGE_VAL, minY = HUGE_VAL, maxX = -HUGE_VAL, maxY = -HUGE_VAL;
+    for (int index : indices)
+    {
+        minX = std::min(minX, vertices2D[index * 2]);
+        maxX = std::max(maxX, vertices2D[index * 2]);
+        minY = std::min(minY, vertices2D[index * 2 + 1]);
+        maxY = std::max(maxY, vertices2D[index * 2 + 1]);
+    }
+
+    uint64_t hash = 14695981039346656037ULL;
+    double extent = std::max(maxX - minX, maxY - minY);
+    if (indices.empty() || !(extent > 0) || !(tolerance > 0))
+        return hash;
+
+    // Results are in the plane frame, so corners are hashed where they
+    // are, not relative to the mesh. The grid step is a power of two so
+    // that small changes of the extent do not move it.
+    int exponent = 0;
+    frexp(tolerance * extent, &exponent);
+    double step = ldexp(1.0, exponent);
+    hash = HashWord(hash, (uint64_t)(int64_t)exponent);
+    hash = HashWord(hash, indices.size());
+    for (int index : indices)
+    {
+        uint64_t qx = (uint64_t)llround(vertices2D[index * 2] / step);
+        uint64_t qy = (uint64_t)llround(vertices2D[index * 2 + 1] / step);
+        hash = HashWord(HashWord(hash, qx), qy);
+    }
+    return hash;
+}
+
+uint64_t CResultCache::MakeKey(uint64_t fingerprint, const double* settings, int settingCount)
+{
+    uint64_t hash = HashWord(14695981039346656037ULL, fingerprint);
+    for (int i = 0; i < settingCount; i++)
+        hash = HashWord(hash, DoubleBits(settings[i]));
+    hash ^= hash >> 29;
+    return (hash != 0) ? hash : 1;
+}
+
+bool CResultCache::ReadSlot(ResultCacheSlot& slot, uint64_t key, uint64_t* values, uint64_t& computed) const
+{
+    const std::memory_order relaxed = std::memory_order_relaxed;
+    for (int attempt = 0; attempt < READ_ATTEMPTS; attempt++)
+    {
+        uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if ((sequence & 1) != 0)
+            continue;
+
+        if (slot.key.load(relaxed) != key)
+            return false;
+        computed = slot.computed.load(relaxed);
+        for (int v = 0; v < RESULT_CACHE_VALUES; v++)
+            values[v] = slot.values[v].load(relaxed);
+
+        // Nothing above may be reordered past the second sequence load
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(relaxed) == sequence)
+            return true;
+    }
+    return false;
+}
+
+bool CResultCache::Find(uint64_t key, ImGuiAreaMomentsResult& result, SectionShapeMoments& moments)
+{
+    if (m_header == nullptr || key == 0)
+        return false;
+
+    const std::memory_order relaxed = std::memory_order_relaxed;
+    if (m_writable)
+        m_header->lookups.fetch_add(1, relaxed);
+
+    uint64_t values[RESULT_CACHE_VALUES];
+    uint64_t computed = 0;
+    for (int probe = 0; probe < MAX_PROBES; probe++)
+    {
+        ResultCacheSlot& slot = m_slots[(key + probe) & m_mask];
+        uint64_t slotKey = slot.key.load(std::memory_order_acquire);
+        if (slotKey == 0)
+            return false;
+        if (slotKey != key || !ReadSlot(slot, key, values, computed))
+            continue;
+
+        // Recency for eviction; read-only mappings cannot record it. Only
+        // slots that have aged are touched, so hot hits dirty no pages.
+        if (m_writable)
+        {
+            uint64_t now = m_header->clock.load(relaxed);
+            if (now - slot.lastUsed.load(relaxed) > (m_mask >> RECENCY_SHIFT))
+                slot.lastUsed.store(now, relaxed);
+            m_header->hits.fetch_add(1, relaxed);
+        }
+
+        double value;
+        for (int c = 0; c < RESULT_COL_COUNT; c++)
+        {
+            memcpy(&value, &values[c], sizeof(value));
+            CSectionResultStore::SetResultValue(result, c, value);
+        }
+        result.computed = (unsigned int)computed;
+
+        moments = SectionShapeMoments();
+        memcpy(moments.central, &values[RESULT_COL_COUNT], sizeof(moments.central));
+        CMomentInvariants::CalculateInvariants(moments);
+        return true;
+    }
+    return false;
+}
+
+bool CResultCache::Store(uint64_t key, const ImGuiAreaMomentsResult& result, const SectionShapeMoments& moments)
+{
+    if (m_header == nullptr || !m_writable || key == 0)
+        return false;
+
+    const std::memory_order relaxed = std::memory_order_relaxed;
+    uint64_t values[RESULT_CACHE_VALUES];
+    for (int c = 0; c < RESULT_COL_COUNT; c++)
+        values[c] = DoubleBits(CSectionResultStore::GetResultValue(result, c));
+    memcpy(&values[RESULT_COL_COUNT], moments.central, sizeof(moments.central));
+
+    // The key's own slot, else the first empty one, else the least recently used
+    ResultCacheSlot* target = nullptr;
+    for (int probe = 0; probe < MAX_PROBES; probe++)
+    {
+        ResultCacheSlot& slot = m_slots[(key + probe) & m_mask];
+        uint64_t slotKey = slot.key.load(relaxed);
+        if (slotKey == key || slotKey == 0)
+        {
+            target = &slot;
+            break;
+        }
+        if (target == nullptr || slot.lastUsed.load(relaxed) < target->lastUsed.load(relaxed))
+            target = &slot;
+    }
+
+    uint64_t sequence = target->sequence.load(relaxed);
+    if ((sequence & 1) != 0 ||
+        !target->sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_acquire))
+        return false;
+
+    // Pairs with the reader's acquire fence: a reader that sees any of the
+    // stores below also sees the odd sequence, and retries
+    std::atomic_thread_fence(std::memory_order_release);
+
+    uint64_t previous = target->key.load(relaxed);
+    target->key.store(key, relaxed);
+    target->computed.store(result.computed, relaxed);
+    for (int v = 0; v < RESULT_CACHE_VALUES; v++)
+        target->values[v].store(values[v], relaxed);
+    target->lastUsed.store(m_header->clock.fetch_add(1, relaxed) + 1, relaxed);
+    target->sequence.store(sequence + 2, std::memory_order_release);
+
+    m_header->stores.fetch_add(1, relaxed);
+    if (previous == 0)
+        m_header->occupied.fetch_add(1, relaxed);
+    else if (previous != key)
+        m_header->evictions.fetch_add(1, relaxed);
+    return true;
+}
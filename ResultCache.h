@@ -0,0 +1,124 @@
+// ResultCache.h: Machine-wide result cache in a memory-mapped hash table
+//////////////////////////////////////////////////////////////////////
+
+#ifndef RESULT_CACHE_H
+#define RESULT_CACHE_H
+
+#include "SectionPropertyGraph.h"
+#include "SectionResultStore.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Slots are shared between processes, so every word is a lock-free atomic
+static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t), "cache words must be plain words");
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "cache words must be lock free");
+
+enum
+{
+    RESULT_CACHE_SHAPE_VALUES = AreaMomentCount(SHAPE_MOMENT_ORDER),    // Central moments
+    RESULT_CACHE_VALUES = RESULT_COL_COUNT + RESULT_CACHE_SHAPE_VALUES
+};
+
+// File layout: the header, padded to two cache lines, then the slots.
+// Readers check magic, version, headerSize and slotSize.
+struct ResultCacheHeader
+{
+    std::atomic<uint32_t> magic;        // Stored last, once the rest is set
+    uint32_t version;
+    uint32_t headerSize;                // sizeof(ResultCacheHeader)
+    uint32_t slotSize;                  // sizeof(ResultCacheSlot)
+    uint64_t slotCount;                 // Power of two
+    std::atomic<uint64_t> clock;        // Bumped by every store
+    std::atomic<uint64_t> occupied;     // Slots ever filled
+    std::atomic<uint64_t> lookups;
+    std::atomic<uint64_t> hits;
+    std::atomic<uint64_t> stores;
+    std::atomic<uint64_t> evictions;
+    uint8_t reserved[56];
+};
+
+// One result. 'sequence' is a seqlock: odd while a writer fills the slot,
+// and readers retry or give up if it changed under them.
+struct ResultCacheSlot
+{
+    std::atomic<uint64_t> sequence;
+    std::atomic<uint64_t> key;          // 0 = empty
+    std::atomic<uint64_t> lastUsed;     // Header clock at the last store or hit
+    std::atomic<uint64_t> computed;     // SECTION_NODE_BIT mask of the values
+    std::atomic<uint64_t> values[RESULT_CACHE_VALUES];  // Result columns, then mu_pq
+};
+
+static_assert(sizeof(ResultCacheHeader) == 128, "header must keep slots aligned");
+
+// Section results shared by every add-on instance on the machine, across
+// sessions and users, so a library part opened again is not recomputed.
+//
+// The table is a file mapped into each process. A key hashes to a slot
+// and probes at most MAX_PROBES slots after it (linear probing). Slots
+// are never emptied, so a lookup stops at the first empty one. Lookups
+// take no lock: a slot's words are read between two loads of its
+// sequence. A writer claims a slot by moving the sequence from even to
+// odd with a compare-exchange, and skips slots other writers hold. When
+// the probe window is full, the least recently used slot in it is
+// replaced, so the file never grows.
+class CResultCache
+{
+public:
+    enum
+    {
+        DEFAULT_SLOT_COUNT = 1 << 16,   // 20 MB
+        MAX_PROBES = 16,
+        READ_ATTEMPTS = 4               // Seqlock retries before a miss
+    };
+
+    CResultCache();
+    ~CResultCache();
+
+    // Map the table at 'path', creating it with 'slotCount' slots (rounded
+    // up to a power of two) if it does not exist. An existing table keeps
+    // its size. Opens read-only if the file cannot be written.
+    bool Open(const char* path, uint64_t slotCount = DEFAULT_SLOT_COUNT);
+    void Close();
+
+    bool IsOpen() const { return m_header != nullptr; }
+    bool IsWritable() const { return m_writable; }
+
+    // Fingerprint of a mesh's geometry: its corners, triangle by triangle,
+    // on a grid of about 'tolerance' times its extent, so welding the mesh
+    // leaves it unchanged. Meshes that differ by less than the grid mostly
+    // share a fingerprint, which is harmless, as their results agree to
+    // about the same tolerance.
+    static uint64_t FingerprintMesh(const std::vector<double>& vertices2D, const std::vector<int>& indices,
+                                    double tolerance);
+
+    // Key of a fingerprint under the settings that change results. Never 0.
+    static uint64_t MakeKey(uint64_t fingerprint, const double* settings, int settingCount);
+
+    // Fill the cached columns and 'computed' of 'result' and the central
+    // moments and invariants of 'moments'; false on a miss
+    bool Find(uint64_t key, ImGuiAreaMomentsResult& result, SectionShapeMoments& moments);
+
+    // Store a result; false if the table is read-only or every slot of the
+    // key's window is being written
+    bool Store(uint64_t key, const ImGuiAreaMomentsResult& result, const SectionShapeMoments& moments);
+
+    // Shared statistics (all processes)
+    const ResultCacheHeader* GetHeader() const { return m_header; }
+
+private:
+    bool Map(const char* path, uint64_t slotCount);
+    void Unmap();
+    bool ReadSlot(ResultCacheSlot& slot, uint64_t key, uint64_t* values, uint64_t& computed) const;
+
+    ResultCacheHeader* m_header;
+    ResultCacheSlot* m_slots;
+    uint64_t m_mask;
+    size_t m_mappedBytes;
+    bool m_writable;
+    void* m_mapping;        // File mapping handle on Windows
+};
+
+#endif // RESULT_CACHE_H
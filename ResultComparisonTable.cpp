@@ -0,0 +1,511 @@
+// ResultComparisonTable.cpp: Sortable, filterable comparison table of results
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "ResultComparisonTable.h"
+#include "UIFont.h"
+
+#include "imgui/imgui.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+// Columns ahead of the property columns
+static const int TABLE_FIXED_COLUMNS = 3;   // Name, Run, Type
+
+// Format "Ix (cm^4)" style column labels
+static void FormatColumnLabel(char* buf, size_t size, int column, const char* lenUnit)
+{
+    const SectionResultColumnInfo& info = CSectionResultStore::GetColumnInfo(column);
+    if (info.lengthPower == 0)
+        snprintf(buf, size, "%s (deg)", info.name);
+    else if (info.lengthPower == 1)
+        snprintf(buf, size, "%s (%s)", info.name, lenUnit);
+    else
+        snprintf(buf, size, "%s (%s^%d)", info.name, lenUnit, info.lengthPower);
+}
+
+// Format "W (cm^2)" style labels of custom columns; plain numbers get none
+static void FormatCustomLabel(char* buf, size_t size, const SectionCustomColumn& column, const char* lenUnit)
+{
+    int power = column.program.GetLengthPower();
+    if (power == 0)
+        snprintf(buf, size, "%s", column.name.c_str());
+    else if (power == 1)
+        snprintf(buf, size, "%s (%s)", column.name.c_str(), lenUnit);
+    else
+        snprintf(buf, size, "%s (%s^%d)", column.name.c_str(), lenUnit, power);
+}
+
+CResultComparisonTable::CResultComparisonTable()
+    : m_runCount(0)
+    , m_runFilter(RUN_FILTER_ALL)
+    , m_orderVersion(0)
+    , m_orderCustomVersion(0)
+    , m_orderDirty(true)
+    , m_baselineRow(-1)
+    , m_showDeltas(true)
+    , m_newFilterColumn(RESULT_COL_AREA)
+    , m_newFilterMin(0)
+    , m_newFilterMax(0)
+{
+}
+
+double CResultComparisonTable::UnitScale(int column, double lengthFactor)
+{
+    double scale = 1.0;
+    for (int p = 0; p < CSectionResultStore::GetColumnInfo(column).lengthPower; p++)
+        scale *= lengthFactor;
+    return scale;
+}
+
+CSectionResultStore& CResultComparisonTable::Resolve(CSectionResultStore& results, int row, int& index)
+{
+    index = IsArchived(row) ? ArchivedRow(row) : row;
+    return IsArchived(row) ? m_archive : results;
+}
+
+void CResultComparisonTable::ArchiveRun(const CSectionResultStore& results)
+{
+    int run = m_runCount + 1;
+    int first = m_archive.GetRowCount();
+    int baseline = IsArchived(m_baselineRow) ? m_baselineRow : -1;
+
+    ImGuiAreaMomentsResult result;
+    for (int row = 0; row < results.GetRowCount(); row++)
+    {
+        if (!results.HasResult(row))
+            continue;
+
+        results.LoadResult(row, result);
+        result.faceType = results.GetFaceTypeName(results.GetFaceTypeId(row));
+        int index = m_archive.AddRow(results.GetName(row), nullptr);
+        m_archive.SetResult(index, result, nullptr);
+        m_archiveRuns.push_back(run);
+        if (row == m_baselineRow)
+            baseline = ArchivedRow(index);
+    }
+    m_baselineRow = baseline;
+    if (m_archive.GetRowCount() == first)
+        return;
+    m_runCount = run;
+    m_orderDirty = true;
+
+    // Drop whole runs, oldest first, but always keep the one just added
+    int dropped = 0;
+    while (m_archive.GetRowCount() - dropped > MAX_ARCHIVED_ROWS && m_archiveRuns[dropped] != run)
+    {
+        int oldest = m_archiveRuns[dropped];
+        while (m_archiveRuns[dropped] == oldest)
+            dropped++;
+    }
+    if (dropped == 0)
+        return;
+
+    CSectionResultStore kept;
+    for (int index = dropped; index < m_archive.GetRowCount(); index++)
+    {
+        m_archive.LoadResult(index, result);
+        result.faceType = m_archive.GetFaceTypeName(m_archive.GetFaceTypeId(index));
+        kept.SetResult(kept.AddRow(m_archive.GetName(index), nullptr), result, nullptr);
+    }
+    m_archive = std::move(kept);
+    m_archiveRuns.erase(m_archiveRuns.begin(), m_archiveRuns.begin() + dropped);
+
+    if (IsArchived(m_baselineRow))
+    {
+        int index = ArchivedRow(m_baselineRow) - dropped;
+        m_baselineRow = (index >= 0) ? ArchivedRow(index) : -1;
+    }
+    if (m_runFilter > 0 && m_runFilter < m_archiveRuns.front())
+        m_runFilter = RUN_FILTER_ALL;
+}
+
+void CResultComparisonTable::ClearArchive()
+{
+    m_archive.Clear();
+    m_archiveRuns.clear();
+    if (IsArchived(m_baselineRow))
+        m_baselineRow = -1;
+    m_runFilter = RUN_FILTER_ALL;
+    m_orderDirty = true;
+}
+
+size_t CResultComparisonTable::GetArchiveBytes() const
+{
+    return m_archive.GetMemoryBytes() + m_archiveRuns.capacity() * sizeof(int);
+}
+
+void CResultComparisonTable::Render(CSectionResultStore& results, const CSectionCustomColumns& custom,
+                                    double lengthFactor, const char* lenUnit)
+{
+    if (m_baselineRow >= results.GetRowCount() || (m_baselineRow >= 0 && !results.HasResult(m_baselineRow)))
+        m_baselineRow = -1;
+
+    RenderRunFilter();
+    RenderFilters(lengthFactor, lenUnit);
+
+    ImGui::Checkbox("Show deltas against baseline", &m_showDeltas);
+    if (m_baselineRow != -1)
+    {
+        int index;
+        const CSectionResultStore& store = Resolve(results, m_baselineRow, index);
+        ImGui::SameLine();
+        if (IsArchived(m_baselineRow))
+            ImGui::TextDisabled("Baseline: %s (run %d)", store.GetName(index), m_archiveRuns[index]);
+        else
+            ImGui::TextDisabled("Baseline: %s", store.GetName(index));
+        ImGui::SameLine();
+        if (ImGui::SmallButton("Unpin"))
+            m_baselineRow = -1;
+    }
+    else
+    {
+        ImGui::SameLine();
+        ImGui::TextDisabled("(right-click a row to pin it as baseline)");
+    }
+
+    ImGuiTableFlags flags = ImGuiTableFlags_Sortable | ImGuiTableFlags_SortMulti |
+                            ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY |
+                            ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable |
+                            ImGuiTableFlags_Hideable | ImGuiTableFlags_RowBg |
+                            ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV |
+                            ImGuiTableFlags_SizingFixedFit;
+
+    int columnCount = TABLE_FIXED_COLUMNS + RESULT_COL_COUNT + custom.GetCount();
+    if (!ImGui::BeginTable("ComparisonTable", columnCount, flags))
+        return;
+
+    // Keep the header, the name column and the pinned baseline in view
+    ImGui::TableSetupScrollFreeze(1, m_baselineRow != -1 ? 2 : 1);
+    ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_NoHide | ImGuiTableColumnFlags_NoSort);
+    ImGui::TableSetupColumn("Run", ImGuiTableColumnFlags_NoSort);
+    ImGui::TableSetupColumn("Type", ImGuiTableColumnFlags_NoSort);
+    for (int c = 0; c < RESULT_COL_COUNT; c++)
+    {
+        char label[64];
+        FormatColumnLabel(label, sizeof(label), c, lenUnit);
+        ImGui::TableSetupColumn(label, ImGuiTableColumnFlags_None, 0.0f, (ImGuiID)c);
+    }
+    for (int c = 0; c < custom.GetCount(); c++)
+    {
+        char label[96];
+        FormatCustomLabel(label, sizeof(label), custom.GetColumn(c), lenUnit);
+        ImGui::TableSetupColumn(label, ImGuiTableColumnFlags_None, 0.0f, (ImGuiID)(RESULT_COL_COUNT + c));
+    }
+    ImGui::TableHeadersRow();
+
+    if (ImGuiTableSortSpecs* specs = ImGui::TableGetSortSpecs())
+    {
+        if (specs->SpecsDirty)
+        {
+            m_sortKeys.clear();
+            for (int i = 0; i < specs->SpecsCount; i++)
+            {
+                SectionResultSortKey key;
+                key.column = (int)specs->Specs[i].ColumnUserID;
+                key.ascending = (specs->Specs[i].SortDirection != ImGuiSortDirection_Descending);
+                m_sortKeys.push_back(key);
+            }
+            specs->SpecsDirty = false;
+            m_orderDirty = true;
+        }
+    }
+
+    if (m_orderDirty || m_orderVersion != results.GetVersion() || m_orderCustomVersion != custom.GetVersion())
+        UpdateOrder(results, custom);
+
+    if (m_baselineRow != -1)
+        RenderRow(results, custom, m_baselineRow, true, lengthFactor);
+
+    ImGuiListClipper clipper;
+    clipper.Begin((int)m_rows.size());
+    while (clipper.Step())
+    {
+        for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+            RenderRow(results, custom, m_rows[i], false, lengthFactor);
+    }
+
+    ImGui::EndTable();
+}
+
+void CResultComparisonTable::RenderRunFilter()
+{
+    if (m_archiveRuns.empty())
+        return;
+
+    char preview[32];
+    if (m_runFilter == RUN_FILTER_ALL)
+        snprintf(preview, sizeof(preview), "All runs");
+    else if (m_runFilter == RUN_FILTER_CURRENT)
+        snprintf(preview, sizeof(preview), "Run %d (current)", m_runCount + 1);
+    else
+        snprintf(preview, sizeof(preview), "Run %d", m_runFilter);
+
+    int filter = m_runFilter;
+    ImGui::SetNextItemWidth(CUIFont::Scale(200));
+    if (ImGui::BeginCombo("Runs", preview))
+    {
+        if (ImGui::Selectable("All runs", filter == RUN_FILTER_ALL))
+            filter = RUN_FILTER_ALL;
+        char label[32];
+        snprintf(label, sizeof(label), "Run %d (current)", m_runCount + 1);
+        if (ImGui::Selectable(label, filter == RUN_FILTER_CURRENT))
+            filter = RUN_FILTER_CURRENT;
+        for (int run = m_runCount; run >= m_archiveRuns.front(); run--)
+        {
+            snprintf(label, sizeof(label), "Run %d", run);
+            if (ImGui::Selectable(label, filter == run))
+                filter = run;
+        }
+        ImGui::EndCombo();
+    }
+    if (filter != m_runFilter)
+    {
+        m_runFilter = filter;
+        m_orderDirty = true;
+    }
+
+    ImGui::SameLine();
+    ImGui::TextDisabled("%d earlier results", m_archive.GetRowCount());
+    ImGui::SameLine();
+    if (ImGui::SmallButton("Forget earlier runs"))
+        ClearArchive();
+}
+
+void CResultComparisonTable::RenderFilters(double lengthFactor, const char* lenUnit)
+{
+    if (!ImGui::TreeNode("Filters"))
+        return;
+
+    // Active filters
+    for (size_t f = 0; f < m_filters.size(); f++)
+    {
+        const SectionResultFilter& filter = m_filters[f];
+        double scale = UnitScale(filter.column, lengthFactor);
+        char label[64];
+        FormatColumnLabel(label, sizeof(label), filter.column, lenUnit);
+
+        ImGui::PushID((int)f);
+        if (ImGui::SmallButton("x"))
+        {
+            m_filters.erase(m_filters.begin() + f);
+            m_orderDirty = true;
+            ImGui::PopID();
+            break;
+        }
+        ImGui::SameLine();
+        ImGui::Text("%.6g <= %s <= %.6g", filter.minValue * scale, label, filter.maxValue * scale);
+        ImGui::PopID();
+    }
+
+    // New filter, entered in display units
+    ImGui::SetNextItemWidth(CUIFont::Scale(200));
+    if (ImGui::BeginCombo("##FilterColumn", CSectionResultStore::GetColumnInfo(m_newFilterColumn).name))
+    {
+        for (int c = 0; c < RESULT_COL_COUNT; c++)
+        {
+            if (ImGui::Selectable(CSectionResultStore::GetColumnInfo(c).name, c == m_newFilterColumn))
+                m_newFilterColumn = c;
+        }
+        ImGui::EndCombo();
+    }
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(CUIFont::Scale(180));
+    ImGui::InputDouble("##FilterMin", &m_newFilterMin, 0, 0, "min %.6g");
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(CUIFont::Scale(180));
+    ImGui::InputDouble("##FilterMax", &m_newFilterMax, 0, 0, "max %.6g");
+    ImGui::SameLine();
+    if (ImGui::Button("Add Filter") && m_newFilterMax >= m_newFilterMin)
+    {
+        double scale = UnitScale(m_newFilterColumn, lengthFactor);
+        SectionResultFilter filter;
+        filter.column = m_newFilterColumn;
+        filter.minValue = m_newFilterMin / scale;
+        filter.maxValue = m_newFilterMax / scale;
+        m_filters.push_back(filter);
+        m_orderDirty = true;
+    }
+
+    ImGui::TreePop();
+}
+
+void CResultComparisonTable::UpdateOrder(CSectionResultStore& results, const CSectionCustomColumns& custom)
+{
+    bool withCurrent = m_runFilter == RUN_FILTER_ALL || m_runFilter == RUN_FILTER_CURRENT;
+    bool withArchive = m_runFilter != RUN_FILTER_CURRENT && m_archive.GetRowCount() > 0;
+    int liveCount = results.GetRowCount();
+    int archiveCount = m_archive.GetRowCount();
+
+    // Sorting and filtering need the value of their columns on every row
+    for (size_t f = 0; f < m_filters.size(); f++)
+        results.RequireColumn(m_filters[f].column);
+
+    // Earlier runs follow the live rows in one index space while sorting
+    const SectionResultFilter* filters = m_filters.empty() ? nullptr : &m_filters[0];
+    m_rows.clear();
+    if (withCurrent)
+        results.FilterRows(filters, (int)m_filters.size(), m_rows);
+    if (withArchive)
+    {
+        m_archive.FilterRows(filters, (int)m_filters.size(), m_archivedRows);
+        for (int index : m_archivedRows)
+        {
+            if (m_runFilter == RUN_FILTER_ALL || m_archiveRuns[index] == m_runFilter)
+                m_rows.push_back(liveCount + index);
+        }
+    }
+
+    // Custom columns sort on a copy that puts rows without a value last;
+    // result columns need one too when earlier runs are listed
+    std::vector<SectionResultSortKey> keys;
+    m_sortValues.resize(m_sortKeys.size());
+    for (size_t k = 0; k < m_sortKeys.size(); k++)
+    {
+        SectionResultSortKey key = m_sortKeys[k];
+        int customColumn = key.column - RESULT_COL_COUNT;
+        std::vector<double>& values = m_sortValues[k];
+        if (customColumn < 0)
+        {
+            results.RequireColumn(key.column);
+            if (withArchive)
+            {
+                values.resize(liveCount + archiveCount);
+                std::copy(results.GetColumn(key.column), results.GetColumn(key.column) + liveCount, values.begin());
+                std::copy(m_archive.GetColumn(key.column), m_archive.GetColumn(key.column) + archiveCount,
+                          values.begin() + liveCount);
+                key.values = values.data();
+            }
+        }
+        else if (customColumn < custom.GetCount())
+        {
+            values = custom.GetColumn(customColumn).values;
+            double missing = key.ascending ? std::numeric_limits<double>::max() : -std::numeric_limits<double>::max();
+            for (double& value : values)
+                value = (value == value) ? value : missing;
+            values.resize(liveCount + archiveCount, missing);
+            key.values = values.data();
+        }
+        else
+        {
+            continue;   // Removed since the sort was chosen
+        }
+        keys.push_back(key);
+    }
+
+    if (!keys.empty())
+        results.SortRows(&keys[0], (int)keys.size(), m_rows);
+    for (int& row : m_rows)
+    {
+        if (row >= liveCount)
+            row = ArchivedRow(row - liveCount);
+    }
+
+    m_orderVersion = results.GetVersion();
+    m_orderCustomVersion = custom.GetVersion();
+    m_orderDirty = false;
+}
+
+void CResultComparisonTable::RenderValue(double value, const double* base, double scale)
+{
+    if (base == nullptr)
+    {
+        ImGui::Text("%.6g", value * scale);
+        return;
+    }
+
+    double delta = value - *base;
+    ImVec4 color = delta > 0 ? ImVec4(0.5f, 0.9f, 0.5f, 1.0f) :
+                   delta < 0 ? ImVec4(1.0f, 0.55f, 0.45f, 1.0f) :
+                               ImVec4(0.7f, 0.7f, 0.7f, 1.0f);
+    if (fabs(*base) > 1e-12)
+        ImGui::TextColored(color, "%.6g (%+.1f%%)", value * scale, 100.0 * delta / fabs(*base));
+    else
+        ImGui::TextColored(color, "%.6g (%+.4g)", value * scale, delta * scale);
+}
+
+void CResultComparisonTable::RenderRow(CSectionResultStore& results, const CSectionCustomColumns& custom, int row,
+                                       bool isBaseline, double lengthFactor)
+{
+    // Only visible rows get here, so evaluate whatever they still lack;
+    // rows of earlier runs keep what they had
+    int index;
+    CSectionResultStore& store = Resolve(results, row, index);
+    store.RequireNodes(index, SECTION_NODES_ALL);
+    unsigned int computed = store.GetComputed(index);
+    bool withDeltas = m_showDeltas && m_baselineRow != -1 && !isBaseline;
+    int baseIndex = -1;
+    const CSectionResultStore& baseStore = Resolve(results, m_baselineRow, baseIndex);
+
+    ImGui::PushID(isBaseline ? -1 : row);
+    ImGui::TableNextRow();
+    if (isBaseline)
+        ImGui::TableSetBgColor(ImGuiTableBgTarget_RowBg0, ImGui::GetColorU32(ImVec4(0.25f, 0.35f, 0.55f, 0.65f)));
+
+    ImGui::TableSetColumnIndex(0);
+    ImGui::Selectable(store.GetName(index), isBaseline, ImGuiSelectableFlags_SpanAllColumns);
+    if (ImGui::BeginPopupContextItem("RowMenu"))
+    {
+        if (ImGui::MenuItem("Pin as baseline", nullptr, false, !isBaseline))
+            m_baselineRow = row;
+        if (ImGui::MenuItem("Clear baseline", nullptr, false, m_baselineRow != -1))
+            m_baselineRow = -1;
+        ImGui::EndPopup();
+    }
+
+    if (ImGui::TableSetColumnIndex(1))
+        ImGui::Text("%d", IsArchived(row) ? m_archiveRuns[index] : m_runCount + 1);
+
+    ImGui::TableSetColumnIndex(2);
+    ImGui::TextUnformatted(store.GetFaceTypeName(store.GetFaceTypeId(index)).c_str());
+
+    for (int c = 0; c < RESULT_COL_COUNT; c++)
+    {
+        if (!ImGui::TableSetColumnIndex(TABLE_FIXED_COLUMNS + c))
+            continue;
+
+        // Quick rows (and rows without a mesh) leave later nodes unevaluated
+        if ((computed & CSectionResultStore::GetColumnInfo(c).node) == 0)
+        {
+            ImGui::TextDisabled("-");
+            continue;
+        }
+
+        bool baseHasValue = withDeltas &&
+            (baseStore.GetComputed(baseIndex) & CSectionResultStore::GetColumnInfo(c).node) != 0;
+        double base = baseHasValue ? baseStore.Get(c, baseIndex) : 0;
+        RenderValue(store.Get(c, index), baseHasValue ? &base : nullptr, UnitScale(c, lengthFactor));
+    }
+
+    // Custom columns are NaN where a row lacks what they read, and have no
+    // values for earlier runs
+    for (int c = 0; c < custom.GetCount(); c++)
+    {
+        if (!ImGui::TableSetColumnIndex(TABLE_FIXED_COLUMNS + RESULT_COL_COUNT + c))
+            continue;
+
+        const SectionCustomColumn& column = custom.GetColumn(c);
+        double value = IsArchived(row) ? 0 : column.values[row];
+        if (IsArchived(row) || value != value)
+        {
+            ImGui::TextDisabled("-");
+            continue;
+        }
+
+        bool baseLive = withDeltas && !IsArchived(m_baselineRow);
+        double base = baseLive ? column.values[m_baselineRow] : 0;
+        bool baseHasValue = baseLive && base == base;
+        RenderValue(value, baseHasValue ? &base : nullptr, pow(lengthFactor, column.program.GetLengthPower()));
+    }
+
+    ImGui::PopID();
+}
@@ -0,0 +1,92 @@
+// ResultComparisonTable.h: Sortable, filterable comparison table of results
+//////////////////////////////////////////////////////////////////////
+
+#ifndef RESULT_COMPARISON_TABLE_H
+#define RESULT_COMPARISON_TABLE_H
+
+#include "SectionResultStore.h"
+#include "SectionCustomColumns.h"
+#include <vector>
+
+// One row per face, one column per property. Sorting and filtering work on
+// an index permutation over the columnar store and are only redone when the
+// data, the sort specs or the filters change; rows are drawn through a
+// clipper, so only the visible ones cost anything per frame.
+//
+// Results of earlier runs (selections since replaced) are kept in a store of
+// their own, numbered by run, and listed after the current ones unless the
+// run filter picks one run. They hold the values evaluated before the run
+// was replaced; custom columns, which need the live rows, are blank there.
+class CResultComparisonTable
+{
+public:
+    enum
+    {
+        MAX_ARCHIVED_ROWS = 50000,  // Oldest runs are dropped past this
+        RUN_FILTER_ALL = 0,
+        RUN_FILTER_CURRENT = -1     // Else the number of an earlier run
+    };
+
+    CResultComparisonTable();
+
+    // Draw the table, with the custom columns after the result columns
+    // (caller holds the lock protecting 'results' and has updated 'custom')
+    void Render(CSectionResultStore& results, const CSectionCustomColumns& custom, double lengthFactor,
+                const char* lenUnit);
+
+    // Keep the rows with a result before the selection is replaced; a
+    // pinned baseline among them stays pinned
+    void ArchiveRun(const CSectionResultStore& results);
+    void ClearArchive();
+
+    int GetArchivedRowCount() const { return m_archive.GetRowCount(); }
+    size_t GetArchiveBytes() const;
+
+private:
+    // Table rows of earlier runs are encoded as -2 - (row in m_archive),
+    // so they stay apart from live rows and from -1 (none)
+    static bool IsArchived(int row) { return row <= -2; }
+    static int ArchivedRow(int index) { return -2 - index; }
+
+    // Store and row index behind a table row
+    CSectionResultStore& Resolve(CSectionResultStore& results, int row, int& index);
+
+    void RenderRunFilter();
+    void RenderFilters(double lengthFactor, const char* lenUnit);
+    void RenderRow(CSectionResultStore& results, const CSectionCustomColumns& custom, int row, bool isBaseline,
+                   double lengthFactor);
+    void UpdateOrder(CSectionResultStore& results, const CSectionCustomColumns& custom);
+
+    // One value cell, with its change from the baseline if 'base' is given
+    static void RenderValue(double value, const double* base, double scale);
+
+    static double UnitScale(int column, double lengthFactor);
+
+    // Active filters, in internal units so they survive unit changes
+    std::vector<SectionResultFilter> m_filters;
+    std::vector<SectionResultSortKey> m_sortKeys;
+    std::vector<std::vector<double>> m_sortValues;  // Per sort key, scratch
+
+    // Earlier runs: results and the run each row came from
+    CSectionResultStore m_archive;
+    std::vector<int> m_archiveRuns;
+    int m_runCount;     // Runs archived so far; the current one is next
+    int m_runFilter;
+
+    // Filtered and sorted permutation of table rows
+    std::vector<int> m_rows;
+    std::vector<int> m_archivedRows;    // Scratch
+    unsigned int m_orderVersion;
+    unsigned int m_orderCustomVersion;
+    bool m_orderDirty;
+
+    int m_baselineRow;
+    bool m_showDeltas;
+
+    // Filter editor state, in display units
+    int m_newFilterColumn;
+    double m_newFilterMin;
+    double m_newFilterMax;
+};
+
+#endif // RESULT_COMPARISON_TABLE_H
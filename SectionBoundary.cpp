@@ -0,0 +1,266 @@
+// SectionBoundary.cpp: Boundary loops of a section mesh and exact polygon moments
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "SectionBoundary.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+// Points closer than this fraction of the mesh extent are welded
+static const double WELD_TOLERANCE = 1e-9;
+
+struct WeldCell
+{
+    int64_t x, y;
+
+    bool operator==(const WeldCell& other) const { return x == other.x && y == other.y; }
+};
+
+struct WeldCellHash
+{
+    size_t operator()(const WeldCell& cell) const
+    {
+        return (size_t)((uint64_t)cell.x * 0x9E3779B97F4A7C15ULL ^ (uint64_t)cell.y);
+    }
+};
+
+void SectionPolygonMoments::AddEdge(double x0, double y0, double x1, double y1)
+{
+    double cross = x0 * y1 - x1 * y0;
+    area += cross / 2;
+    Qy += (x0 + x1) * cross / 6;
+    Qx += (y0 + y1) * cross / 6;
+    Iyy += (x0 * x0 + x0 * x1 + x1 * x1) * cross / 12;
+    Ixx += (y0 * y0 + y0 * y1 + y1 * y1) * cross / 12;
+    Ixy += (x0 * y1 + 2 * x0 * y0 + 2 * x1 * y1 + x1 * y0) * cross / 24;
+}
+
+void SectionPolygonMoments::Add(const SectionPolygonMoments& other, double sign)
+{
+    area += sign * other.area;
+    Qx += sign * other.Qx;
+    Qy += sign * other.Qy;
+    Ixx += sign * other.Ixx;
+    Iyy += sign * other.Iyy;
+    Ixy += sign * other.Ixy;
+}
+
+void CSectionBoundary::ExtractLoops(const std::vector<double>& vertices2D, const std::vector<int>& indices,
+                                    std::vector<SectionBoundaryLoop>& loops)
+{
+    loops.clear();
+    int vertexCount = (int)vertices2D.size() / 2;
+    if (vertexCount == 0 || indices.size() < 3)
+        return;
+
+    // The soup repeats every shared vertex per triangle
+    std::vector<int> weld, first;
+    WeldVertices(vertices2D, weld, first);
+
+    // Directed edges; an interior edge is also present reversed
+    std::unordered_map<uint64_t, int> edges;
+    edges.reserve(indices.size());
+    int triangleCount = (int)indices.size() / 3;
+    double signedArea = 0;
+    for (int t = 0; t < triangleCount; t++)
+    {
+        int v[3] = { weld[indices[t * 3]], weld[indices[t * 3 + 1]], weld[indices[t * 3 + 2]] };
+        if (v[0] == v[1] || v[1] == v[2] || v[2] == v[0])
+            continue;
+
+        const double* p0 = &vertices2D[first[v[0]] * 2];
+        const double* p1 = &vertices2D[first[v[1]] * 2];
+        const double* p2 = &vertices2D[first[v[2]] * 2];
+        signedArea += (p1[0] - p0[0]) * (p2[1] - p0[1]) - (p2[0] - p0[0]) * (p1[1] - p0[1]);
+
+        for (int k = 0; k < 3; k++)
+        {
+            uint32_t a = (uint32_t)v[k], b = (uint32_t)v[(k + 1) % 3];
+            uint64_t reverse = ((uint64_t)b << 32) | a;
+            auto twin = edges.find(reverse);
+            if (twin != edges.end() && twin->second > 0)
+            {
+                if (--twin->second == 0)
+                    edges.erase(twin);
+            }
+            else
+            {
+                edges[((uint64_t)a << 32) | b]++;
+            }
+        }
+    }
+
+    // Chain the remaining edges from each start vertex
+    std::unordered_multimap<int, int> next;
+    next.reserve(edges.size());
+    for (const auto& edge : edges)
+    {
+        for (int n = 0; n < edge.second; n++)
+            next.emplace((int)(edge.first >> 32), (int)(edge.first & 0xFFFFFFFFu));
+    }
+
+    while (!next.empty())
+    {
+        auto start = next.begin();
+        int from = start->first;
+        int to = start->second;
+        next.erase(start);
+
+        SectionBoundaryLoop loop;
+        loop.points.push_back(vertices2D[first[from] * 2]);
+        loop.points.push_back(vertices2D[first[from] * 2 + 1]);
+        while (to != from)
+        {
+            loop.points.push_back(vertices2D[first[to] * 2]);
+            loop.points.push_back(vertices2D[first[to] * 2 + 1]);
+            auto step = next.find(to);
+            if (step == next.end())
+                break;      // Open chain from a non-manifold mesh; keep what was found
+            to = step->second;
+            next.erase(step);
+        }
+        if (loop.GetCount() >= 3)
+            loops.push_back(std::move(loop));
+    }
+
+    // Clockwise triangles give clockwise outer loops; flip so material is on the left
+    for (SectionBoundaryLoop& loop : loops)
+    {
+        if (signedArea < 0)
+        {
+            int count = loop.GetCount();
+            for (int i = 0; i < count / 2; i++)
+            {
+                std::swap(loop.points[i * 2], loop.points[(count - 1 - i) * 2]);
+                std::swap(loop.points[i * 2 + 1], loop.points[(count - 1 - i) * 2 + 1]);
+            }
+        }
+        loop.hole = LoopArea(loop) < 0;
+    }
+}
+
+void CSectionBoundary::WeldVertices(const std::vector<double>& vertices2D, std::vector<int>& weld,
+                                    std::vector<int>& first)
+{
+    int vertexCount = (int)vertices2D.size() / 2;
+    double extent = 0;
+    for (double v : vertices2D)
+        extent = std::max(extent, fabs(v));
+    double cell = std::max(extent * WELD_TOLERANCE, 1e-300);
+
+    // Points are keyed by grid cell, so welding is exact for the common
+    // case of bit-identical copies and merges only near-identical points
+    std::unordered_map<WeldCell, int, WeldCellHash> cells;
+    cells.reserve(vertexCount);
+    weld.resize(vertexCount);
+    first.clear();
+    for (int i = 0; i < vertexCount; i++)
+    {
+        WeldCell key = { (int64_t)llround(vertices2D[i * 2] / cell), (int64_t)llround(vertices2D[i * 2 + 1] / cell) };
+        auto found = cells.emplace(key, (int)first.size());
+        if (found.second)
+            first.push_back(i);
+        weld[i] = found.first->second;
+    }
+}
+
+void CSectionBoundary::CalculateMoments(const std::vector<SectionBoundaryLoop>& loops, SectionPolygonMoments& moments)
+{
+    moments = SectionPolygonMoments();
+    for (const SectionBoundaryLoop& loop : loops)
+    {
+        int count = loop.GetCount();
+        for (int i = 0; i < count; i++)
+        {
+            int j = (i + 1 == count) ? 0 : i + 1;
+            moments.AddEdge(loop.points[i * 2], loop.points[i * 2 + 1], loop.points[j * 2], loop.points[j * 2 + 1]);
+        }
+    }
+}
+
+double CSectionBoundary::LoopArea(const SectionBoundaryLoop& loop)
+{
+    int count = loop.GetCount();
+    double sum = 0;
+    for (int i = 0; i < count; i++)
+    {
+        int j = (i + 1 == count) ? 0 : i + 1;
+        sum += loop.points[i * 2] * loop.points[j * 2 + 1] - loop.points[j * 2] * loop.points[i * 2 + 1];
+    }
+    return 0.5 * sum;
+}
+
+bool CSectionBoundary::MinimumNormStep(const std::vector<double>& jacobian, int rows, int columns,
+                                       const std::vector<double>& rhs, std::vector<double>& step)
+{
+    // step = J^T (J J^T)^-1 rhs, lightly regularized, by Gaussian
+    // elimination with partial pivoting on the small normal matrix
+    int m = rows, n = columns;
+    std::vector<double> a((size_t)m * m, 0.0), b(rhs.begin(), rhs.begin() + m);
+    double trace = 0;
+    for (int r = 0; r < m; r++)
+    {
+        for (int s = 0; s < m; s++)
+        {
+            double sum = 0;
+            for (int k = 0; k < n; k++)
+                sum += jacobian[r * n + k] * jacobian[s * n + k];
+            a[r * m + s] = sum;
+        }
+        trace += a[r * m + r];
+    }
+    if (!(trace > 0))
+        return false;
+    for (int r = 0; r < m; r++)
+        a[r * m + r] += 1e-12 * trace;
+
+    for (int col = 0; col < m; col++)
+    {
+        int pivot = col;
+        for (int r = col + 1; r < m; r++)
+        {
+            if (fabs(a[r * m + col]) > fabs(a[pivot * m + col]))
+                pivot = r;
+        }
+        if (fabs(a[pivot * m + col]) < 1e-300)
+            return false;
+        if (pivot != col)
+        {
+            for (int k = 0; k < m; k++)
+                std::swap(a[col * m + k], a[pivot * m + k]);
+            std::swap(b[col], b[pivot]);
+        }
+        for (int r = col + 1; r < m; r++)
+        {
+            double f = a[r * m + col] / a[col * m + col];
+            for (int k = col; k < m; k++)
+                a[r * m + k] -= f * a[col * m + k];
+            b[r] -= f * b[col];
+        }
+    }
+    for (int r = m - 1; r >= 0; r--)
+    {
+        for (int k = r + 1; k < m; k++)
+            b[r] -= a[r * m + k] * b[k];
+        b[r] /= a[r * m + r];
+    }
+
+    step.assign(n, 0.0);
+    for (int k = 0; k < n; k++)
+    {
+        double sum = 0;
+        for (int r = 0; r < m; r++)
+            sum += jacobian[r * n + k] * b[r];
+        step[k] = sum;
+    }
+    return true;
+}
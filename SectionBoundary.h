@@ -0,0 +1,65 @@
+// SectionBoundary.h: Boundary loops of a section mesh and exact polygon moments
+//////////////////////////////////////////////////////////////////////
+
+#ifndef SECTION_BOUNDARY_H
+#define SECTION_BOUNDARY_H
+
+#include <vector>
+
+// One closed boundary as interleaved x, y, with the material on the left:
+// outer loops run counter-clockwise and holes clockwise
+struct SectionBoundaryLoop
+{
+    std::vector<double> points;
+    bool hole = false;
+
+    int GetCount() const { return (int)points.size() / 2; }
+};
+
+// Area integrals of a polygonal region, about the coordinate origin
+struct SectionPolygonMoments
+{
+    double area = 0;
+    double Qx = 0, Qy = 0;              // Integrals of y and x
+    double Ixx = 0, Iyy = 0, Ixy = 0;   // Integrals of y^2, x^2 and x y
+
+    // Green's theorem terms of the directed edge (x0, y0) -> (x1, y1)
+    void AddEdge(double x0, double y0, double x1, double y1);
+    void Add(const SectionPolygonMoments& other, double sign = 1.0);
+
+    double Cx() const { return (area != 0) ? Qy / area : 0; }
+    double Cy() const { return (area != 0) ? Qx / area : 0; }
+    double IxCentroid() const { return (area != 0) ? Ixx - Qx * Qx / area : 0; }
+    double IyCentroid() const { return (area != 0) ? Iyy - Qy * Qy / area : 0; }
+    double IxyCentroid() const { return (area != 0) ? Ixy - Qx * Qy / area : 0; }
+};
+
+class CSectionBoundary
+{
+public:
+    // Boundary loops of a triangle soup: vertices shared by position are
+    // welded, edges used by one triangle are boundary edges, and these are
+    // chained into loops. Loops are oriented so the material is on the
+    // left whatever the winding of the triangles; collinear points are kept.
+    static void ExtractLoops(const std::vector<double>& vertices2D, const std::vector<int>& indices,
+                             std::vector<SectionBoundaryLoop>& loops);
+
+    // Exact moments of the region bounded by 'loops'
+    static void CalculateMoments(const std::vector<SectionBoundaryLoop>& loops, SectionPolygonMoments& moments);
+
+    // Signed area of one loop, positive counter-clockwise
+    static double LoopArea(const SectionBoundaryLoop& loop);
+
+    // Merge vertices of a triangle soup that share a position to within
+    // a tiny fraction of the mesh extent: 'weld' maps each vertex to its
+    // merged index and 'first' each merged index to its first vertex
+    static void WeldVertices(const std::vector<double>& vertices2D, std::vector<int>& weld, std::vector<int>& first);
+
+    // Smallest step (least squares) that satisfies the linearized
+    // constraints J step = rhs, for a row-major 'rows' x 'columns' J;
+    // false if J is singular
+    static bool MinimumNormStep(const std::vector<double>& jacobian, int rows, int columns,
+                                const std::vector<double>& rhs, std::vector<double>& step);
+};
+
+#endif // SECTION_BOUNDARY_H
@@ -0,0 +1,213 @@
+// SectionCustomColumns.cpp: User-defined result columns computed from expressions
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "SectionCustomColumns.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+// Longest definition line read back
+static const int MAX_LINE = 1024;
+
+static FILE* OpenColumnsFile(const char* path, const char* mode)
+{
+#ifdef _MSC_VER
+    FILE* file = nullptr;
+    return (fopen_s(&file, path, mode) == 0) ? file : nullptr;
+#else
+    return fopen(path, mode);
+#endif
+}
+
+CSectionCustomColumns::CSectionCustomColumns()
+    : m_resultsVersion(0)
+    , m_resultsRows(0)
+    , m_dirty(true)
+    , m_version(0)
+{
+}
+
+bool CSectionCustomColumns::Open(const char* path)
+{
+    m_path = path;
+    m_columns.clear();
+    m_dirty = true;
+
+    FILE* file = OpenColumnsFile(path, "r");
+    if (file == nullptr)
+        return false;
+
+    char line[MAX_LINE];
+    std::string name, expression;
+    while (fgets(line, sizeof(line), file) != nullptr && (int)m_columns.size() < MAX_COLUMNS)
+    {
+        if (!CSectionExpression::ParseDefinition(line, name, expression))
+            continue;
+
+        SectionCustomColumn column;
+        column.name = name;
+        column.expression = expression;
+        m_columns.push_back(std::move(column));
+    }
+    fclose(file);
+
+    Compile();
+    return true;
+}
+
+bool CSectionCustomColumns::Save() const
+{
+    if (m_path.empty())
+        return false;
+
+    FILE* file = OpenColumnsFile(m_path.c_str(), "w");
+    if (file == nullptr)
+        return false;
+
+    fprintf(file, "# Custom result columns, one \"name = expression\" per line\n");
+    for (const SectionCustomColumn& column : m_columns)
+        fprintf(file, "%s = %s\n", column.name.c_str(), column.expression.c_str());
+    return fclose(file) == 0;
+}
+
+bool CSectionCustomColumns::Add(const char* name, const char* expression, std::string& error)
+{
+    if (!CSectionExpression::IsValidName(name))
+    {
+        error = "Names start with a letter and hold letters, digits and '_'";
+        return false;
+    }
+    for (int c = 0; c < RESULT_COL_COUNT; c++)
+    {
+        if (strcmp(CSectionResultStore::GetColumnInfo(c).identifier, name) == 0)
+        {
+            error = "A result column is already named ";
+            error += name;
+            return false;
+        }
+    }
+    for (const SectionCustomColumn& column : m_columns)
+    {
+        if (column.name == name)
+        {
+            error = "A custom column is already named ";
+            error += name;
+            return false;
+        }
+    }
+    if ((int)m_columns.size() >= MAX_COLUMNS)
+    {
+        error = "Too many custom columns";
+        return false;
+    }
+
+    // Definitions are saved a line each
+    SectionCustomColumn column;
+    column.name = name;
+    column.expression = expression;
+    for (char& c : column.expression)
+    {
+        if (c == '\n' || c == '\r')
+            c = ' ';
+    }
+    m_columns.push_back(std::move(column));
+
+    Compile();
+    Save();
+    error = m_columns.back().error;
+    return true;
+}
+
+void CSectionCustomColumns::Remove(int index)
+{
+    m_columns.erase(m_columns.begin() + index);
+    Compile();
+    Save();
+}
+
+void CSectionCustomColumns::Compile()
+{
+    std::vector<SectionExpressionSymbol> symbols;
+    for (int c = 0; c < RESULT_COL_COUNT; c++)
+    {
+        const SectionResultColumnInfo& info = CSectionResultStore::GetColumnInfo(c);
+        SectionExpressionSymbol symbol = { info.identifier, info.lengthPower };
+        symbols.push_back(symbol);
+    }
+
+    // Earlier columns that compiled can be read by later ones; a broken
+    // one is left out, so the columns reading it report it
+    std::vector<int> symbolColumns(RESULT_COL_COUNT, -1);
+    for (int index = 0; index < (int)m_columns.size(); index++)
+    {
+        SectionCustomColumn& column = m_columns[index];
+        column.nodes = 0;
+        if (!column.program.Compile(column.expression.c_str(), symbols.data(), (int)symbols.size(), column.error))
+            continue;
+
+        for (int input : column.program.GetInputs())
+        {
+            if (input < RESULT_COL_COUNT)
+                column.nodes |= CSectionResultStore::GetColumnInfo(input).node;
+            else
+                column.nodes |= m_columns[symbolColumns[input]].nodes;
+        }
+
+        SectionExpressionSymbol symbol = { column.name.c_str(), column.program.GetLengthPower() };
+        symbols.push_back(symbol);
+        symbolColumns.push_back(index);
+    }
+
+    m_inputColumns.swap(symbolColumns);
+    m_dirty = true;
+}
+
+void CSectionCustomColumns::Update(CSectionResultStore& results)
+{
+    int rowCount = results.GetRowCount();
+    if (!m_dirty && m_resultsVersion == results.GetVersion() && m_resultsRows == rowCount)
+        return;
+
+    std::vector<const double*> inputs(m_inputColumns.size(), nullptr);
+    for (SectionCustomColumn& column : m_columns)
+    {
+        column.values.assign(rowCount, std::numeric_limits<double>::quiet_NaN());
+        if (!column.error.empty())
+            continue;
+
+        for (int row = 0; row < rowCount; row++)
+        {
+            if (results.HasResult(row))
+                results.RequireNodes(row, column.nodes);
+        }
+
+        for (int input : column.program.GetInputs())
+        {
+            inputs[input] = (input < RESULT_COL_COUNT) ? results.GetColumn(input) :
+                            m_columns[m_inputColumns[input]].values.data();
+        }
+        column.program.Evaluate(inputs.data(), rowCount, column.values.data());
+
+        // Rows that lack a node the column reads show no value
+        double* values = column.values.data();
+        for (int row = 0; row < rowCount; row++)
+        {
+            bool available = results.HasResult(row) && (results.GetComputed(row) & column.nodes) == column.nodes;
+            values[row] = available ? values[row] : std::numeric_limits<double>::quiet_NaN();
+        }
+    }
+
+    m_resultsVersion = results.GetVersion();
+    m_resultsRows = rowCount;
+    m_dirty = false;
+    m_version++;
+}
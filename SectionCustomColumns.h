@@ -0,0 +1,78 @@
+// SectionCustomColumns.h: User-defined result columns computed from expressions
+//////////////////////////////////////////////////////////////////////
+
+#ifndef SECTION_CUSTOM_COLUMNS_H
+#define SECTION_CUSTOM_COLUMNS_H
+
+#include "SectionExpression.h"
+#include "SectionResultStore.h"
+#include <vector>
+#include <string>
+
+// One user-defined column, e.g. "W = A / cm^2 * 0.785" (kg/m of steel)
+struct SectionCustomColumn
+{
+    std::string name;
+    std::string expression;
+    std::string error;              // Why it does not compile; empty if it does
+    CSectionExpression program;
+    unsigned int nodes = 0;         // SECTION_NODE_BIT mask of the results it reads,
+                                    // including through other custom columns
+    std::vector<double> values;     // Per row, cm units; NaN where not available
+};
+
+// Columns defined by expressions over the result columns (by their
+// identifiers, e.g. A, Ix, Sx, c_y) and earlier custom columns. They are
+// shown in the comparison table and the copied results and kept in a text
+// file of "name = expression" lines, which tools/SectionLibraryTool reads
+// too.
+//
+// Each column is compiled once when it is defined and evaluated over the
+// whole store, column-wise, when the results change. Rows without the
+// graph nodes a column needs (quick rows) get NaN.
+class CSectionCustomColumns
+{
+public:
+    enum
+    {
+        MAX_COLUMNS = 64
+    };
+
+    CSectionCustomColumns();
+
+    // Load the definitions in 'path', if it exists, and save every change to it
+    bool Open(const char* path);
+
+    // Add a column. Fails if the name is not a valid identifier or is taken;
+    // an expression that does not compile is kept, with its error, so the
+    // definition is not lost.
+    bool Add(const char* name, const char* expression, std::string& error);
+    void Remove(int index);
+
+    int GetCount() const { return (int)m_columns.size(); }
+    const SectionCustomColumn& GetColumn(int index) const { return m_columns[index]; }
+
+    // Evaluate every column over 'results' if the rows or the definitions
+    // changed, evaluating the graph nodes the columns read (caller holds
+    // the lock protecting 'results')
+    void Update(CSectionResultStore& results);
+
+    // Bumped whenever the values change
+    unsigned int GetVersion() const { return m_version; }
+
+private:
+    // Compile every column in order, since a column may read earlier ones
+    void Compile();
+    bool Save() const;
+
+    std::vector<SectionCustomColumn> m_columns;
+    std::vector<int> m_inputColumns;    // Custom column behind each expression
+                                        // symbol past the result columns
+    std::string m_path;
+    unsigned int m_resultsVersion;
+    int m_resultsRows;
+    bool m_dirty;
+    unsigned int m_version;
+};
+
+#endif // SECTION_CUSTOM_COLUMNS_H
@@ -0,0 +1,930 @@
+// SectionExpression.cpp: Compiled expressions over section result columns
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "SectionExpression.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdarg>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+static const double EXPR_PI = 3.14159265358979323846;
+
+// Length units, in cm
+struct ExpressionUnit
+{
+    const char* name;
+    double cm;
+};
+
+static const ExpressionUnit s_units[] =
+{
+    { "mm", 0.1 },
+    { "cm", 1.0 },
+    { "m",  100.0 },
+    { "in", 2.54 },
+    { "ft", 30.48 },
+};
+
+struct ExpressionFunction
+{
+    const char* name;
+    int op;
+    int arity;
+};
+
+static const ExpressionFunction s_functions[] =
+{
+    { "sqrt",  EXPR_OP_SQRT,  1 },
+    { "abs",   EXPR_OP_ABS,   1 },
+    { "exp",   EXPR_OP_EXP,   1 },
+    { "log",   EXPR_OP_LOG,   1 },
+    { "log10", EXPR_OP_LOG10, 1 },
+    { "floor", EXPR_OP_FLOOR, 1 },
+    { "ceil",  EXPR_OP_CEIL,  1 },
+    { "min",   EXPR_OP_MIN,   2 },
+    { "max",   EXPR_OP_MAX,   2 },
+    { "pow",   EXPR_OP_POW,   2 },
+};
+
+static const int FUNCTION_COUNT = (int)(sizeof(s_functions) / sizeof(s_functions[0]));
+static const int UNIT_COUNT = (int)(sizeof(s_units) / sizeof(s_units[0]));
+
+static const ExpressionUnit* FindUnit(const char* name, size_t length)
+{
+    for (int u = 0; u < UNIT_COUNT; u++)
+    {
+        if (strlen(s_units[u].name) == length && strncmp(s_units[u].name, name, length) == 0)
+            return &s_units[u];
+    }
+    return nullptr;
+}
+
+static const ExpressionFunction* FindFunction(const char* name, size_t length)
+{
+    for (int f = 0; f < FUNCTION_COUNT; f++)
+    {
+        if (strlen(s_functions[f].name) == length && strncmp(s_functions[f].name, name, length) == 0)
+            return &s_functions[f];
+    }
+    return nullptr;
+}
+
+static bool IsNameStart(char c)
+{
+    return isalpha((unsigned char)c) || c == '_';
+}
+
+static bool IsNameChar(char c)
+{
+    return isalnum((unsigned char)c) || c == '_';
+}
+
+static bool IsBinaryOp(int op)
+{
+    return op >= EXPR_OP_ADD && op <= EXPR_OP_OR;
+}
+
+// Scalar semantics of every operation; the column loops in Evaluate()
+// must agree with these, since constant subexpressions are folded here
+static double ApplyOp(int op, double a, double b, double c)
+{
+    switch (op)
+    {
+    case EXPR_OP_NEG:    return -a;
+    case EXPR_OP_NOT:    return a == 0 ? 1.0 : 0.0;
+    case EXPR_OP_SQUARE: return a * a;
+    case EXPR_OP_SQRT:   return sqrt(a);
+    case EXPR_OP_ABS:    return fabs(a);
+    case EXPR_OP_EXP:    return exp(a);
+    case EXPR_OP_LOG:    return log(a);
+    case EXPR_OP_LOG10:  return log10(a);
+    case EXPR_OP_FLOOR:  return floor(a);
+    case EXPR_OP_CEIL:   return ceil(a);
+    case EXPR_OP_ADD:    return a + b;
+    case EXPR_OP_SUB:    return a - b;
+    case EXPR_OP_MUL:    return a * b;
+    case EXPR_OP_DIV:    return a / b;
+    case EXPR_OP_POW:    return pow(a, b);
+    case EXPR_OP_MIN:    return b < a ? b : a;
+    case EXPR_OP_MAX:    return b > a ? b : a;
+    case EXPR_OP_LT:     return a < b ? 1.0 : 0.0;
+    case EXPR_OP_LE:     return a <= b ? 1.0 : 0.0;
+    case EXPR_OP_GT:     return a > b ? 1.0 : 0.0;
+    case EXPR_OP_GE:     return a >= b ? 1.0 : 0.0;
+    case EXPR_OP_EQ:     return a == b ? 1.0 : 0.0;
+    case EXPR_OP_NE:     return a != b ? 1.0 : 0.0;
+    case EXPR_OP_AND:    return (a != 0 && b != 0) ? 1.0 : 0.0;
+    case EXPR_OP_OR:     return (a != 0 || b != 0) ? 1.0 : 0.0;
+    case EXPR_OP_SELECT: return a != 0 ? b : c;
+    default:             return 0;
+    }
+}
+
+// Operation with the operands swapped, or -1 if there is none
+static int SwappedOp(int op)
+{
+    switch (op)
+    {
+    case EXPR_OP_ADD: case EXPR_OP_MUL: case EXPR_OP_MIN: case EXPR_OP_MAX:
+    case EXPR_OP_EQ: case EXPR_OP_NE: case EXPR_OP_AND: case EXPR_OP_OR:
+        return op;
+    case EXPR_OP_LT: return EXPR_OP_GT;
+    case EXPR_OP_LE: return EXPR_OP_GE;
+    case EXPR_OP_GT: return EXPR_OP_LT;
+    case EXPR_OP_GE: return EXPR_OP_LE;
+    default:         return -1;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// Parser
+
+struct ExpressionNode
+{
+    int op;                 // SectionExpressionOp
+    int child[3];
+    int input;              // EXPR_OP_LOAD
+    double value;           // EXPR_OP_CONST
+    int lengthPower;
+    int height;             // Nodes on the longest path to a leaf
+};
+
+// Recursive descent over the grammar in SectionExpression.h, building a
+// tree with a dimension on every node and constant nodes folded
+class CExpressionParser
+{
+public:
+    CExpressionParser(const char* text, const SectionExpressionSymbol* symbols, int symbolCount)
+        : m_text(text), m_pos(text), m_symbols(symbols), m_symbolCount(symbolCount), m_depth(0)
+    {
+    }
+
+    int Parse()
+    {
+        int root = ParseSelect();
+        SkipSpace();
+        if (root >= 0 && *m_pos != '\0')
+            return Fail("Unexpected '%c'", *m_pos);
+        return root;
+    }
+
+    std::vector<ExpressionNode> m_nodes;
+    std::string m_error;
+
+private:
+    int Fail(const char* format, ...);
+
+    void SkipSpace()
+    {
+        while (isspace((unsigned char)*m_pos))
+            m_pos++;
+    }
+
+    bool Accept(const char* token)
+    {
+        SkipSpace();
+        size_t length = strlen(token);
+        if (strncmp(m_pos, token, length) != 0)
+            return false;
+        m_pos += length;
+        return true;
+    }
+
+    bool IsZero(int node) const
+    {
+        return m_nodes[node].op == EXPR_OP_CONST && m_nodes[node].value == 0;
+    }
+
+    int MakeConst(double value, int lengthPower);
+    int MakeNode(int op, int a, int b, int c, int lengthPower);
+    int MakeUnary(int op, int a);
+    int MakeBinary(int op, int a, int b);
+    int MakeSelect(int condition, int a, int b);
+
+    int ParseSelect();
+    int ParseOr();
+    int ParseAnd();
+    int ParseCompare();
+    int ParseSum();
+    int ParseProduct();
+    int ParseUnary();
+    int ParsePower();
+    int ParsePrimary();
+    int ParseName();
+
+    const char* m_text;
+    const char* m_pos;
+    const SectionExpressionSymbol* m_symbols;
+    int m_symbolCount;
+    int m_depth;
+};
+
+int CExpressionParser::Fail(const char* format, ...)
+{
+    if (!m_error.empty())
+        return -1;
+
+    char message[160];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(message, sizeof(message), format, args);
+    va_end(args);
+
+    char where[32];
+    snprintf(where, sizeof(where), " at %d", (int)(m_pos - m_text) + 1);
+    m_error = message;
+    m_error += where;
+    return -1;
+}
+
+int CExpressionParser::MakeConst(double value, int lengthPower)
+{
+    ExpressionNode node = { EXPR_OP_CONST, { -1, -1, -1 }, -1, value, lengthPower, 1 };
+    m_nodes.push_back(node);
+    return (int)m_nodes.size() - 1;
+}
+
+int CExpressionParser::MakeNode(int op, int a, int b, int c, int lengthPower)
+{
+    // Fold operations on constants
+    if (m_nodes[a].op == EXPR_OP_CONST && (b < 0 || m_nodes[b].op == EXPR_OP_CONST) &&
+        (c < 0 || m_nodes[c].op == EXPR_OP_CONST))
+    {
+        double value = ApplyOp(op, m_nodes[a].value, b >= 0 ? m_nodes[b].value : 0, c >= 0 ? m_nodes[c].value : 0);
+        return MakeConst(value, lengthPower);
+    }
+
+    // The emitter recurses once per level, and a long chain such as
+    // A+A+...+A nests without parentheses
+    int children[3] = { a, b, c };
+    int height = 0;
+    for (int child : children)
+        height = std::max(height, child >= 0 ? m_nodes[child].height : 0);
+    if (++height > CSectionExpression::MAX_TREE_DEPTH)
+        return Fail("Expression nested too deeply");
+
+    ExpressionNode node = { op, { a, b, c }, -1, 0, lengthPower, height };
+    m_nodes.push_back(node);
+    return (int)m_nodes.size() - 1;
+}
+
+int CExpressionParser::MakeUnary(int op, int a)
+{
+    if (a < 0)
+        return -1;
+
+    int power = m_nodes[a].lengthPower;
+    switch (op)
+    {
+    case EXPR_OP_NOT:
+        return MakeNode(op, a, -1, -1, 0);
+    case EXPR_OP_SQUARE:
+        return MakeNode(op, a, -1, -1, power * 2);
+    case EXPR_OP_SQRT:
+        if (power % 2 != 0)
+            return Fail("sqrt of length^%d", power);
+        return MakeNode(op, a, -1, -1, power / 2);
+    case EXPR_OP_EXP: case EXPR_OP_LOG: case EXPR_OP_LOG10: case EXPR_OP_FLOOR: case EXPR_OP_CEIL:
+        // These would depend on the unit; divide by one first, e.g. floor(c_y / mm)
+        if (power != 0)
+            return Fail("Function of length^%d; divide it by a unit first", power);
+        return MakeNode(op, a, -1, -1, 0);
+    default:
+        return MakeNode(op, a, -1, -1, power);
+    }
+}
+
+int CExpressionParser::MakeBinary(int op, int a, int b)
+{
+    if (a < 0 || b < 0)
+        return -1;
+
+    int powerA = m_nodes[a].lengthPower, powerB = m_nodes[b].lengthPower;
+    switch (op)
+    {
+    case EXPR_OP_MUL:
+        return MakeNode(op, a, b, -1, powerA + powerB);
+    case EXPR_OP_DIV:
+        return MakeNode(op, a, b, -1, powerA - powerB);
+    case EXPR_OP_AND: case EXPR_OP_OR:
+        return MakeNode(op, a, b, -1, 0);
+    case EXPR_OP_POW:
+    {
+        if (powerB != 0)
+            return Fail("Exponent of length^%d", powerB);
+        if (m_nodes[b].op == EXPR_OP_CONST)
+        {
+            double exponent = m_nodes[b].value;
+            if (exponent == 1)
+                return a;
+            if (exponent == 2)
+                return MakeUnary(EXPR_OP_SQUARE, a);
+            if (exponent == 0.5)
+                return MakeUnary(EXPR_OP_SQRT, a);
+
+            double power = powerA * exponent;
+            if (fabs(power - floor(power + 0.5)) > 1e-9 || fabs(power) > 64)
+                return Fail("Power of length^%d to %g", powerA, exponent);
+            return MakeNode(op, a, b, -1, (int)floor(power + 0.5));
+        }
+        if (powerA != 0)
+            return Fail("Power of length^%d needs a constant exponent", powerA);
+        return MakeNode(op, a, b, -1, 0);
+    }
+    default:
+    {
+        // Sums, comparisons, min and max need one dimension; 0 fits any
+        int power = IsZero(a) ? powerB : powerA;
+        if (powerA != powerB && !IsZero(a) && !IsZero(b))
+            return Fail("Mixed dimensions, length^%d and length^%d", powerA, powerB);
+        bool compare = op >= EXPR_OP_LT && op <= EXPR_OP_NE;
+        return MakeNode(op, a, b, -1, compare ? 0 : power);
+    }
+    }
+}
+
+int CExpressionParser::MakeSelect(int condition, int a, int b)
+{
+    if (condition < 0 || a < 0 || b < 0)
+        return -1;
+
+    int powerA = m_nodes[a].lengthPower, powerB = m_nodes[b].lengthPower;
+    if (powerA != powerB && !IsZero(a) && !IsZero(b))
+        return Fail("Branches of length^%d and length^%d", powerA, powerB);
+    return MakeNode(EXPR_OP_SELECT, condition, a, b, IsZero(a) ? powerB : powerA);
+}
+
+int CExpressionParser::ParseSelect()
+{
+    if (++m_depth > CSectionExpression::MAX_DEPTH)
+        return Fail("Expression nested too deeply");
+
+    int condition = ParseOr();
+    if (condition >= 0 && Accept("?"))
+    {
+        int a = ParseSelect();
+        if (a >= 0 && !Accept(":"))
+            a = Fail("Expected ':'");
+        int b = (a >= 0) ? ParseSelect() : -1;
+        condition = MakeSelect(condition, a, b);
+    }
+    m_depth--;
+    return condition;
+}
+
+int CExpressionParser::ParseOr()
+{
+    int a = ParseAnd();
+    while (a >= 0 && Accept("||"))
+        a = MakeBinary(EXPR_OP_OR, a, ParseAnd());
+    return a;
+}
+
+int CExpressionParser::ParseAnd()
+{
+    int a = ParseCompare();
+    while (a >= 0 && Accept("&&"))
+        a = MakeBinary(EXPR_OP_AND, a, ParseCompare());
+    return a;
+}
+
+int CExpressionParser::ParseCompare()
+{
+    // Two-character operators first
+    static const struct { const char* token; int op; } compares[] =
+    {
+        { "<=", EXPR_OP_LE }, { ">=", EXPR_OP_GE }, { "==", EXPR_OP_EQ }, { "!=", EXPR_OP_NE },
+        { "<", EXPR_OP_LT }, { ">", EXPR_OP_GT },
+    };
+
+    int a = ParseSum();
+    while (a >= 0)
+    {
+        int op = -1;
+        for (const auto& compare : compares)
+        {
+            if (Accept(compare.token))
+            {
+                op = compare.op;
+                break;
+            }
+        }
+        if (op < 0)
+            break;
+        a = MakeBinary(op, a, ParseSum());
+    }
+    return a;
+}
+
+int CExpressionParser::ParseSum()
+{
+    int a = ParseProduct();
+    while (a >= 0)
+    {
+        if (Accept("+"))
+            a = MakeBinary(EXPR_OP_ADD, a, ParseProduct());
+        else if (Accept("-"))
+            a = MakeBinary(EXPR_OP_SUB, a, ParseProduct());
+        else
+            break;
+    }
+    return a;
+}
+
+int CExpressionParser::ParseProduct()
+{
+    int a = ParseUnary();
+    while (a >= 0)
+    {
+        if (Accept("*"))
+            a = MakeBinary(EXPR_OP_MUL, a, ParseUnary());
+        else if (Accept("/"))
+            a = MakeBinary(EXPR_OP_DIV, a, ParseUnary());
+        else
+            break;
+    }
+    return a;
+}
+
+int CExpressionParser::ParseUnary()
+{
+    if (++m_depth > CSectionExpression::MAX_DEPTH)
+        return Fail("Expression nested too deeply");
+
+    int a;
+    if (Accept("-"))
+        a = MakeUnary(EXPR_OP_NEG, ParseUnary());
+    else if (Accept("+"))
+        a = ParseUnary();
+    else if (Accept("!"))
+        a = MakeUnary(EXPR_OP_NOT, ParseUnary());
+    else
+        a = ParsePower();
+    m_depth--;
+    return a;
+}
+
+int CExpressionParser::ParsePower()
+{
+    // Right associative, and binds tighter than unary minus on its left
+    int a = ParsePrimary();
+    if (a >= 0 && Accept("^"))
+        a = MakeBinary(EXPR_OP_POW, a, ParseUnary());
+    return a;
+}
+
+int CExpressionParser::ParsePrimary()
+{
+    SkipSpace();
+    if (Accept("("))
+    {
+        int a = ParseSelect();
+        if (a >= 0 && !Accept(")"))
+            return Fail("Expected ')'");
+        return a;
+    }
+
+    if (isdigit((unsigned char)*m_pos) || (*m_pos == '.' && isdigit((unsigned char)m_pos[1])))
+    {
+        // Only decimal literals; strtod would also take hex, inf and nan
+        const char* end = m_pos;
+        while (isdigit((unsigned char)*end) || *end == '.')
+            end++;
+        if ((*end == 'e' || *end == 'E') &&
+            (isdigit((unsigned char)end[1]) || ((end[1] == '+' || end[1] == '-') && isdigit((unsigned char)end[2]))))
+        {
+            end += 2;
+            while (isdigit((unsigned char)*end))
+                end++;
+        }
+
+        std::string literal(m_pos, end);
+        char* parsed = nullptr;
+        double value = strtod(literal.c_str(), &parsed);
+        if (parsed != literal.c_str() + literal.size())
+            return Fail("Bad number '%s'", literal.c_str());
+        m_pos = end;
+
+        // "25 mm" is 25 times a millimetre, and "250 cm^3" 250 times a
+        // cubic centimetre
+        SkipSpace();
+        const char* name = m_pos;
+        while (IsNameChar(*m_pos))
+            m_pos++;
+        const ExpressionUnit* unit = FindUnit(name, m_pos - name);
+        if (unit == nullptr)
+        {
+            m_pos = name;
+            return MakeConst(value, 0);
+        }
+        int scale = MakeConst(unit->cm, 1);
+        if (Accept("^"))
+            scale = MakeBinary(EXPR_OP_POW, scale, ParseUnary());
+        return MakeBinary(EXPR_OP_MUL, MakeConst(value, 0), scale);
+    }
+
+    if (IsNameStart(*m_pos))
+        return ParseName();
+    if (*m_pos == '\0')
+        return Fail("Unexpected end");
+    return Fail("Unexpected '%c'", *m_pos);
+}
+
+int CExpressionParser::ParseName()
+{
+    const char* name = m_pos;
+    while (IsNameChar(*m_pos))
+        m_pos++;
+    size_t length = m_pos - name;
+    std::string text(name, length);
+
+    const ExpressionFunction* function = FindFunction(name, length);
+    if (function != nullptr && Accept("("))
+    {
+        int args[2] = { -1, -1 };
+        for (int i = 0; i < function->arity; i++)
+        {
+            if (i > 0 && !Accept(","))
+                return Fail("%s takes %d arguments", function->name, function->arity);
+            args[i] = ParseSelect();
+            if (args[i] < 0)
+                return -1;
+        }
+        if (!Accept(")"))
+            return Fail("Expected ')' after %s arguments", function->name);
+        return function->arity == 1 ? MakeUnary(function->op, args[0]) : MakeBinary(function->op, args[0], args[1]);
+    }
+
+    for (int s = 0; s < m_symbolCount; s++)
+    {
+        if (text == m_symbols[s].name)
+        {
+            ExpressionNode node = { EXPR_OP_LOAD, { -1, -1, -1 }, s, 0, m_symbols[s].lengthPower, 1 };
+            m_nodes.push_back(node);
+            return (int)m_nodes.size() - 1;
+        }
+    }
+
+    if (text == "pi")
+        return MakeConst(EXPR_PI, 0);
+    const ExpressionUnit* unit = FindUnit(name, length);
+    if (unit != nullptr)
+        return MakeConst(unit->cm, 1);
+
+    m_pos = name;
+    if (function != nullptr)
+        return Fail("Expected '(' after %s", function->name);
+    return Fail("Unknown name '%s'", text.c_str());
+}
+
+//////////////////////////////////////////////////////////////////////
+// Code generation
+
+// Emits the tree in postfix order, fusing constant and input right
+// operands into their operation
+class CExpressionEmitter
+{
+public:
+    CExpressionEmitter(const std::vector<ExpressionNode>& nodes, std::vector<SectionExpressionInstruction>& code,
+                       std::vector<double>& constants)
+        : m_nodes(nodes), m_code(code), m_constants(constants), m_depth(0), m_maxDepth(0)
+    {
+    }
+
+    void Emit(int index)
+    {
+        const ExpressionNode& node = m_nodes[index];
+        if (node.op == EXPR_OP_CONST || node.op == EXPR_OP_LOAD)
+        {
+            Push(node.op, EXPR_OPERAND_STACK, Operand(node));
+            Grow(1);
+            return;
+        }
+
+        if (!IsBinaryOp(node.op))
+        {
+            for (int c = 0; c < 3 && node.child[c] >= 0; c++)
+                Emit(node.child[c]);
+            Push(node.op, EXPR_OPERAND_STACK, 0);
+            Grow(node.op == EXPR_OP_SELECT ? -2 : 0);
+            return;
+        }
+
+        // A leaf on the left of a symmetric operation goes to the right
+        int op = node.op, a = node.child[0], b = node.child[1];
+        if (IsLeaf(a) && !IsLeaf(b) && SwappedOp(op) >= 0)
+        {
+            op = SwappedOp(op);
+            std::swap(a, b);
+        }
+
+        Emit(a);
+        if (IsLeaf(b))
+        {
+            const ExpressionNode& right = m_nodes[b];
+            int operand = right.op == EXPR_OP_CONST ? EXPR_OPERAND_CONST : EXPR_OPERAND_INPUT;
+            Push(op, operand, Operand(right));
+            return;
+        }
+        Emit(b);
+        Push(op, EXPR_OPERAND_STACK, 0);
+        Grow(-1);
+    }
+
+    int GetMaxDepth() const { return m_maxDepth; }
+
+private:
+    bool IsLeaf(int index) const
+    {
+        return m_nodes[index].op == EXPR_OP_CONST || m_nodes[index].op == EXPR_OP_LOAD;
+    }
+
+    int Operand(const ExpressionNode& node)
+    {
+        if (node.op == EXPR_OP_LOAD)
+            return node.input;
+        m_constants.push_back(node.value);
+        return (int)m_constants.size() - 1;
+    }
+
+    void Push(int op, int operand, int index)
+    {
+        SectionExpressionInstruction instruction = { (uint8_t)op, (uint8_t)operand, (uint16_t)index };
+        m_code.push_back(instruction);
+    }
+
+    void Grow(int delta)
+    {
+        m_depth += delta;
+        m_maxDepth = std::max(m_maxDepth, m_depth);
+    }
+
+    const std::vector<ExpressionNode>& m_nodes;
+    std::vector<SectionExpressionInstruction>& m_code;
+    std::vector<double>& m_constants;
+    int m_depth;
+    int m_maxDepth;
+};
+
+//////////////////////////////////////////////////////////////////////
+// CSectionExpression
+
+CSectionExpression::CSectionExpression()
+    : m_stackDepth(0)
+    , m_lengthPower(0)
+{
+}
+
+bool CSectionExpression::Compile(const char* text, const SectionExpressionSymbol* symbols, int symbolCount,
+                                 std::string& error)
+{
+    m_code.clear();
+    m_constants.clear();
+    m_inputs.clear();
+    m_stackDepth = 0;
+    m_lengthPower = 0;
+    error.clear();
+
+    if (symbolCount > MAX_SYMBOLS)
+    {
+        error = "Too many columns";
+        return false;
+    }
+
+    CExpressionParser parser(text, symbols, symbolCount);
+    int root = parser.Parse();
+    if (root < 0)
+    {
+        error = parser.m_error;
+        return false;
+    }
+
+    std::vector<SectionExpressionInstruction> code;
+    std::vector<double> constants;
+    CExpressionEmitter emitter(parser.m_nodes, code, constants);
+    emitter.Emit(root);
+    if (constants.size() > 0xFFFF)
+    {
+        error = "Expression too long";
+        return false;
+    }
+
+    for (const SectionExpressionInstruction& instruction : code)
+    {
+        if (instruction.op == EXPR_OP_LOAD || instruction.operand == EXPR_OPERAND_INPUT)
+            m_inputs.push_back(instruction.index);
+    }
+    std::sort(m_inputs.begin(), m_inputs.end());
+    m_inputs.erase(std::unique(m_inputs.begin(), m_inputs.end()), m_inputs.end());
+
+    m_code.swap(code);
+    m_constants.swap(constants);
+    m_stackDepth = emitter.GetMaxDepth();
+    m_lengthPower = parser.m_nodes[root].lengthPower;
+    return true;
+}
+
+// Column loops. Each is a plain loop over one block, which the compiler
+// vectorizes for the arithmetic, comparison and select operations.
+template <class F>
+static void MapColumn(double* a, int count, F f)
+{
+    for (int i = 0; i < count; i++)
+        a[i] = f(a[i]);
+}
+
+template <class F>
+static void ZipColumn(double* a, const double* b, double scalar, int count, F f)
+{
+    if (b != nullptr)
+    {
+        for (int i = 0; i < count; i++)
+            a[i] = f(a[i], b[i]);
+    }
+    else
+    {
+        for (int i = 0; i < count; i++)
+            a[i] = f(a[i], scalar);
+    }
+}
+
+void CSectionExpression::Evaluate(const double* const* inputs, int rowCount, double* out) const
+{
+    if (m_code.empty())
+    {
+        std::fill(out, out + rowCount, 0.0);
+        return;
+    }
+
+    std::vector<double> stack((size_t)m_stackDepth * EVAL_BLOCK);
+    for (int start = 0; start < rowCount; start += EVAL_BLOCK)
+    {
+        int count = std::min((int)EVAL_BLOCK, rowCount - start);
+        double* top = stack.data() - EVAL_BLOCK;
+
+        for (const SectionExpressionInstruction& instruction : m_code)
+        {
+            int op = instruction.op;
+            if (op == EXPR_OP_CONST)
+            {
+                top += EVAL_BLOCK;
+                std::fill(top, top + count, m_constants[instruction.index]);
+                continue;
+            }
+            if (op == EXPR_OP_LOAD)
+            {
+                top += EVAL_BLOCK;
+                memcpy(top, inputs[instruction.index] + start, count * sizeof(double));
+                continue;
+            }
+            if (op == EXPR_OP_SELECT)
+            {
+                top -= 2 * EVAL_BLOCK;
+                const double* a = top + EVAL_BLOCK;
+                const double* b = top + 2 * EVAL_BLOCK;
+                for (int i = 0; i < count; i++)
+                    top[i] = top[i] != 0 ? a[i] : b[i];
+                continue;
+            }
+
+            if (!IsBinaryOp(op))
+            {
+                switch (op)
+                {
+                case EXPR_OP_NEG:
+                    MapColumn(top, count, [](double a) { return -a; });
+                    break;
+                case EXPR_OP_NOT:
+                    MapColumn(top, count, [](double a) { return a == 0 ? 1.0 : 0.0; });
+                    break;
+                case EXPR_OP_SQUARE:
+                    MapColumn(top, count, [](double a) { return a * a; });
+                    break;
+                case EXPR_OP_SQRT:
+                    MapColumn(top, count, [](double a) { return sqrt(a); });
+                    break;
+                case EXPR_OP_ABS:
+                    MapColumn(top, count, [](double a) { return fabs(a); });
+                    break;
+                default:
+                    MapColumn(top, count, [op](double a) { return ApplyOp(op, a, 0, 0); });
+                    break;
+                }
+                continue;
+            }
+
+            // Right operand: the stack top, an input column or a constant
+            const double* b = nullptr;
+            double scalar = 0;
+            if (instruction.operand == EXPR_OPERAND_STACK)
+            {
+                b = top;
+                top -= EVAL_BLOCK;
+            }
+            else if (instruction.operand == EXPR_OPERAND_INPUT)
+                b = inputs[instruction.index] + start;
+            else
+                scalar = m_constants[instruction.index];
+
+            switch (op)
+            {
+            case EXPR_OP_ADD:
+                ZipColumn(top, b, scalar, count, [](double x, double y) { return x + y; });
+                break;
+            case EXPR_OP_SUB:
+                ZipColumn(top, b, scalar, count, [](double x, double y) { return x - y; });
+                break;
+            case EXPR_OP_MUL:
+                ZipColumn(top, b, scalar, count, [](double x, double y) { return x * y; });
+                break;
+            case EXPR_OP_DIV:
+                ZipColumn(top, b, scalar, count, [](double x, double y) { return x / y; });
+                break;
+            case EXPR_OP_MIN:
+                ZipColumn(top, b, scalar, count, [](double x, double y) { return y < x ? y : x; });
+                break;
+            case EXPR_OP_MAX:
+                ZipColumn(top, b, scalar, count, [](double x, double y) { return y > x ? y : x; });
+                break;
+            case EXPR_OP_LT:
+                ZipColumn(top, b, scalar, count, [](double x, double y) { return x < y ? 1.0 : 0.0; });
+                break;
+            case EXPR_OP_LE:
+                ZipColumn(top, b, scalar, count, [](double x, double y) { return x <= y ? 1.0 : 0.0; });
+                break;
+            case EXPR_OP_GT:
+                ZipColumn(top, b, scalar, count, [](double x, double y) { return x > y ? 1.0 : 0.0; });
+                break;
+            case EXPR_OP_GE:
+                ZipColumn(top, b, scalar, count, [](double x, double y) { return x >= y ? 1.0 : 0.0; });
+                break;
+            case EXPR_OP_EQ:
+                ZipColumn(top, b, scalar, count, [](double x, double y) { return x == y ? 1.0 : 0.0; });
+                break;
+            case EXPR_OP_NE:
+                ZipColumn(top, b, scalar, count, [](double x, double y) { return x != y ? 1.0 : 0.0; });
+                break;
+            case EXPR_OP_AND:
+                ZipColumn(top, b, scalar, count, [](double x, double y) { return (x != 0) & (y != 0) ? 1.0 : 0.0; });
+                break;
+            case EXPR_OP_OR:
+                ZipColumn(top, b, scalar, count, [](double x, double y) { return (x != 0) | (y != 0) ? 1.0 : 0.0; });
+                break;
+            default:
+                ZipColumn(top, b, scalar, count, [op](double x, double y) { return ApplyOp(op, x, y, 0); });
+                break;
+            }
+        }
+
+        memcpy(out + start, stack.data(), count * sizeof(double));
+    }
+}
+
+bool CSectionExpression::ParseDefinition(const char* line, std::string& name, std::string& expression)
+{
+    while (isspace((unsigned char)*line))
+        line++;
+    if (*line == '\0' || *line == '#')
+        return false;
+
+    const char* equals = strchr(line, '=');
+    if (equals == nullptr || equals[1] == '=')
+        return false;
+
+    const char* nameEnd = equals;
+    while (nameEnd > line && isspace((unsigned char)nameEnd[-1]))
+        nameEnd--;
+    name.assign(line, nameEnd);
+
+    const char* text = equals + 1;
+    while (isspace((unsigned char)*text))
+        text++;
+    const char* textEnd = text + strlen(text);
+    while (textEnd > text && isspace((unsigned char)textEnd[-1]))
+        textEnd--;
+    expression.assign(text, textEnd);
+    return IsValidName(name.c_str()) && !expression.empty();
+}
+
+bool CSectionExpression::IsValidName(const char* name)
+{
+    if (!IsNameStart(*name))
+        return false;
+    size_t length = 1;
+    while (IsNameChar(name[length]))
+        length++;
+    if (name[length] != '\0')
+        return false;
+    return FindFunction(name, length) == nullptr && FindUnit(name, length) == nullptr && strcmp(name, "pi") != 0;
+}
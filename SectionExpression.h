@@ -0,0 +1,132 @@
+// SectionExpression.h: Compiled expressions over section result columns
+//////////////////////////////////////////////////////////////////////
+
+#ifndef SECTION_EXPRESSION_H
+#define SECTION_EXPRESSION_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+// A named input of an expression: a result column, another user column
+// or a field of a library record. Values are in cm units.
+struct SectionExpressionSymbol
+{
+    const char* name;
+    int lengthPower;        // Dimension: length^lengthPower (0 = unitless)
+};
+
+// Bytecode operations. Binary operations take their left operand from
+// the stack and their right one from the stack, an input or a constant.
+enum SectionExpressionOp
+{
+    EXPR_OP_CONST = 0,      // Push a constant
+    EXPR_OP_LOAD,           // Push an input
+    EXPR_OP_NEG,
+    EXPR_OP_NOT,
+    EXPR_OP_SQUARE,
+    EXPR_OP_SQRT,
+    EXPR_OP_ABS,
+    EXPR_OP_EXP,
+    EXPR_OP_LOG,
+    EXPR_OP_LOG10,
+    EXPR_OP_FLOOR,
+    EXPR_OP_CEIL,
+    EXPR_OP_ADD,
+    EXPR_OP_SUB,
+    EXPR_OP_MUL,
+    EXPR_OP_DIV,
+    EXPR_OP_POW,
+    EXPR_OP_MIN,
+    EXPR_OP_MAX,
+    EXPR_OP_LT,
+    EXPR_OP_LE,
+    EXPR_OP_GT,
+    EXPR_OP_GE,
+    EXPR_OP_EQ,
+    EXPR_OP_NE,
+    EXPR_OP_AND,
+    EXPR_OP_OR,
+    EXPR_OP_SELECT          // condition, then, else -> then or else
+};
+
+// Where the right operand of a binary operation comes from
+enum SectionExpressionOperand
+{
+    EXPR_OPERAND_STACK = 0,
+    EXPR_OPERAND_INPUT,
+    EXPR_OPERAND_CONST
+};
+
+struct SectionExpressionInstruction
+{
+    uint8_t op;             // SectionExpressionOp
+    uint8_t operand;        // SectionExpressionOperand of binary operations
+    uint16_t index;         // Input or constant of CONST, LOAD and fused operands
+};
+
+// An expression such as "Ix / A", "A / cm^2 * 0.785" or
+// "Sx >= 250 cm^3 && c_y < 10 cm ? 1 : 0", parsed once and compiled to
+// stack bytecode.
+//
+// Operators, loosest first: ?:, ||, &&, comparisons, + -, * /, unary - !
+// and ^ (right associative). Functions: sqrt, abs, exp, log, log10,
+// floor, ceil, min, max and pow. Constants: pi and the length units mm,
+// cm, m, in and ft; a number directly followed by a unit is scaled by it.
+//
+// Every value carries a length dimension. Sums, comparisons, min, max and
+// the branches of ?: need equal dimensions (a literal 0 fits any), powers
+// of dimensioned values need a constant exponent and sqrt an even power.
+// Dividing by a unit, as in "A / cm^2", gives a plain number.
+//
+// Evaluation is column-wise: each instruction runs as one loop over a
+// block of EVAL_BLOCK rows, so the interpreter costs one dispatch per
+// instruction and block, and the loops vectorize. Constant subexpressions
+// are folded and constants and inputs are fused into the operations that
+// use them.
+class CSectionExpression
+{
+public:
+    enum
+    {
+        EVAL_BLOCK = 256,
+        MAX_DEPTH = 64,         // Parser nesting limit
+        MAX_TREE_DEPTH = 256,   // Operations on the way to any operand, e.g. terms of a sum
+        MAX_SYMBOLS = 4096
+    };
+
+    CSectionExpression();
+
+    // Compile 'text' against 'symbols'; on failure 'error' says what and
+    // where, and the expression is left empty
+    bool Compile(const char* text, const SectionExpressionSymbol* symbols, int symbolCount, std::string& error);
+
+    bool IsCompiled() const { return !m_code.empty(); }
+    int GetLengthPower() const { return m_lengthPower; }
+
+    // Symbols the expression reads, ascending
+    const std::vector<int>& GetInputs() const { return m_inputs; }
+
+    // out[row] for every row; inputs[symbol] points at the symbol's column
+    // (only those in GetInputs() are read)
+    void Evaluate(const double* const* inputs, int rowCount, double* out) const;
+
+    const std::vector<SectionExpressionInstruction>& GetCode() const { return m_code; }
+
+    // Split a "name = expression" definition line. False for blank and
+    // comment (#) lines and for lines that are not definitions.
+    static bool ParseDefinition(const char* line, std::string& name, std::string& expression);
+
+    // A name that can be used in expressions: a letter or '_', then
+    // letters, digits and '_', and not a function, unit or constant
+    static bool IsValidName(const char* name);
+
+private:
+    std::vector<SectionExpressionInstruction> m_code;
+    std::vector<double> m_constants;
+    std::vector<int> m_inputs;
+    int m_stackDepth;
+    int m_lengthPower;
+};
+
+#endif // SECTION_EXPRESSION_H
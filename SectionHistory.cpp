@@ -0,0 +1,232 @@
+// SectionHistory.cpp: Bounded per-section result history across design edits
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "SectionHistory.h"
+
+#include <cmath>
+#include <cstdio>
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+static const uint32_t HISTORY_FILE_MAGIC = 0x53484D41;  // "AMHS"
+static const uint32_t HISTORY_FILE_VERSION = 2;  // 2: lineages keyed by face as well as plane
+
+// FNV-1a over 64-bit words
+static uint64_t HashWords(const int64_t* words, int count)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (int i = 0; i < count; i++)
+    {
+        uint64_t w = (uint64_t)words[i];
+        for (int b = 0; b < 8; b++)
+        {
+            hash ^= (w >> (b * 8)) & 0xFF;
+            hash *= 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
+// Round to about six significant digits so tessellation noise does not
+// produce a new fingerprint
+static int64_t QuantizeSignificant(double value)
+{
+    if (fabs(value) < 1e-12)
+        return 0;
+    double scale = pow(10.0, floor(log10(fabs(value))) - 5.0);
+    return (int64_t)llround(value / scale) * 1000 + (int64_t)floor(log10(fabs(value)));
+}
+
+static FILE* OpenHistoryFile(const char* path, const char* mode)
+{
+#ifdef _MSC_VER
+    FILE* file = nullptr;
+    return (fopen_s(&file, path, mode) == 0) ? file : nullptr;
+#else
+    return fopen(path, mode);
+#endif
+}
+
+CSectionHistory::CSectionHistory()
+    : m_sequence(0)
+{
+}
+
+uint64_t CSectionHistory::MakeLineageKey(const void* faceKey, size_t faceKeyBytes,
+                                         double nx, double ny, double nz,
+                                         double ox, double oy, double oz)
+{
+    // A plane and its flipped normal are the same plane
+    double first = (fabs(nx) > 1e-6) ? nx : (fabs(ny) > 1e-6) ? ny : nz;
+    if (first < 0)
+    {
+        nx = -nx;
+        ny = -ny;
+        nz = -nz;
+    }
+
+    double offset = nx * ox + ny * oy + nz * oz;
+
+    int64_t words[4] =
+    {
+        (int64_t)llround(nx * 1e4),
+        (int64_t)llround(ny * 1e4),
+        (int64_t)llround(nz * 1e4),
+        (int64_t)llround(offset * 1e5)
+    };
+    uint64_t hash = HashWords(words, 4);
+
+    // Coplanar faces, such as the flanges of a channel, are separate sections
+    const uint8_t* bytes = (const uint8_t*)faceKey;
+    for (size_t i = 0; i < faceKeyBytes; i++)
+        hash = (hash ^ bytes[i]) * 1099511628211ULL;
+    return hash;
+}
+
+uint32_t CSectionHistory::MakeFingerprint(const ImGuiAreaMomentsResult& result)
+{
+    int64_t words[4] =
+    {
+        QuantizeSignificant(result.area),
+        QuantizeSignificant(result.Ix_centroid),
+        QuantizeSignificant(result.Iy_centroid),
+        QuantizeSignificant(result.Ixy_centroid)
+    };
+    uint64_t hash = HashWords(words, 4);
+    return (uint32_t)(hash ^ (hash >> 32));
+}
+
+void CSectionHistory::Record(uint64_t lineageKey, const ImGuiAreaMomentsResult& result, uint32_t time)
+{
+    uint32_t fingerprint = MakeFingerprint(result);
+
+    SectionHistoryLineage* lineage = FindOrCreate(lineageKey);
+    lineage->lastUsed = ++m_sequence;
+
+    // Reselecting an unchanged face is not a new design state
+    if (lineage->count > 0 && GetEntry(*lineage, 0).fingerprint == fingerprint)
+        return;
+
+    SectionHistoryEntry& entry = lineage->entries[lineage->head];
+    entry.fingerprint = fingerprint;
+    entry.time = time;
+    entry.area = (float)result.area;
+    entry.Ix = (float)result.Ix_centroid;
+    entry.Iy = (float)result.Iy_centroid;
+    entry.Sx = (float)result.Sx_min;
+    entry.Sy = (float)result.Sy_min;
+
+    lineage->head = (lineage->head + 1) % ENTRIES_PER_LINEAGE;
+    if (lineage->count < ENTRIES_PER_LINEAGE)
+        lineage->count++;
+}
+
+const SectionHistoryLineage* CSectionHistory::Find(uint64_t lineageKey) const
+{
+    for (size_t i = 0; i < m_lineages.size(); i++)
+    {
+        if (m_lineages[i].key == lineageKey)
+            return &m_lineages[i];
+    }
+    return nullptr;
+}
+
+const SectionHistoryEntry& CSectionHistory::GetEntry(const SectionHistoryLineage& lineage, int age)
+{
+    int slot = (lineage.head - 1 - age + 2 * ENTRIES_PER_LINEAGE) % ENTRIES_PER_LINEAGE;
+    return lineage.entries[slot];
+}
+
+SectionHistoryLineage* CSectionHistory::FindOrCreate(uint64_t lineageKey)
+{
+    for (size_t i = 0; i < m_lineages.size(); i++)
+    {
+        if (m_lineages[i].key == lineageKey)
+            return &m_lineages[i];
+    }
+
+    if (m_lineages.size() < MAX_LINEAGES)
+    {
+        m_lineages.push_back(SectionHistoryLineage());
+        m_lineages.back().key = lineageKey;
+        return &m_lineages.back();
+    }
+
+    // At the cap: recycle the least recently updated lineage
+    size_t oldest = 0;
+    for (size_t i = 1; i < m_lineages.size(); i++)
+    {
+        if (m_lineages[i].lastUsed < m_lineages[oldest].lastUsed)
+            oldest = i;
+    }
+    m_lineages[oldest] = SectionHistoryLineage();
+    m_lineages[oldest].key = lineageKey;
+    return &m_lineages[oldest];
+}
+
+void CSectionHistory::Clear()
+{
+    m_lineages.clear();
+    m_sequence = 0;
+}
+
+bool CSectionHistory::Save(const char* path) const
+{
+    FILE* file = OpenHistoryFile(path, "wb");
+    if (file == nullptr)
+        return false;
+
+    uint32_t header[3] = { HISTORY_FILE_MAGIC, HISTORY_FILE_VERSION, (uint32_t)m_lineages.size() };
+    bool ok = fwrite(header, sizeof(header), 1, file) == 1;
+    if (ok && !m_lineages.empty())
+        ok = fwrite(&m_lineages[0], sizeof(SectionHistoryLineage), m_lineages.size(), file) == m_lineages.size();
+
+    fclose(file);
+    return ok;
+}
+
+bool CSectionHistory::Load(const char* path)
+{
+    FILE* file = OpenHistoryFile(path, "rb");
+    if (file == nullptr)
+        return false;
+
+    uint32_t header[3] = {};
+    bool ok = fread(header, sizeof(header), 1, file) == 1 &&
+              header[0] == HISTORY_FILE_MAGIC &&
+              header[1] == HISTORY_FILE_VERSION &&
+              header[2] <= MAX_LINEAGES;
+
+    std::vector<SectionHistoryLineage> lineages;
+    if (ok)
+    {
+        lineages.resize(header[2]);
+        if (!lineages.empty())
+            ok = fread(&lineages[0], sizeof(SectionHistoryLineage), lineages.size(), file) == lineages.size();
+    }
+    fclose(file);
+
+    if (!ok)
+        return false;
+
+    m_lineages.swap(lineages);
+    m_sequence = 0;
+    for (size_t i = 0; i < m_lineages.size(); i++)
+    {
+        SectionHistoryLineage& lineage = m_lineages[i];
+        if (lineage.head < 0 || lineage.head >= ENTRIES_PER_LINEAGE ||
+            lineage.count < 0 || lineage.count > ENTRIES_PER_LINEAGE)
+        {
+            m_lineages.clear();
+            return false;
+        }
+        if (lineage.lastUsed > m_sequence)
+            m_sequence = lineage.lastUsed;
+    }
+    return true;
+}
@@ -0,0 +1,85 @@
+// SectionHistory.h: Bounded per-section result history across design edits
+//////////////////////////////////////////////////////////////////////
+
+#ifndef SECTION_HISTORY_H
+#define SECTION_HISTORY_H
+
+#include "SectionPropertyGraph.h"
+#include <vector>
+#include <cstdint>
+
+// Entries kept per lineage
+#define SECTION_HISTORY_DEPTH 32
+
+// One recorded design state, stored in single precision to stay compact
+struct SectionHistoryEntry
+{
+    uint32_t fingerprint;   // Hash of the quantized properties
+    uint32_t time;          // Seconds since the epoch
+    float area;
+    float Ix, Iy;
+    float Sx, Sy;
+};
+
+// Fixed-capacity ring buffer of entries for one lineage
+struct SectionHistoryLineage
+{
+    uint64_t key = 0;
+    uint32_t lastUsed = 0;      // Recording sequence, for eviction
+    int head = 0;               // Next slot to write
+    int count = 0;
+    SectionHistoryEntry entries[SECTION_HISTORY_DEPTH];
+};
+
+// History of results grouped by lineage: the plane a section lies in stays
+// the same while the designer edits the geometry around it, so the lineage
+// key is derived from the plane and each new fingerprint on that plane is a
+// new design state. Memory is capped at MAX_LINEAGES ring buffers of
+// ENTRIES_PER_LINEAGE entries; the least recently updated lineage is
+// recycled first.
+class CSectionHistory
+{
+public:
+    enum
+    {
+        MAX_LINEAGES = 256,
+        ENTRIES_PER_LINEAGE = SECTION_HISTORY_DEPTH
+    };
+
+    CSectionHistory();
+
+    // Lineage key of the face with persistent key 'faceKey' on the plane
+    // through 'origin' with unit normal (nx, ny, nz). Without a persistent
+    // key (faceKeyBytes 0) faces are told apart by their plane only.
+    static uint64_t MakeLineageKey(const void* faceKey, size_t faceKeyBytes,
+                                   double nx, double ny, double nz,
+                                   double ox, double oy, double oz);
+
+    // Fingerprint of a result; equal results give equal fingerprints
+    static uint32_t MakeFingerprint(const ImGuiAreaMomentsResult& result);
+
+    // Append a state unless it matches the latest one for the lineage.
+    // 'result' needs the centroid moment and section modulus nodes.
+    void Record(uint64_t lineageKey, const ImGuiAreaMomentsResult& result, uint32_t time);
+
+    // Lineage lookup; returns null when nothing was recorded yet
+    const SectionHistoryLineage* Find(uint64_t lineageKey) const;
+
+    // Entry 'age' steps back from the newest (0 = newest)
+    static const SectionHistoryEntry& GetEntry(const SectionHistoryLineage& lineage, int age);
+
+    void Clear();
+    size_t GetMemoryBytes() const { return m_lineages.capacity() * sizeof(SectionHistoryLineage); }
+
+    // Binary persistence; returns false on I/O or format errors
+    bool Save(const char* path) const;
+    bool Load(const char* path);
+
+private:
+    SectionHistoryLineage* FindOrCreate(uint64_t lineageKey);
+
+    std::vector<SectionHistoryLineage> m_lineages;
+    uint32_t m_sequence;
+};
+
+#endif // SECTION_HISTORY_H
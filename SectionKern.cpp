@@ -0,0 +1,130 @@
+// SectionKern.cpp: Convex hull and kern (core) of a section
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "SectionKern.h"
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+struct HullPoint
+{
+    double x, y;
+
+    bool operator<(const HullPoint& other) const
+    {
+        return x < other.x || (x == other.x && y < other.y);
+    }
+};
+
+static double Cross(const HullPoint& o, const HullPoint& a, const HullPoint& b)
+{
+    return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+}
+
+void CSectionKern::ConvexHull(const std::vector<double>& vertices2D, std::vector<double>& hull)
+{
+    hull.clear();
+    size_t count = vertices2D.size() / 2;
+    std::vector<HullPoint> points(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        points[i].x = vertices2D[i * 2];
+        points[i].y = vertices2D[i * 2 + 1];
+    }
+    std::sort(points.begin(), points.end());
+    points.erase(std::unique(points.begin(), points.end(),
+        [](const HullPoint& a, const HullPoint& b) { return a.x == b.x && a.y == b.y; }), points.end());
+    if (points.size() < 3)
+        return;
+
+    // Lower chain left to right, then upper chain right to left
+    std::vector<HullPoint> chain(points.size() * 2);
+    size_t k = 0;
+    for (size_t i = 0; i < points.size(); i++)
+    {
+        while (k >= 2 && Cross(chain[k - 2], chain[k - 1], points[i]) <= 0)
+            k--;
+        chain[k++] = points[i];
+    }
+    for (size_t i = points.size() - 1, lower = k + 1; i-- > 0;)
+    {
+        while (k >= lower && Cross(chain[k - 2], chain[k - 1], points[i]) <= 0)
+            k--;
+        chain[k++] = points[i];
+    }
+
+    // The last point repeats the first
+    if (k < 4)
+        return;
+    hull.resize((k - 1) * 2);
+    for (size_t i = 0; i + 1 < k; i++)
+    {
+        hull[i * 2] = chain[i].x;
+        hull[i * 2 + 1] = chain[i].y;
+    }
+}
+
+void CSectionKern::CalculateKern(const std::vector<double>& hull, double area, double Cx, double Cy,
+                                 double Ix, double Iy, double Ixy, std::vector<double>& kern)
+{
+    kern.clear();
+    size_t count = hull.size() / 2;
+    if (count < 3 || area <= 0)
+        return;
+
+    // Edges closer to the centroid than this are treated as passing through it
+    double extent = 0;
+    for (size_t i = 0; i < count; i++)
+        extent = std::max(extent, std::max(fabs(hull[i * 2] - Cx), fabs(hull[i * 2 + 1] - Cy)));
+    double tolerance = 1e-12 * extent;
+
+    kern.resize(count * 2);
+    for (size_t i = 0; i < count; i++)
+    {
+        size_t j = (i + 1 == count) ? 0 : i + 1;
+        double x0 = hull[i * 2] - Cx, y0 = hull[i * 2 + 1] - Cy;
+        double x1 = hull[j * 2] - Cx, y1 = hull[j * 2 + 1] - Cy;
+
+        // Outward normal of a counter-clockwise edge, scaled so n . p = 1 on it
+        double nx = y1 - y0, ny = x0 - x1;
+        double c = nx * x0 + ny * y0;
+        double length = sqrt(nx * nx + ny * ny);
+        if (c <= tolerance * length)
+        {
+            kern.clear();
+            return;
+        }
+        nx /= c;
+        ny /= c;
+
+        kern[i * 2] = Cx - (Iy * nx + Ixy * ny) / area;
+        kern[i * 2 + 1] = Cy - (Ixy * nx + Ix * ny) / area;
+    }
+}
+
+void CSectionKern::Calculate(const std::vector<double>& vertices2D, double area, double Cx, double Cy,
+                             double Ix, double Iy, double Ixy, SectionKern& kern)
+{
+    ConvexHull(vertices2D, kern.hull);
+    CalculateKern(kern.hull, area, Cx, Cy, Ix, Iy, Ixy, kern.kern);
+    kern.kernArea = PolygonArea(kern.kern);
+}
+
+double CSectionKern::PolygonArea(const std::vector<double>& polygon)
+{
+    size_t count = polygon.size() / 2;
+    double sum = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        size_t j = (i + 1 == count) ? 0 : i + 1;
+        sum += polygon[i * 2] * polygon[j * 2 + 1] - polygon[j * 2] * polygon[i * 2 + 1];
+    }
+    return 0.5 * sum;
+}
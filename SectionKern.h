@@ -0,0 +1,46 @@
+// SectionKern.h: Convex hull and kern (core) of a section
+//////////////////////////////////////////////////////////////////////
+
+#ifndef SECTION_KERN_H
+#define SECTION_KERN_H
+
+#include <vector>
+
+// Hull and kern of one section, as interleaved x, y in the section's
+// plane coordinates, counter-clockwise
+struct SectionKern
+{
+    std::vector<double> hull;
+    std::vector<double> kern;   // Empty if the centroid lies on the hull
+    double kernArea = 0;
+};
+
+// The kern is the region in which an axial load causes no tension
+// anywhere in the section. With the load at eccentricity e from the
+// centroid, the stress at p is P/A + P e^T M^-1 p, where M is the
+// centroidal second moment tensor [[Iy, Ixy], [Ixy, Ix]]. The neutral
+// axis touches the section only at its convex hull, so each hull edge
+// n^T p = 1 gives one kern vertex e = -M n / A: the kern is the polar
+// dual of the hull with respect to the inertia ellipse, one vertex per
+// hull edge, found in a single pass.
+class CSectionKern
+{
+public:
+    // Convex hull of the projected vertices by the monotone chain
+    // algorithm, without collinear points
+    static void ConvexHull(const std::vector<double>& vertices2D, std::vector<double>& hull);
+
+    // Kern from a counter-clockwise hull and the centroidal properties
+    // (Ix = integral of y^2, Iy = integral of x^2, Ixy = integral of x y)
+    static void CalculateKern(const std::vector<double>& hull, double area, double Cx, double Cy,
+                              double Ix, double Iy, double Ixy, std::vector<double>& kern);
+
+    // Hull and kern together
+    static void Calculate(const std::vector<double>& vertices2D, double area, double Cx, double Cy,
+                          double Ix, double Iy, double Ixy, SectionKern& kern);
+
+    // Area of an interleaved counter-clockwise polygon
+    static double PolygonArea(const std::vector<double>& polygon);
+};
+
+#endif // SECTION_KERN_H
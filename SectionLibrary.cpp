@@ -0,0 +1,251 @@
+// SectionLibrary.cpp: On-disk library of computed sections with similarity search
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "SectionLibrary.h"
+#include "SectionHistory.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+static const uint32_t LIBRARY_FILE_MAGIC = 0x4C534D41;  // "AMSL"
+static const uint32_t LIBRARY_FILE_VERSION = 1;
+static const uint32_t LSH_SEED = 0x5EC7105u;
+static const float LSH_BUCKET_WIDTH = 2.0f;
+
+// Invariants span many decades and may change sign, so they are compared
+// on a signed log scale that stays smooth through zero
+static const double INVARIANT_SCALE = 1e-9;
+
+struct SectionLibraryFileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t featureCount;
+    uint32_t recordSize;
+};
+
+static FILE* OpenLibraryFile(const char* path, const char* mode)
+{
+#ifdef _MSC_VER
+    FILE* file = nullptr;
+    return (fopen_s(&file, path, mode) == 0) ? file : nullptr;
+#else
+    return fopen(path, mode);
+#endif
+}
+
+static float SignedLog(double value)
+{
+    return (float)(asinh(value / INVARIANT_SCALE) / log(10.0));
+}
+
+static float SafeLog10(double value)
+{
+    return (float)log10(std::max(value, 1e-30));
+}
+
+CSectionLibrary::CSectionLibrary()
+{
+    std::mt19937 random(LSH_SEED);
+    std::normal_distribution<float> gaussian(0.0f, 1.0f);
+    std::uniform_real_distribution<float> uniform(0.0f, LSH_BUCKET_WIDTH);
+    for (int t = 0; t < LSH_TABLES; t++)
+    {
+        for (int p = 0; p < LSH_PROJECTIONS; p++)
+        {
+            for (int f = 0; f < FEATURE_COUNT; f++)
+                m_projections[t][p][f] = gaussian(random);
+            m_offsets[t][p] = uniform(random);
+        }
+    }
+}
+
+void CSectionLibrary::BuildFeatures(const ImGuiAreaMomentsResult& result, const SectionShapeMoments& moments,
+                                    float* features)
+{
+    int f = 0;
+    for (int i = 0; i < 7; i++)
+        features[f++] = SignedLog(moments.hu[i]);
+    for (int i = 0; i < 4; i++)
+        features[f++] = SignedLog(moments.affine[i]);
+
+    // Polar, principal and radial fourth moment ratios; all 0 for a circle
+    const double pi = 3.14159265358979323846;
+    const double* mu = moments.central;
+    double area = std::max(result.area, 1e-30);
+    double radial4 = mu[AreaMomentIndex(4, 0)] + 2 * mu[AreaMomentIndex(2, 2)] + mu[AreaMomentIndex(0, 4)];
+    features[f++] = SafeLog10(result.J_centroid * 2.0 * pi / (area * area));
+    features[f++] = SafeLog10(result.Iy_principal / std::max(result.Ix_principal, 1e-30));
+    features[f++] = SafeLog10(radial4 * 3.0 * pi * pi / (area * area * area));
+
+    // Size, weighted down so shape dominates
+    features[f++] = 0.5f * SafeLog10(area);
+}
+
+bool CSectionLibrary::Open(const char* path)
+{
+    m_path = path;
+    m_records.clear();
+    m_fingerprints.clear();
+    for (int t = 0; t < LSH_TABLES; t++)
+        m_buckets[t].clear();
+
+    FILE* file = OpenLibraryFile(path, "rb");
+    if (file == nullptr)
+        return true;
+
+    SectionLibraryFileHeader header;
+    bool ok = fread(&header, sizeof(header), 1, file) == 1 &&
+              header.magic == LIBRARY_FILE_MAGIC &&
+              header.version == LIBRARY_FILE_VERSION &&
+              header.featureCount == FEATURE_COUNT &&
+              header.recordSize == sizeof(SectionLibraryRecord);
+
+    // Records run to the end of the file; a torn last record is dropped
+    SectionLibraryRecord record;
+    while (ok && fread(&record, sizeof(record), 1, file) == 1)
+    {
+        record.name[sizeof(record.name) - 1] = '\0';
+        record.faceType[sizeof(record.faceType) - 1] = '\0';
+        m_records.push_back(record);
+        m_fingerprints.insert(record.fingerprint);
+        Insert((int)m_records.size() - 1);
+    }
+    fclose(file);
+
+    if (!ok)
+        m_path.clear();
+    return ok;
+}
+
+int CSectionLibrary::Add(const char* name, const ImGuiAreaMomentsResult& result,
+                         const SectionShapeMoments& moments, uint32_t time)
+{
+    uint32_t fingerprint = CSectionHistory::MakeFingerprint(result);
+    if (!m_fingerprints.insert(fingerprint).second)
+        return -1;
+
+    SectionLibraryRecord record;
+    memset(&record, 0, sizeof(record));
+    record.fingerprint = fingerprint;
+    record.time = time;
+    snprintf(record.name, sizeof(record.name), "%s", name);
+    snprintf(record.faceType, sizeof(record.faceType), "%s", result.faceType.c_str());
+    record.area = (float)result.area;
+    record.Ix = (float)result.Ix_centroid;
+    record.Iy = (float)result.Iy_centroid;
+    record.J = (float)result.J_centroid;
+    BuildFeatures(result, moments, record.features);
+
+    m_records.push_back(record);
+    int index = (int)m_records.size() - 1;
+    Insert(index);
+
+    // Append; a new file gets its header first
+    if (!m_path.empty())
+    {
+        FILE* file = OpenLibraryFile(m_path.c_str(), "ab");
+        if (file != nullptr)
+        {
+            if (ftell(file) == 0)
+            {
+                SectionLibraryFileHeader header = { LIBRARY_FILE_MAGIC, LIBRARY_FILE_VERSION,
+                                                    FEATURE_COUNT, sizeof(SectionLibraryRecord) };
+                fwrite(&header, sizeof(header), 1, file);
+            }
+            fwrite(&record, sizeof(record), 1, file);
+            fclose(file);
+        }
+    }
+    return index;
+}
+
+uint64_t CSectionLibrary::BucketKey(int table, const float* features) const
+{
+    uint64_t key = 14695981039346656037ULL;
+    for (int p = 0; p < LSH_PROJECTIONS; p++)
+    {
+        float dot = m_offsets[table][p];
+        for (int f = 0; f < FEATURE_COUNT; f++)
+            dot += m_projections[table][p][f] * features[f];
+        int64_t bucket = (int64_t)floorf(dot / LSH_BUCKET_WIDTH);
+        key = (key ^ (uint64_t)bucket) * 1099511628211ULL;
+    }
+    return key;
+}
+
+void CSectionLibrary::Insert(int index)
+{
+    for (int t = 0; t < LSH_TABLES; t++)
+        m_buckets[t][BucketKey(t, m_records[index].features)].push_back(index);
+}
+
+static float FeatureDistance(const float* a, const float* b)
+{
+    float sum = 0;
+    for (int f = 0; f < SECTION_FEATURE_COUNT; f++)
+    {
+        float d = a[f] - b[f];
+        sum += d * d;
+    }
+    return sqrtf(sum);
+}
+
+void CSectionLibrary::Query(const float* features, int count, std::vector<SectionLibraryMatch>& matches) const
+{
+    matches.clear();
+    if (count <= 0 || m_records.empty())
+        return;
+
+    // Union of the query's buckets; a record may be in several
+    std::vector<int> candidates;
+    for (int t = 0; t < LSH_TABLES; t++)
+    {
+        auto bucket = m_buckets[t].find(BucketKey(t, features));
+        if (bucket != m_buckets[t].end())
+            candidates.insert(candidates.end(), bucket->second.begin(), bucket->second.end());
+    }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    if ((int)candidates.size() < count)
+    {
+        candidates.resize(m_records.size());
+        for (size_t i = 0; i < candidates.size(); i++)
+            candidates[i] = (int)i;
+    }
+
+    matches.resize(candidates.size());
+    for (size_t i = 0; i < candidates.size(); i++)
+    {
+        matches[i].record = candidates[i];
+        matches[i].distance = FeatureDistance(features, m_records[candidates[i]].features);
+    }
+
+    size_t keep = std::min(matches.size(), (size_t)count);
+    std::partial_sort(matches.begin(), matches.begin() + keep, matches.end(),
+        [](const SectionLibraryMatch& a, const SectionLibraryMatch& b) { return a.distance < b.distance; });
+    matches.resize(keep);
+}
+
+size_t CSectionLibrary::GetMemoryBytes() const
+{
+    size_t bytes = m_records.capacity() * sizeof(SectionLibraryRecord);
+    bytes += m_fingerprints.size() * (sizeof(uint32_t) + sizeof(void*));
+    for (int t = 0; t < LSH_TABLES; t++)
+    {
+        for (const auto& bucket : m_buckets[t])
+            bytes += sizeof(bucket) + bucket.second.capacity() * sizeof(int);
+    }
+    return bytes;
+}
@@ -0,0 +1,94 @@
+// SectionLibrary.h: On-disk library of computed sections with similarity search
+//////////////////////////////////////////////////////////////////////
+
+#ifndef SECTION_LIBRARY_H
+#define SECTION_LIBRARY_H
+
+#include "SectionPropertyGraph.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+
+// Length of the shape descriptor
+#define SECTION_FEATURE_COUNT 15
+
+// One stored section; fixed size so the file can be appended to
+struct SectionLibraryRecord
+{
+    uint32_t fingerprint;       // CSectionHistory::MakeFingerprint of the result
+    uint32_t time;              // Seconds since the epoch
+    char name[48];
+    char faceType[24];
+    float area, Ix, Iy, J;      // Centroidal values in cm units, for display
+    float features[SECTION_FEATURE_COUNT];
+};
+
+struct SectionLibraryMatch
+{
+    int record;
+    float distance;
+};
+
+// Library of sections described by feature vectors: the seven Hu and four
+// affine moment invariants, the polar, principal and radial fourth moment
+// ratios and, weighted down, the log of the area. Records are appended to
+// the file as they are added, so the library grows with every calculation.
+//
+// Queries use p-stable (Gaussian) locality sensitive hashing: each of
+// LSH_TABLES tables hashes a vector by LSH_PROJECTIONS random projections
+// quantized to LSH_BUCKET_WIDTH, so nearby vectors tend to share a bucket in
+// at least one table. The candidates from all tables are ranked by exact
+// distance; if they are fewer than asked for, the whole library is scanned.
+// The projections come from a fixed seed, so the tables are rebuilt
+// identically on load rather than stored.
+class CSectionLibrary
+{
+public:
+    enum
+    {
+        FEATURE_COUNT = SECTION_FEATURE_COUNT,
+        LSH_TABLES = 8,
+        LSH_PROJECTIONS = 4
+    };
+
+    CSectionLibrary();
+
+    // Feature vector of a result; needs the principal moment node and the
+    // shape moments of the same section
+    static void BuildFeatures(const ImGuiAreaMomentsResult& result, const SectionShapeMoments& moments,
+                              float* features);
+
+    // Load the records in 'path' (a missing file is an empty library);
+    // later Add() calls append to it. Returns false on format errors.
+    bool Open(const char* path);
+
+    // Add a section unless an identical result is already stored;
+    // returns the record index, or -1 for duplicates
+    int Add(const char* name, const ImGuiAreaMomentsResult& result,
+            const SectionShapeMoments& moments, uint32_t time);
+
+    // Up to 'count' nearest records to 'features', closest first
+    void Query(const float* features, int count, std::vector<SectionLibraryMatch>& matches) const;
+
+    int GetCount() const { return (int)m_records.size(); }
+    const SectionLibraryRecord& GetRecord(int index) const { return m_records[index]; }
+    const std::string& GetPath() const { return m_path; }
+    size_t GetMemoryBytes() const;
+
+private:
+    void Insert(int index);
+    uint64_t BucketKey(int table, const float* features) const;
+
+    std::string m_path;
+    std::vector<SectionLibraryRecord> m_records;
+    std::unordered_set<uint32_t> m_fingerprints;
+
+    // Projection rows and offsets, LSH_TABLES x LSH_PROJECTIONS
+    float m_projections[LSH_TABLES][LSH_PROJECTIONS][FEATURE_COUNT];
+    float m_offsets[LSH_TABLES][LSH_PROJECTIONS];
+    std::unordered_map<uint64_t, std::vector<int>> m_buckets[LSH_TABLES];
+};
+
+#endif // SECTION_LIBRARY_H
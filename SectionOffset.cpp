@@ -0,0 +1,380 @@
+// SectionOffset.cpp: Uniform boundary offsets for corrosion and coating allowances
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "SectionOffset.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+const double CSectionOffset::ARC_TOLERANCE = 1e-4;
+
+// Turns smaller than this (radians) add no arc points
+static const double MIN_TURN = 1e-9;
+
+struct OffsetEdge
+{
+    double x0, y0, x1, y1;
+};
+
+// Raw offset loop of one boundary loop, appended to 'edges'
+static void AddRawLoop(const std::vector<double>& raw, double distance, std::vector<OffsetEdge>& edges)
+{
+    // Drop repeated points, which have no direction
+    std::vector<double> p;
+    for (size_t i = 0; i + 1 < raw.size(); i += 2)
+    {
+        if (p.empty() || raw[i] != p[p.size() - 2] || raw[i + 1] != p[p.size() - 1])
+        {
+            p.push_back(raw[i]);
+            p.push_back(raw[i + 1]);
+        }
+    }
+    while (p.size() >= 4 && p[0] == p[p.size() - 2] && p[1] == p[p.size() - 1])
+        p.resize(p.size() - 2);
+    int count = (int)p.size() / 2;
+    if (count < 3)
+        return;
+
+    // Outward normal of each edge, away from the material on the left
+    std::vector<double> normals(count * 2), lengths(count);
+    for (int i = 0; i < count; i++)
+    {
+        int j = (i + 1) % count;
+        double dx = p[j * 2] - p[i * 2], dy = p[j * 2 + 1] - p[i * 2 + 1];
+        lengths[i] = sqrt(dx * dx + dy * dy);
+        normals[i * 2] = dy / lengths[i];
+        normals[i * 2 + 1] = -dx / lengths[i];
+    }
+
+    double maxStep = 2.0 * acos(1.0 - CSectionOffset::ARC_TOLERANCE);
+    std::vector<double> path;
+    for (int i = 0; i < count; i++)
+    {
+        int prev = (i + count - 1) % count;
+        double x = p[i * 2], y = p[i * 2 + 1];
+        double ax = normals[prev * 2], ay = normals[prev * 2 + 1];
+        double bx = normals[i * 2], by = normals[i * 2 + 1];
+
+        // Normals turn with the boundary: left turns are positive
+        double turn = atan2(ax * by - ay * bx, ax * bx + ay * by);
+        if (fabs(turn) < MIN_TURN)
+        {
+            path.push_back(x + distance * bx);
+            path.push_back(y + distance * by);
+        }
+        else if (turn * distance > 0)
+        {
+            // The corner opens: arc about the vertex
+            int steps = std::max(1, (int)ceil(fabs(turn) / maxStep));
+            for (int k = 0; k <= steps; k++)
+            {
+                double angle = turn * k / steps;
+                double c = cos(angle), s = sin(angle);
+                path.push_back(x + distance * (ax * c - ay * s));
+                path.push_back(y + distance * (ax * s + ay * c));
+            }
+        }
+        else if (fabs(distance * tan(0.5 * turn)) <= 0.5 * std::min(lengths[prev], lengths[i]))
+        {
+            // The corner closes by less than half of either edge, so the
+            // offset lines meet without turning an edge over
+            double scale = distance / (1.0 + ax * bx + ay * by);
+            path.push_back(x + scale * (ax + bx));
+            path.push_back(y + scale * (ay + by));
+        }
+        else
+        {
+            // The corner closes past a neighbouring edge: through the
+            // vertex, leaving a loop of the wrong winding that the fill
+            // rule removes
+            path.push_back(x + distance * ax);
+            path.push_back(y + distance * ay);
+            path.push_back(x);
+            path.push_back(y);
+            path.push_back(x + distance * bx);
+            path.push_back(y + distance * by);
+        }
+    }
+
+    int points = (int)path.size() / 2;
+    for (int i = 0; i < points; i++)
+    {
+        int j = (i + 1) % points;
+        OffsetEdge edge = { path[i * 2], path[i * 2 + 1], path[j * 2], path[j * 2 + 1] };
+        if (edge.x0 != edge.x1 || edge.y0 != edge.y1)
+            edges.push_back(edge);
+    }
+}
+
+// Uniform grid over the edges' bounding boxes for the crossing search
+class OffsetGrid
+{
+public:
+    void Build(const std::vector<OffsetEdge>& edges, double minX, double minY, double maxX, double maxY)
+    {
+        m_size = std::max(1, (int)sqrt((double)edges.size() / 2.0));
+        m_minX = minX;
+        m_minY = minY;
+        m_cellX = std::max(maxX - minX, 1e-300) / m_size;
+        m_cellY = std::max(maxY - minY, 1e-300) / m_size;
+        m_cells.assign((size_t)m_size * m_size, std::vector<int>());
+        for (int e = 0; e < (int)edges.size(); e++)
+        {
+            const OffsetEdge& edge = edges[e];
+            int x0 = Cell(std::min(edge.x0, edge.x1), m_minX, m_cellX);
+            int x1 = Cell(std::max(edge.x0, edge.x1), m_minX, m_cellX);
+            int y0 = Cell(std::min(edge.y0, edge.y1), m_minY, m_cellY);
+            int y1 = Cell(std::max(edge.y0, edge.y1), m_minY, m_cellY);
+            for (int y = y0; y <= y1; y++)
+            {
+                for (int x = x0; x <= x1; x++)
+                    m_cells[(size_t)y * m_size + x].push_back(e);
+            }
+        }
+    }
+
+    int GetCellCount() const { return (int)m_cells.size(); }
+    const std::vector<int>& GetCell(int index) const { return m_cells[index]; }
+
+private:
+    int Cell(double value, double origin, double size) const
+    {
+        int cell = (int)((value - origin) / size);
+        return std::max(0, std::min(cell, m_size - 1));
+    }
+
+    int m_size = 1;
+    double m_minX = 0, m_minY = 0, m_cellX = 1, m_cellY = 1;
+    std::vector<std::vector<int>> m_cells;
+};
+
+// Record where edges a and b meet as parameters along each
+static void Intersect(const std::vector<OffsetEdge>& edges, int a, int b, double tolerance,
+                      std::vector<std::vector<double>>& splits)
+{
+    const OffsetEdge& p = edges[a];
+    const OffsetEdge& q = edges[b];
+    double rx = p.x1 - p.x0, ry = p.y1 - p.y0;
+    double sx = q.x1 - q.x0, sy = q.y1 - q.y0;
+    double wx = q.x0 - p.x0, wy = q.y0 - p.y0;
+    double denominator = rx * sy - ry * sx;
+    double rr = rx * rx + ry * ry, ss = sx * sx + sy * sy;
+
+    if (fabs(denominator) <= 1e-12 * sqrt(rr * ss))
+    {
+        // Parallel: only collinear overlaps split, at the other's end points
+        if (fabs(wx * ry - wy * rx) > tolerance * sqrt(rr))
+            return;
+        double t0 = (wx * rx + wy * ry) / rr;
+        double t1 = ((q.x1 - p.x0) * rx + (q.y1 - p.y0) * ry) / rr;
+        double u0 = (-wx * sx - wy * sy) / ss;
+        double u1 = ((p.x1 - q.x0) * sx + (p.y1 - q.y0) * sy) / ss;
+        for (double t : { t0, t1 })
+        {
+            if (t > 0 && t < 1)
+                splits[a].push_back(t);
+        }
+        for (double u : { u0, u1 })
+        {
+            if (u > 0 && u < 1)
+                splits[b].push_back(u);
+        }
+        return;
+    }
+
+    double t = (wx * sy - wy * sx) / denominator;
+    double u = (wx * ry - wy * rx) / denominator;
+    double slackT = tolerance / sqrt(rr), slackU = tolerance / sqrt(ss);
+    if (t < -slackT || t > 1 + slackT || u < -slackU || u > 1 + slackU)
+        return;
+    if (t > slackT && t < 1 - slackT)
+        splits[a].push_back(t);
+    if (u > slackU && u < 1 - slackU)
+        splits[b].push_back(u);
+}
+
+// Winding number of the raw loops at (px, py), counting crossings of a
+// ray along +x through y bands, or along +y through x bands
+static int Winding(const std::vector<OffsetEdge>& edges, const std::vector<std::vector<int>>& bands,
+                   double bandOrigin, double bandSize, bool vertical, double px, double py)
+{
+    // A +y ray is a +x ray with x and y swapped
+    if (vertical)
+        std::swap(px, py);
+    int band = (int)((py - bandOrigin) / bandSize);
+    band = std::max(0, std::min(band, (int)bands.size() - 1));
+
+    int winding = 0;
+    for (int e : bands[band])
+    {
+        const OffsetEdge& edge = edges[e];
+        double ax = edge.x0, ay = edge.y0, bx = edge.x1, by = edge.y1;
+        if (vertical)
+        {
+            std::swap(ax, ay);
+            std::swap(bx, by);
+        }
+        if ((ay <= py) == (by <= py))
+            continue;
+        double x = ax + (py - ay) * (bx - ax) / (by - ay);
+        if (x > px)
+            winding += (by > ay) ? 1 : -1;
+    }
+
+    // Swapping x and y mirrors the plane, which flips every crossing
+    return vertical ? -winding : winding;
+}
+
+void CSectionOffset::Offset(const std::vector<SectionBoundaryLoop>& loops, double distance, bool keepEdges,
+                            SectionOffsetResult& result)
+{
+    result.distance = distance;
+    result.moments = SectionPolygonMoments();
+    result.edges.clear();
+
+    std::vector<OffsetEdge> raw;
+    for (const SectionBoundaryLoop& loop : loops)
+        AddRawLoop(loop.points, distance, raw);
+    if (raw.empty())
+        return;
+
+    double minX = raw[0].x0, maxX = minX, minY = raw[0].y0, maxY = minY;
+    for (const OffsetEdge& edge : raw)
+    {
+        minX = std::min(minX, std::min(edge.x0, edge.x1));
+        maxX = std::max(maxX, std::max(edge.x0, edge.x1));
+        minY = std::min(minY, std::min(edge.y0, edge.y1));
+        maxY = std::max(maxY, std::max(edge.y0, edge.y1));
+    }
+    double tolerance = 1e-12 * std::max(maxX - minX, maxY - minY);
+
+    // Split every edge where another crosses it; pairs sharing several
+    // cells repeat, and the duplicate splits are merged below
+    OffsetGrid grid;
+    grid.Build(raw, minX, minY, maxX, maxY);
+    std::vector<std::vector<double>> splits(raw.size());
+    for (int c = 0; c < grid.GetCellCount(); c++)
+    {
+        const std::vector<int>& cell = grid.GetCell(c);
+        for (size_t i = 0; i < cell.size(); i++)
+        {
+            for (size_t j = i + 1; j < cell.size(); j++)
+                Intersect(raw, cell[i], cell[j], tolerance, splits);
+        }
+    }
+
+    std::vector<OffsetEdge> pieces;
+    pieces.reserve(raw.size() * 2);
+    for (size_t e = 0; e < raw.size(); e++)
+    {
+        std::vector<double>& t = splits[e];
+        std::sort(t.begin(), t.end());
+        const OffsetEdge& edge = raw[e];
+        double x = edge.x0, y = edge.y0;
+        for (size_t k = 0; k <= t.size(); k++)
+        {
+            double nx = (k < t.size()) ? edge.x0 + t[k] * (edge.x1 - edge.x0) : edge.x1;
+            double ny = (k < t.size()) ? edge.y0 + t[k] * (edge.y1 - edge.y0) : edge.y1;
+            if (fabs(nx - x) + fabs(ny - y) > tolerance)
+            {
+                OffsetEdge piece = { x, y, nx, ny };
+                pieces.push_back(piece);
+                x = nx;
+                y = ny;
+            }
+        }
+    }
+
+    // Bands for the winding rays: y bands for +x rays, x bands for +y rays
+    int bandCount = std::max(1, (int)sqrt((double)pieces.size()));
+    double bandHeight = std::max(maxY - minY, 1e-300) / bandCount;
+    double bandWidth = std::max(maxX - minX, 1e-300) / bandCount;
+    std::vector<std::vector<int>> rows(bandCount), columns(bandCount);
+    for (int e = 0; e < (int)pieces.size(); e++)
+    {
+        const OffsetEdge& edge = pieces[e];
+        int y0 = std::max(0, (int)((std::min(edge.y0, edge.y1) - minY) / bandHeight));
+        int y1 = std::min(bandCount - 1, (int)((std::max(edge.y0, edge.y1) - minY) / bandHeight));
+        for (int b = y0; b <= y1; b++)
+            rows[b].push_back(e);
+        int x0 = std::max(0, (int)((std::min(edge.x0, edge.x1) - minX) / bandWidth));
+        int x1 = std::min(bandCount - 1, (int)((std::max(edge.x0, edge.x1) - minX) / bandWidth));
+        for (int b = x0; b <= x1; b++)
+            columns[b].push_back(e);
+    }
+
+    // The region is where the winding number is positive, so its boundary
+    // is every piece with a positive winding number on one side only.
+    // Sampling just off both sides, rather than inferring one side from
+    // the other, drops coincident pieces of opposite direction: the zero
+    // width features left where a wall collapses exactly.
+    double nudge = 1e3 * tolerance;
+    for (int e = 0; e < (int)pieces.size(); e++)
+    {
+        const OffsetEdge& edge = pieces[e];
+        double dx = edge.x1 - edge.x0, dy = edge.y1 - edge.y0;
+        double length = sqrt(dx * dx + dy * dy);
+        double mx = 0.5 * (edge.x0 + edge.x1), my = 0.5 * (edge.y0 + edge.y1);
+        double ox = nudge * dy / length, oy = -nudge * dx / length;
+
+        // Cast across the piece rather than along it
+        bool vertical = fabs(dx) > fabs(dy);
+        const std::vector<std::vector<int>>& bands = vertical ? columns : rows;
+        double bandOrigin = vertical ? minX : minY;
+        double bandSize = vertical ? bandWidth : bandHeight;
+        int right = Winding(pieces, bands, bandOrigin, bandSize, vertical, mx + ox, my + oy);
+        int left = Winding(pieces, bands, bandOrigin, bandSize, vertical, mx - ox, my - oy);
+        if (right > 0 || left <= 0)
+            continue;
+
+        result.moments.AddEdge(edge.x0, edge.y0, edge.x1, edge.y1);
+        if (keepEdges)
+        {
+            result.edges.push_back(edge.x0);
+            result.edges.push_back(edge.y0);
+            result.edges.push_back(edge.x1);
+            result.edges.push_back(edge.y1);
+        }
+    }
+}
+
+static void OffsetRange(const std::vector<SectionBoundaryLoop>& loops, const double* distances,
+                        std::vector<SectionOffsetResult>& results, int first, int last)
+{
+    for (int i = first; i < last; i++)
+        CSectionOffset::Offset(loops, distances[i], false, results[i]);
+}
+
+void CSectionOffset::OffsetBatch(const std::vector<SectionBoundaryLoop>& loops, const double* distances, int count,
+                                 std::vector<SectionOffsetResult>& results)
+{
+    results.resize(count);
+    if (count <= 0)
+        return;
+
+    // Contiguous distance ranges per thread; the caller's thread takes the first
+    int edges = 0;
+    for (const SectionBoundaryLoop& loop : loops)
+        edges += loop.GetCount();
+    int workers = std::max(1, std::min((int)std::thread::hardware_concurrency(),
+                                       std::min(count, edges * count / (int)MIN_EDGES_PER_THREAD)));
+    int chunk = (count + workers - 1) / workers;
+    std::vector<std::thread> threads;
+    for (int w = 1; w < workers; w++)
+    {
+        int first = w * chunk, last = std::min(count, first + chunk);
+        if (first < last)
+            threads.emplace_back(OffsetRange, std::cref(loops), distances, std::ref(results), first, last);
+    }
+    OffsetRange(loops, distances, results, 0, std::min(count, chunk));
+    for (std::thread& thread : threads)
+        thread.join();
+}
@@ -0,0 +1,53 @@
+// SectionOffset.h: Uniform boundary offsets for corrosion and coating allowances
+//////////////////////////////////////////////////////////////////////
+
+#ifndef SECTION_OFFSET_H
+#define SECTION_OFFSET_H
+
+#include "SectionBoundary.h"
+#include <vector>
+
+// Properties of a section with every boundary moved by the same distance
+struct SectionOffsetResult
+{
+    double distance = 0;            // cm; positive adds material (coating),
+                                    // negative removes it (corrosion)
+    SectionPolygonMoments moments;  // Of the offset region, about the origin
+    std::vector<double> edges;      // Offset boundary as x0, y0, x1, y1 per
+                                    // edge, if asked for
+};
+
+// Offsets boundary loops the way a polygon clipper does: each edge moves
+// along its outward normal, corners that open up get a circular arc about
+// the original vertex, and corners that close up meet where the offset
+// edges cross, or are joined through the vertex when that point would
+// pass a neighbouring edge. The raw loops overlap and turn inside out
+// where features collapse (a web thinner than twice the allowance, a hole
+// that closes), so the result is the region of positive winding number:
+// raw edges are split where they cross, and a piece is kept when the
+// winding number is positive on its left and not on its right. Collapsed
+// features drop out without special cases.
+//
+// Arcs are flattened to within ARC_TOLERANCE of their radius; the
+// properties are then integrated exactly over the kept edges with Green's
+// theorem, so no tessellation is needed.
+class CSectionOffset
+{
+public:
+    enum
+    {
+        MIN_EDGES_PER_THREAD = 2048     // Batch work smaller than this stays on one thread
+    };
+
+    static const double ARC_TOLERANCE;  // Chord deviation as a fraction of the radius
+
+    // Offset 'loops' (material on the left) by 'distance'
+    static void Offset(const std::vector<SectionBoundaryLoop>& loops, double distance, bool keepEdges,
+                       SectionOffsetResult& result);
+
+    // One result per distance, spread over threads
+    static void OffsetBatch(const std::vector<SectionBoundaryLoop>& loops, const double* distances, int count,
+                            std::vector<SectionOffsetResult>& results);
+};
+
+#endif // SECTION_OFFSET_H
@@ -0,0 +1,419 @@
+// SectionOptimizer.cpp: Target-driven sizing of section boundary offsets
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "SectionOptimizer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+// Edges within this angle (radians) of a side's first edge join the side
+static const double SIDE_ANGLE_TOLERANCE = 1e-5;
+
+// Targets are compared relative to their bound
+static const double TARGET_TOLERANCE = 1e-9;
+
+// Targets met by less than this are held where they are during a step
+static const double HOLD_MARGIN = 1e-6;
+
+CSectionOptimizer::CSectionOptimizer()
+{
+}
+
+void CSectionOptimizer::SetBoundary(const std::vector<SectionBoundaryLoop>& loops)
+{
+    m_sides.clear();
+    m_loopFirst.assign(1, 0);
+    double cosTolerance = cos(SIDE_ANGLE_TOLERANCE);
+
+    for (int l = 0; l < (int)loops.size(); l++)
+    {
+        // Drop repeated points, which have no direction
+        const std::vector<double>& raw = loops[l].points;
+        std::vector<double> p;
+        for (size_t i = 0; i + 1 < raw.size(); i += 2)
+        {
+            if (p.empty() || raw[i] != p[p.size() - 2] || raw[i + 1] != p[p.size() - 1])
+            {
+                p.push_back(raw[i]);
+                p.push_back(raw[i + 1]);
+            }
+        }
+        while (p.size() >= 4 && p[0] == p[p.size() - 2] && p[1] == p[p.size() - 1])
+            p.resize(p.size() - 2);
+
+        int count = (int)p.size() / 2;
+        if (count < 3)
+            continue;
+
+        auto direction = [&](int i, double& dx, double& dy)
+        {
+            int j = (i + 1) % count;
+            dx = p[j * 2] - p[i * 2];
+            dy = p[j * 2 + 1] - p[i * 2 + 1];
+            double length = sqrt(dx * dx + dy * dy);
+            dx /= length;
+            dy /= length;
+        };
+
+        // Start at a corner so no side wraps around the loop's first point
+        int start = -1;
+        for (int i = 0; i < count && start < 0; i++)
+        {
+            double ax, ay, bx, by;
+            direction((i + count - 1) % count, ax, ay);
+            direction(i, bx, by);
+            if (ax * bx + ay * by < cosTolerance)
+                start = i;
+        }
+        if (start < 0)
+            continue;
+
+        int i = 0;
+        while (i < count)
+        {
+            int first = (start + i) % count;
+            double fx, fy;
+            direction(first, fx, fy);
+            int edges = 1;
+            while (i + edges < count)
+            {
+                double dx, dy;
+                direction((first + edges) % count, dx, dy);
+                if (fx * dx + fy * dy < cosTolerance)
+                    break;
+                edges++;
+            }
+            int last = (first + edges) % count;
+
+            SectionSide side;
+            side.loop = (int)m_loopFirst.size() - 1;
+            side.hole = loops[l].hole;
+            side.x0 = p[first * 2];
+            side.y0 = p[first * 2 + 1];
+            side.x1 = p[last * 2];
+            side.y1 = p[last * 2 + 1];
+            double dx = side.x1 - side.x0, dy = side.y1 - side.y0;
+            side.length = sqrt(dx * dx + dy * dy);
+            side.nx = dy / side.length;
+            side.ny = -dx / side.length;
+            side.c = side.nx * side.x0 + side.ny * side.y0;
+            m_sides.push_back(side);
+            i += edges;
+        }
+        m_loopFirst.push_back((int)m_sides.size());
+    }
+
+    int sideCount = (int)m_sides.size();
+    m_corners.assign(sideCount * 2, 0.0);
+    m_edges.assign(sideCount, SectionPolygonMoments());
+    m_offsets.assign(sideCount, 1.0);
+    Apply(std::vector<double>(sideCount, 0.0), nullptr);
+}
+
+int CSectionOptimizer::Previous(int side) const
+{
+    int loop = m_sides[side].loop;
+    return (side == m_loopFirst[loop]) ? m_loopFirst[loop + 1] - 1 : side - 1;
+}
+
+int CSectionOptimizer::Next(int side) const
+{
+    int loop = m_sides[side].loop;
+    return (side + 1 == m_loopFirst[loop + 1]) ? m_loopFirst[loop] : side + 1;
+}
+
+void CSectionOptimizer::UpdateCorner(int side)
+{
+    const SectionSide& a = m_sides[Previous(side)];
+    const SectionSide& b = m_sides[side];
+    double ca = a.c + m_offsets[Previous(side)];
+    double cb = b.c + m_offsets[side];
+    double det = a.nx * b.ny - a.ny * b.nx;
+
+    // Parallel neighbours (a zero-width spike): carry the corner with the side
+    if (fabs(det) < 1e-12)
+    {
+        m_corners[side * 2] = b.x0 + m_offsets[side] * b.nx;
+        m_corners[side * 2 + 1] = b.y0 + m_offsets[side] * b.ny;
+        return;
+    }
+    m_corners[side * 2] = (ca * b.ny - cb * a.ny) / det;
+    m_corners[side * 2 + 1] = (a.nx * cb - b.nx * ca) / det;
+}
+
+void CSectionOptimizer::UpdateEdge(int side)
+{
+    int next = Next(side);
+    SectionPolygonMoments edge;
+    edge.AddEdge(m_corners[side * 2], m_corners[side * 2 + 1], m_corners[next * 2], m_corners[next * 2 + 1]);
+    m_total.Add(m_edges[side], -1.0);
+    m_total.Add(edge);
+    m_edges[side] = edge;
+}
+
+bool CSectionOptimizer::Apply(const std::vector<double>& offsets, const std::vector<int>* changed)
+{
+    int sideCount = (int)m_sides.size();
+    std::vector<int> edges;
+    if (changed == nullptr)
+    {
+        m_offsets = offsets;
+        for (int s = 0; s < sideCount; s++)
+            UpdateCorner(s);
+        m_total = SectionPolygonMoments();
+        for (int s = 0; s < sideCount; s++)
+        {
+            m_edges[s] = SectionPolygonMoments();
+            UpdateEdge(s);
+        }
+        edges.resize(sideCount);
+        for (int s = 0; s < sideCount; s++)
+            edges[s] = s;
+    }
+    else
+    {
+        // A side's move shifts its two corners, which end three edges
+        for (int s : *changed)
+            m_offsets[s] = offsets[s];
+        for (int s : *changed)
+        {
+            UpdateCorner(s);
+            UpdateCorner(Next(s));
+        }
+        for (int s : *changed)
+        {
+            edges.push_back(Previous(s));
+            edges.push_back(s);
+            edges.push_back(Next(s));
+        }
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+        for (int e : edges)
+            UpdateEdge(e);
+    }
+
+    // A side that turned over has its corners in the wrong order
+    bool valid = true;
+    for (int e : edges)
+    {
+        const SectionSide& side = m_sides[e];
+        int next = Next(e);
+        double along = (m_corners[next * 2] - m_corners[e * 2]) * (side.x1 - side.x0) +
+                       (m_corners[next * 2 + 1] - m_corners[e * 2 + 1]) * (side.y1 - side.y0);
+        if (along <= 0)
+            valid = false;
+    }
+    return valid;
+}
+
+void CSectionOptimizer::GetValues(double* values) const
+{
+    values[SIZING_AREA] = m_total.area;
+    values[SIZING_IX] = m_total.IxCentroid();
+    values[SIZING_IY] = m_total.IyCentroid();
+}
+
+void CSectionOptimizer::GetGradient(int side, double* gradient) const
+{
+    // d/dd of an area integral of f is the integral of f along the side
+    int next = Next(side);
+    double x0 = m_corners[side * 2], y0 = m_corners[side * 2 + 1];
+    double x1 = m_corners[next * 2], y1 = m_corners[next * 2 + 1];
+    double L = sqrt((x1 - x0) * (x1 - x0) + (y1 - y0) * (y1 - y0));
+    double dA = L;
+    double dQy = L * (x0 + x1) / 2;
+    double dQx = L * (y0 + y1) / 2;
+    double dIyy = L * (x0 * x0 + x0 * x1 + x1 * x1) / 3;
+    double dIxx = L * (y0 * y0 + y0 * y1 + y1 * y1) / 3;
+
+    // I = Ixx - Qx^2 / A about the moving centroid
+    const SectionPolygonMoments& m = m_total;
+    double A = (m.area != 0) ? m.area : 1e-300;
+    gradient[SIZING_AREA] = dA;
+    gradient[SIZING_IX] = dIxx - 2 * m.Qx * dQx / A + m.Qx * m.Qx * dA / (A * A);
+    gradient[SIZING_IY] = dIyy - 2 * m.Qy * dQy / A + m.Qy * m.Qy * dA / (A * A);
+}
+
+bool CSectionOptimizer::Solve(const std::vector<char>& variable, const SectionSizingTarget* targets,
+                              SectionSizingResult& result)
+{
+    auto startTime = std::chrono::steady_clock::now();
+    int sideCount = (int)m_sides.size();
+    result = SectionSizingResult();
+    result.offsets.assign(sideCount, 0.0);
+    Apply(result.offsets, nullptr);
+
+    std::vector<int> sides;
+    for (int s = 0; s < sideCount && s < (int)variable.size(); s++)
+    {
+        if (variable[s])
+            sides.push_back(s);
+    }
+
+    // Each bound is one constraint g >= 0, scaled by the bound
+    struct Constraint { int quantity; double sign, bound, scale; };
+    std::vector<Constraint> constraints;
+    for (int q = 0; q < SIZING_QUANTITY_COUNT; q++)
+    {
+        if (targets[q].hasMinimum)
+            constraints.push_back({ q, 1.0, targets[q].minimum, std::max(fabs(targets[q].minimum), 1e-30) });
+        if (targets[q].hasMaximum)
+            constraints.push_back({ q, -1.0, targets[q].maximum, std::max(fabs(targets[q].maximum), 1e-30) });
+    }
+
+    std::vector<double> g(constraints.size());
+    std::vector<int> rows;
+    std::vector<double> jacobian, rhs, sideStep, step(sideCount), trial;
+    double values[SIZING_QUANTITY_COUNT];
+    auto evaluate = [&]()
+    {
+        GetValues(values);
+        double merit = 0;
+        for (size_t c = 0; c < constraints.size(); c++)
+        {
+            g[c] = constraints[c].sign * (values[constraints[c].quantity] - constraints[c].bound) / constraints[c].scale;
+            if (g[c] < 0)
+                merit += g[c] * g[c];
+        }
+        return merit;
+    };
+
+    result.message = "Targets met";
+    double merit = evaluate();
+    for (;;)
+    {
+        bool violated = false;
+        for (double v : g)
+            violated |= (v < -TARGET_TOLERANCE);
+        if (!violated)
+        {
+            result.converged = true;
+            break;
+        }
+        if (sides.empty())
+        {
+            result.message = "No sides are selected";
+            break;
+        }
+        if (result.iterations == MAX_ITERATIONS)
+        {
+            result.message = "Did not converge";
+            break;
+        }
+        result.iterations++;
+
+        // Violated targets move to their bound; nearly active ones hold
+        rows.clear();
+        rhs.clear();
+        for (size_t c = 0; c < constraints.size(); c++)
+        {
+            if (g[c] < HOLD_MARGIN)
+            {
+                rows.push_back((int)c);
+                rhs.push_back(g[c] < 0 ? -g[c] : 0.0);
+            }
+        }
+        int m = (int)rows.size(), n = (int)sides.size();
+        jacobian.assign((size_t)m * n, 0.0);
+        for (int k = 0; k < n; k++)
+        {
+            double gradient[SIZING_QUANTITY_COUNT];
+            GetGradient(sides[k], gradient);
+            for (int r = 0; r < m; r++)
+            {
+                const Constraint& c = constraints[rows[r]];
+                jacobian[r * n + k] = c.sign * gradient[c.quantity] / c.scale;
+            }
+        }
+
+        // Minimum-norm step: the smallest offsets that meet the linearized targets
+        double largestGradient = 0;
+        for (double value : jacobian)
+            largestGradient = std::max(largestGradient, fabs(value));
+        if (largestGradient == 0)
+        {
+            result.message = "The selected sides cannot change these properties";
+            break;
+        }
+        if (!CSectionBoundary::MinimumNormStep(jacobian, m, n, rhs, sideStep))
+        {
+            result.message = "The targets conflict for the selected sides";
+            break;
+        }
+
+        double largest = 0, shortest = 1e300;
+        for (int k = 0; k < n; k++)
+        {
+            step[sides[k]] = sideStep[k];
+            largest = std::max(largest, fabs(sideStep[k]));
+
+            int next = Next(sides[k]);
+            double dx = m_corners[next * 2] - m_corners[sides[k] * 2];
+            double dy = m_corners[next * 2 + 1] - m_corners[sides[k] * 2 + 1];
+            shortest = std::min(shortest, sqrt(dx * dx + dy * dy));
+        }
+
+        // Limit the step to half the shortest moving side, then halve it
+        // until every side keeps its direction and the violation shrinks
+        double t = (largest > 0.5 * shortest) ? 0.5 * shortest / largest : 1.0;
+        bool accepted = false, anyValid = false;
+        trial = result.offsets;
+        for (int h = 0; h < MAX_HALVINGS && !accepted; h++, t *= 0.5)
+        {
+            for (int s : sides)
+                trial[s] = result.offsets[s] + t * step[s];
+            if (Apply(trial, &sides))
+            {
+                anyValid = true;
+                double trialMerit = evaluate();
+                if (trialMerit < merit)
+                {
+                    merit = trialMerit;
+                    result.offsets = trial;
+                    accepted = true;
+                }
+            }
+        }
+        if (!accepted)
+        {
+            Apply(result.offsets, &sides);
+            evaluate();
+            result.message = anyValid ? "The targets cannot all be met by the selected sides"
+                                      : "A side would collapse before the targets are met";
+            break;
+        }
+    }
+
+    // Report from a full integration rather than the running sums
+    Apply(result.offsets, nullptr);
+    GetValues(result.values);
+    result.elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+    return result.converged;
+}
+
+bool CSectionOptimizer::Evaluate(const std::vector<double>& offsets, double* values)
+{
+    bool valid = Apply(offsets, nullptr);
+    GetValues(values);
+    return valid;
+}
+
+bool CSectionOptimizer::BuildLoops(const std::vector<double>& offsets, std::vector<SectionBoundaryLoop>& loops)
+{
+    bool valid = Apply(offsets, nullptr);
+    loops.resize(m_loopFirst.size() - 1);
+    for (size_t l = 0; l + 1 < m_loopFirst.size(); l++)
+    {
+        loops[l].points.assign(m_corners.begin() + m_loopFirst[l] * 2, m_corners.begin() + m_loopFirst[l + 1] * 2);
+        loops[l].hole = CSectionBoundary::LoopArea(loops[l]) < 0;
+    }
+    return valid;
+}
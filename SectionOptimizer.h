@@ -0,0 +1,107 @@
+// SectionOptimizer.h: Target-driven sizing of section boundary offsets
+//////////////////////////////////////////////////////////////////////
+
+#ifndef SECTION_OPTIMIZER_H
+#define SECTION_OPTIMIZER_H
+
+#include "SectionBoundary.h"
+#include <vector>
+
+// A straight run of boundary edges that moves as one, parallel to itself
+struct SectionSide
+{
+    int loop;                   // Among the loops with sides, not the input loops
+    bool hole;
+    double nx, ny;              // Outward unit normal, away from the material
+    double c;                   // The side lies on n . p = c at zero offset
+    double x0, y0, x1, y1;      // End points at zero offset
+    double length;
+};
+
+// Quantities a target can bound
+enum SectionSizingQuantity
+{
+    SIZING_AREA = 0,            // cm^2
+    SIZING_IX,                  // Centroidal, cm^4
+    SIZING_IY,
+    SIZING_QUANTITY_COUNT
+};
+
+struct SectionSizingTarget
+{
+    bool hasMinimum = false;
+    bool hasMaximum = false;
+    double minimum = 0;
+    double maximum = 0;
+};
+
+struct SectionSizingResult
+{
+    bool converged = false;
+    int iterations = 0;
+    double elapsedMs = 0;
+    const char* message = "";
+    std::vector<double> offsets;                    // Per side, cm, outward positive
+    double values[SIZING_QUANTITY_COUNT] = {};      // At the offsets
+};
+
+// Finds offsets of the chosen sides that meet the targets with small
+// moves. Straight sides are lines n . p = c + d; corners are where
+// neighbouring lines meet, so a section stays polygonal for any offsets and
+// its properties follow exactly from Green's theorem over the corners.
+//
+// Moving a side by d changes any area integral at the rate of the
+// integral along the side, so the gradients of A, Ix and Iy are closed
+// form. Each iteration is a minimum-norm Gauss-Newton step on the violated
+// targets, holding those that are just met, with a step halved until no
+// side turns inside out. Only the edges next to a moved side are
+// re-integrated between trials.
+class CSectionOptimizer
+{
+public:
+    enum
+    {
+        MAX_ITERATIONS = 50,
+        MAX_HALVINGS = 20
+    };
+
+    CSectionOptimizer();
+
+    // Merge collinear edges of the loops into sides
+    void SetBoundary(const std::vector<SectionBoundaryLoop>& loops);
+
+    int GetSideCount() const { return (int)m_sides.size(); }
+    const SectionSide& GetSide(int index) const { return m_sides[index]; }
+
+    // Solve for the sides flagged in 'variable' (one per side) against
+    // SIZING_QUANTITY_COUNT targets
+    bool Solve(const std::vector<char>& variable, const SectionSizingTarget* targets,
+               SectionSizingResult& result);
+
+    // Properties (SIZING_*) and loops at the given offsets
+    bool Evaluate(const std::vector<double>& offsets, double* values);
+    bool BuildLoops(const std::vector<double>& offsets, std::vector<SectionBoundaryLoop>& loops);
+
+private:
+    int Previous(int side) const;
+    int Next(int side) const;
+
+    // Move to 'offsets', recomputing only the corners and edges next to the
+    // sides in 'changed' (all sides if null); false if a side turned over
+    bool Apply(const std::vector<double>& offsets, const std::vector<int>* changed);
+    void UpdateCorner(int side);
+    void UpdateEdge(int side);
+    void GetValues(double* values) const;
+    void GetGradient(int side, double* gradient) const;
+
+    std::vector<SectionSide> m_sides;
+    std::vector<int> m_loopFirst;               // First side of each loop, plus the end
+
+    // State at m_offsets
+    std::vector<double> m_offsets;
+    std::vector<double> m_corners;              // Start corner of each side, x, y
+    std::vector<SectionPolygonMoments> m_edges; // Green's terms of each side's edge
+    SectionPolygonMoments m_total;
+};
+
+#endif // SECTION_OPTIMIZER_H
@@ -0,0 +1,374 @@
+// SectionPropertyGraph.cpp: Lazily evaluated section property dependency graph
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "SectionPropertyGraph.h"
+#include "AreaMomentsCalculator.h"
+
+#include <cmath>
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+// Direct dependencies of each node
+static const unsigned int s_nodeDependencies[SECTION_NODE_COUNT] =
+{
+    0,                                                          // AREA_CENTROID
+    0,                                                          // ORIGIN_MOMENTS
+    SECTION_NODE_BIT(SECTION_NODE_AREA_CENTROID),               // CENTROID_MOMENTS
+    SECTION_NODE_BIT(SECTION_NODE_CENTROID_MOMENTS),            // PRINCIPAL
+    SECTION_NODE_BIT(SECTION_NODE_CENTROID_MOMENTS),            // RADII
+    SECTION_NODE_BIT(SECTION_NODE_AREA_CENTROID),               // EXTREME_FIBERS
+    SECTION_NODE_BIT(SECTION_NODE_CENTROID_MOMENTS) |
+        SECTION_NODE_BIT(SECTION_NODE_EXTREME_FIBERS),          // SECTION_MODULUS
+};
+
+CSectionPropertyGraph::CSectionPropertyGraph()
+    : m_perimeter(0), m_simplifyTolerance(0), m_hasPreview(false), m_hasContributions(false),
+      m_hasShapeMoments(false), m_hasKern(false), m_hasBoundary(false)
+{
+}
+
+void CSectionPropertyGraph::SetMesh(std::vector<double>&& vertices2D, std::vector<int>&& indices,
+                                    double perimeter, ImGuiAreaMomentsResult& result)
+{
+    m_vertices2D = std::move(vertices2D);
+    m_indices = std::move(indices);
+    m_perimeter = perimeter;
+    m_previewVertices2D.clear();
+    m_previewIndices.clear();
+    m_simplifyStats = MeshSimplifyStats();
+    m_hasPreview = false;
+    m_nodes = ImGuiAreaMomentsResult();
+    m_hasContributions = false;
+    m_hasShapeMoments = false;
+    m_hasKern = false;
+    m_hasBoundary = false;
+    result.computed = 0;
+}
+
+void CSectionPropertyGraph::Restore(const ImGuiAreaMomentsResult& result, const SectionShapeMoments& moments)
+{
+    for (int node = 0; node < SECTION_NODE_COUNT; node++)
+    {
+        if (result.Has(SECTION_NODE_BIT(node)))
+            CopyNode(node, result, m_nodes);
+    }
+    m_nodes.computed |= result.computed & SECTION_NODES_ALL;
+    m_shapeMoments = moments;
+    m_hasShapeMoments = true;
+    ReleaseCaptured();
+}
+
+void CSectionPropertyGraph::SetSimplifyTolerance(double tolerance)
+{
+    m_simplifyTolerance = tolerance;
+    ReleaseCaptured();
+}
+
+void CSectionPropertyGraph::RequirePreview() const
+{
+    if (m_hasPreview || m_simplifyTolerance <= 0 || m_indices.empty())
+        return;
+    m_hasPreview = true;
+
+    std::vector<double> vertices2D = m_vertices2D;
+    std::vector<int> indices = m_indices;
+    MeshSimplifyStats stats;
+    if (!CMeshSimplifier::Simplify(vertices2D, indices, m_simplifyTolerance, stats))
+        return;
+
+    // The simplifier writes in place; keep only what the result needs
+    vertices2D.shrink_to_fit();
+    indices.shrink_to_fit();
+    m_previewVertices2D.swap(vertices2D);
+    m_previewIndices.swap(indices);
+    m_simplifyStats = stats;
+}
+
+void CSectionPropertyGraph::ReleaseCaptured() const
+{
+    if (m_simplifyTolerance <= 0 || m_indices.empty() || m_nodes.computed != SECTION_NODES_ALL ||
+        !m_hasShapeMoments || !m_hasKern || !m_hasBoundary)
+        return;
+
+    // Without a simplified mesh the captured one is all there is
+    RequirePreview();
+    if (m_previewIndices.empty())
+        return;
+    std::vector<double>().swap(m_vertices2D);
+    std::vector<int>().swap(m_indices);
+}
+
+size_t CSectionPropertyGraph::GetMeshBytes() const
+{
+    size_t bytes = m_vertices2D.capacity() * sizeof(double) + m_indices.capacity() * sizeof(int) +
+                   m_previewVertices2D.capacity() * sizeof(double) + m_previewIndices.capacity() * sizeof(int);
+    for (const SectionBoundaryLoop& loop : m_boundary)
+        bytes += loop.points.capacity() * sizeof(double);
+    return bytes;
+}
+
+unsigned int CSectionPropertyGraph::Closure(unsigned int nodeMask)
+{
+    // Nodes are declared in dependency order, so walking backwards
+    // visits every dependent before the nodes it pulls in
+    unsigned int mask = nodeMask & SECTION_NODES_ALL;
+    for (int node = SECTION_NODE_COUNT - 1; node >= 0; node--)
+    {
+        if (mask & SECTION_NODE_BIT(node))
+            mask |= s_nodeDependencies[node];
+    }
+    return mask;
+}
+
+unsigned int CSectionPropertyGraph::Require(unsigned int nodeMask, ImGuiAreaMomentsResult& result) const
+{
+    unsigned int pending = Closure(nodeMask) & ~result.computed;
+    if (pending == 0 || !HasMesh())
+        return 0;
+
+    // Nodes are evaluated once, from the captured mesh, into the graph's
+    // own result and copied from there to whichever result asks
+    unsigned int missing = Closure(pending) & ~m_nodes.computed;
+    for (int node = 0; node < SECTION_NODE_COUNT; node++)
+    {
+        if (missing & SECTION_NODE_BIT(node))
+        {
+            Evaluate(node, m_nodes);
+            m_nodes.computed |= SECTION_NODE_BIT(node);
+        }
+        if (pending & SECTION_NODE_BIT(node))
+            CopyNode(node, m_nodes, result);
+    }
+    result.computed |= pending;
+
+    ReleaseCaptured();
+    return pending;
+}
+
+const SectionContributions& CSectionPropertyGraph::RequireContributions(ImGuiAreaMomentsResult& result) const
+{
+    if (m_hasContributions || !HasMesh())
+        return m_contributions;
+
+    // The shares are over the mesh the heatmap draws; the node values
+    // still come from the captured mesh
+    Require(SECTION_NODE_BIT(SECTION_NODE_CENTROID_MOMENTS), result);
+    RequirePreview();
+    ImGuiAreaMomentsResult shares;
+    shares.Cx = result.Cx;
+    shares.Cy = result.Cy;
+    EvaluateCentroidMoments(GetPreviewVertices2D(), GetPreviewIndices(), shares, &m_contributions);
+    m_hasContributions = true;
+    return m_contributions;
+}
+
+const SectionShapeMoments& CSectionPropertyGraph::RequireShapeMoments(ImGuiAreaMomentsResult& result) const
+{
+    if (m_hasShapeMoments || !HasMesh())
+        return m_shapeMoments;
+
+    Require(SECTION_NODE_BIT(SECTION_NODE_AREA_CENTROID), result);
+    CMomentInvariants::Calculate(m_vertices2D, m_indices, result.Cx, result.Cy, m_shapeMoments);
+    m_hasShapeMoments = true;
+    ReleaseCaptured();
+    return m_shapeMoments;
+}
+
+const SectionKern& CSectionPropertyGraph::RequireKern(ImGuiAreaMomentsResult& result) const
+{
+    if (m_hasKern || !HasMesh())
+        return m_kern;
+
+    Require(SECTION_NODE_BIT(SECTION_NODE_CENTROID_MOMENTS), result);
+    CSectionKern::Calculate(m_vertices2D, result.area, result.Cx, result.Cy,
+                            result.Ix_centroid, result.Iy_centroid, result.Ixy_centroid, m_kern);
+    m_hasKern = true;
+    ReleaseCaptured();
+    return m_kern;
+}
+
+const std::vector<SectionBoundaryLoop>& CSectionPropertyGraph::RequireBoundary() const
+{
+    if (!m_hasBoundary && HasMesh())
+    {
+        CSectionBoundary::ExtractLoops(m_vertices2D, m_indices, m_boundary);
+        m_hasBoundary = true;
+        ReleaseCaptured();
+    }
+    return m_boundary;
+}
+
+void CSectionPropertyGraph::CopyNode(int node, const ImGuiAreaMomentsResult& from, ImGuiAreaMomentsResult& to)
+{
+    switch (node)
+    {
+    case SECTION_NODE_AREA_CENTROID:
+        to.area = from.area;
+        to.perimeter = from.perimeter;
+        to.Cx = from.Cx;
+        to.Cy = from.Cy;
+        break;
+
+    case SECTION_NODE_ORIGIN_MOMENTS:
+        to.Ixx_origin = from.Ixx_origin;
+        to.Iyy_origin = from.Iyy_origin;
+        to.Ixy_origin = from.Ixy_origin;
+        to.J_origin = from.J_origin;
+        break;
+
+    case SECTION_NODE_CENTROID_MOMENTS:
+        to.Ix_centroid = from.Ix_centroid;
+        to.Iy_centroid = from.Iy_centroid;
+        to.Ixy_centroid = from.Ixy_centroid;
+        to.J_centroid = from.J_centroid;
+        break;
+
+    case SECTION_NODE_PRINCIPAL:
+        to.Ix_principal = from.Ix_principal;
+        to.Iy_principal = from.Iy_principal;
+        to.theta_deg = from.theta_deg;
+        break;
+
+    case SECTION_NODE_RADII:
+        to.Rx = from.Rx;
+        to.Ry = from.Ry;
+        break;
+
+    case SECTION_NODE_EXTREME_FIBERS:
+        to.cx_max = from.cx_max;
+        to.cy_max = from.cy_max;
+        break;
+
+    case SECTION_NODE_SECTION_MODULUS:
+        to.Sx_min = from.Sx_min;
+        to.Sy_min = from.Sy_min;
+        break;
+    }
+}
+
+void CSectionPropertyGraph::EvaluateCentroidMoments(const std::vector<double>& vertices2D,
+                                                    const std::vector<int>& indices, ImGuiAreaMomentsResult& r,
+                                                    SectionContributions* contributions) const
+{
+    TriangleContribution* shares = nullptr;
+    if (contributions != nullptr)
+    {
+        // resize() keeps the capacity of an earlier mesh
+        contributions->triangles.resize(indices.size() / 3);
+        shares = contributions->triangles.data();
+    }
+
+    CAreaMomentsCalculator::CalculateCentroidMoments(vertices2D, indices, r.Cx, r.Cy,
+                                                     r.Ix_centroid, r.Iy_centroid, r.Ixy_centroid, shares);
+
+    // Sums over clockwise triangles come out negated; Ix + Iy of a real
+    // region is always positive, so use it to fix the orientation
+    bool flip = r.Ix_centroid + r.Iy_centroid < 0;
+    if (flip)
+    {
+        r.Ix_centroid = -r.Ix_centroid;
+        r.Iy_centroid = -r.Iy_centroid;
+        r.Ixy_centroid = -r.Ixy_centroid;
+    }
+    r.J_centroid = r.Ix_centroid + r.Iy_centroid;
+
+    if (contributions != nullptr)
+    {
+        if (flip)
+        {
+            for (size_t i = 0; i < contributions->triangles.size(); i++)
+            {
+                contributions->triangles[i].Ix = -contributions->triangles[i].Ix;
+                contributions->triangles[i].Iy = -contributions->triangles[i].Iy;
+            }
+        }
+        contributions->Ix = r.Ix_centroid;
+        contributions->Iy = r.Iy_centroid;
+    }
+}
+
+void CSectionPropertyGraph::Evaluate(int node, ImGuiAreaMomentsResult& r) const
+{
+    switch (node)
+    {
+    case SECTION_NODE_AREA_CENTROID:
+    {
+        double signedArea = 0;
+        CAreaMomentsCalculator::CalculateAreaCentroid(m_vertices2D, m_indices, signedArea, r.Cx, r.Cy);
+        r.area = fabs(signedArea);
+        r.perimeter = m_perimeter;
+        break;
+    }
+
+    case SECTION_NODE_ORIGIN_MOMENTS:
+    {
+        CAreaMomentsCalculator::CalculateOriginMoments(m_vertices2D, m_indices,
+                                                       r.Ixx_origin, r.Iyy_origin, r.Ixy_origin);
+
+        // Sums over clockwise triangles come out negated; Ixx + Iyy of a
+        // real region is always positive, so use it to fix the orientation
+        if (r.Ixx_origin + r.Iyy_origin < 0)
+        {
+            r.Ixx_origin = -r.Ixx_origin;
+            r.Iyy_origin = -r.Iyy_origin;
+            r.Ixy_origin = -r.Ixy_origin;
+        }
+        r.J_origin = r.Ixx_origin + r.Iyy_origin;
+        break;
+    }
+
+    case SECTION_NODE_CENTROID_MOMENTS:
+        EvaluateCentroidMoments(m_vertices2D, m_indices, r, nullptr);
+        break;
+
+    case SECTION_NODE_PRINCIPAL:
+    {
+        double Iavg = (r.Ix_centroid + r.Iy_centroid) / 2.0;
+        double Idiff = (r.Ix_centroid - r.Iy_centroid) / 2.0;
+        double R = sqrt(Idiff * Idiff + r.Ixy_centroid * r.Ixy_centroid);
+
+        r.Ix_principal = Iavg - R;
+        r.Iy_principal = Iavg + R;
+
+        double theta = 0;
+        if (fabs(r.Ixy_centroid) >= 1e-15 || fabs(Idiff) >= 1e-15)
+            theta = 0.5 * atan2(-2.0 * r.Ixy_centroid, r.Ix_centroid - r.Iy_centroid);
+        r.theta_deg = theta * 180.0 / 3.14159265358979323846;
+        break;
+    }
+
+    case SECTION_NODE_RADII:
+        r.Rx = r.Ry = 0;
+        if (r.area > 1e-10)
+        {
+            r.Rx = sqrt(r.Ix_centroid / r.area);
+            r.Ry = sqrt(r.Iy_centroid / r.area);
+        }
+        break;
+
+    case SECTION_NODE_EXTREME_FIBERS:
+        r.cx_max = 0;
+        r.cy_max = 0;
+        for (size_t i = 0; i + 1 < m_vertices2D.size(); i += 2)
+        {
+            double dx = fabs(m_vertices2D[i] - r.Cx);
+            double dy = fabs(m_vertices2D[i + 1] - r.Cy);
+            if (dx > r.cx_max) r.cx_max = dx;
+            if (dy > r.cy_max) r.cy_max = dy;
+        }
+        break;
+
+    case SECTION_NODE_SECTION_MODULUS:
+        r.Sx_min = r.Sy_min = 0;
+        if (r.cy_max > 1e-10)
+            r.Sx_min = r.Ix_centroid / r.cy_max;
+        if (r.cx_max > 1e-10)
+            r.Sy_min = r.Iy_centroid / r.cx_max;
+        break;
+    }
+}
@@ -0,0 +1,165 @@
+// SectionPropertyGraph.h: Lazily evaluated section property dependency graph
+//////////////////////////////////////////////////////////////////////
+
+#ifndef SECTION_PROPERTY_GRAPH_H
+#define SECTION_PROPERTY_GRAPH_H
+
+#include "AreaMomentsCalculator.h"
+#include "MomentInvariants.h"
+#include "SectionKern.h"
+#include "SectionBoundary.h"
+#include "MeshSimplifier.h"
+
+#include <vector>
+#include <string>
+
+// Nodes of the property graph. Each node computes a group of related
+// properties and may depend on other nodes (see CSectionPropertyGraph).
+enum SectionPropertyNode
+{
+    SECTION_NODE_AREA_CENTROID = 0,  // area, perimeter, Cx, Cy
+    SECTION_NODE_ORIGIN_MOMENTS,     // Ixx, Iyy, Ixy, J about the local origin
+    SECTION_NODE_CENTROID_MOMENTS,   // Ix, Iy, Ixy, J about the centroid
+    SECTION_NODE_PRINCIPAL,          // principal moments and angle
+    SECTION_NODE_RADII,              // radii of gyration
+    SECTION_NODE_EXTREME_FIBERS,     // extreme fiber distances from the centroid
+    SECTION_NODE_SECTION_MODULUS,    // elastic section moduli
+    SECTION_NODE_COUNT
+};
+
+#define SECTION_NODE_BIT(node)  (1u << (node))
+#define SECTION_NODES_ALL       ((1u << SECTION_NODE_COUNT) - 1u)
+
+// Result structure
+struct ImGuiAreaMomentsResult
+{
+    double area = 0;
+    double perimeter = 0;
+    double Cx = 0, Cy = 0;
+    double Ixx_origin = 0, Ixy_origin = 0, Iyy_origin = 0;
+    double J_origin = 0;
+    double Ix_centroid = 0, Iy_centroid = 0, Ixy_centroid = 0;
+    double Ix_principal = 0, Iy_principal = 0;
+    double J_centroid = 0;
+    double theta_deg = 0;
+    double Rx = 0, Ry = 0;
+    double Sx_min = 0, Sy_min = 0;
+    double cx_max = 0, cy_max = 0;
+    std::string faceType;
+    unsigned int computed = 0;  // SECTION_NODE_BIT mask of evaluated nodes
+
+    bool Has(unsigned int nodeMask) const { return (computed & nodeMask) == nodeMask; }
+};
+
+// Per-triangle shares of the centroidal moments, for the contribution heatmap
+struct SectionContributions
+{
+    std::vector<TriangleContribution> triangles;    // In index order; J = Ix + Iy
+    double Ix = 0, Iy = 0;                          // Totals of the shares
+};
+
+// Holds the projected mesh of one face and evaluates property nodes on
+// demand. Evaluated nodes are memoized in the result's 'computed' mask,
+// and in the graph, so asking for a node twice costs nothing.
+class CSectionPropertyGraph
+{
+public:
+    CSectionPropertyGraph();
+
+    // Take ownership of the projected 2D mesh; clears memoized nodes of 'result'
+    void SetMesh(std::vector<double>&& vertices2D, std::vector<int>&& indices,
+                 double perimeter, ImGuiAreaMomentsResult& result);
+
+    // Take the nodes of 'result' and the shape moments as evaluated, e.g.
+    // when they were restored from the result cache
+    void Restore(const ImGuiAreaMomentsResult& result, const SectionShapeMoments& moments);
+
+    bool HasMesh() const { return !m_indices.empty() || !m_previewIndices.empty(); }
+
+    // Keep a simplified mesh (see CMeshSimplifier) for the contribution
+    // heatmap, made when it is first drawn. Everything else is still
+    // evaluated on demand from the captured mesh, which is dropped once
+    // every node, the shape moments, the kern and the boundary have been.
+    // 0 keeps the captured mesh only.
+    void SetSimplifyTolerance(double tolerance);
+
+    // How the mesh was simplified; inputTriangles is 0 if it was not (yet)
+    const MeshSimplifyStats& GetSimplifyStats() const { return m_simplifyStats; }
+
+    // Triangles held, captured and simplified
+    int GetTriangleCount() const { return (int)(m_indices.size() + m_previewIndices.size()) / 3; }
+
+    // Bytes held by the meshes and the boundary loops kept with them
+    size_t GetMeshBytes() const;
+
+    // Evaluate the requested nodes and everything they depend on.
+    // Returns the mask of nodes that were evaluated by this call.
+    unsigned int Require(unsigned int nodeMask, ImGuiAreaMomentsResult& result) const;
+
+    // Requested nodes plus all of their transitive dependencies
+    static unsigned int Closure(unsigned int nodeMask);
+
+    // Per-triangle contributions over the preview mesh, filled by the
+    // centroid moments kernel on first use and kept in a buffer reused
+    // until the mesh changes. Also evaluates the area, centroid and
+    // centroid moments nodes of 'result'.
+    const SectionContributions& RequireContributions(ImGuiAreaMomentsResult& result) const;
+
+    // Central moments up to SHAPE_MOMENT_ORDER and the Hu and affine
+    // invariants, computed on first use; evaluates the area centroid node
+    const SectionShapeMoments& RequireShapeMoments(ImGuiAreaMomentsResult& result) const;
+
+    // Convex hull of the mesh and the kern, computed on first use;
+    // evaluates the centroid moments node
+    const SectionKern& RequireKern(ImGuiAreaMomentsResult& result) const;
+
+    // Boundary loops of the mesh, extracted on first use
+    const std::vector<SectionBoundaryLoop>& RequireBoundary() const;
+
+    // Mesh the contributions are per triangle of: the simplified one once
+    // made, else the captured one
+    const std::vector<double>& GetPreviewVertices2D() const
+    {
+        return m_previewIndices.empty() ? m_vertices2D : m_previewVertices2D;
+    }
+    const std::vector<int>& GetPreviewIndices() const
+    {
+        return m_previewIndices.empty() ? m_indices : m_previewIndices;
+    }
+
+private:
+    void Evaluate(int node, ImGuiAreaMomentsResult& r) const;
+
+    // Copy the properties of one node
+    static void CopyNode(int node, const ImGuiAreaMomentsResult& from, ImGuiAreaMomentsResult& to);
+
+    // Centroid moments node; also writes per-triangle shares if asked
+    void EvaluateCentroidMoments(const std::vector<double>& vertices2D, const std::vector<int>& indices,
+                                 ImGuiAreaMomentsResult& r, SectionContributions* contributions) const;
+
+    // Simplify a copy of the captured mesh, once, if a tolerance is set
+    void RequirePreview() const;
+
+    // Drop the captured mesh once nothing is left to evaluate from it
+    void ReleaseCaptured() const;
+
+    mutable std::vector<double> m_vertices2D;           // Captured mesh, until released
+    mutable std::vector<int> m_indices;
+    mutable std::vector<double> m_previewVertices2D;    // Simplified mesh, once made
+    mutable std::vector<int> m_previewIndices;
+    double m_perimeter;
+    double m_simplifyTolerance;
+    mutable MeshSimplifyStats m_simplifyStats;
+    mutable bool m_hasPreview;
+    mutable ImGuiAreaMomentsResult m_nodes;             // Every node evaluated so far, for any result
+    mutable SectionContributions m_contributions;
+    mutable bool m_hasContributions;
+    mutable SectionShapeMoments m_shapeMoments;
+    mutable bool m_hasShapeMoments;
+    mutable SectionKern m_kern;
+    mutable bool m_hasKern;
+    mutable std::vector<SectionBoundaryLoop> m_boundary;
+    mutable bool m_hasBoundary;
+};
+
+#endif // SECTION_PROPERTY_GRAPH_H
@@ -0,0 +1,392 @@
+// SectionResultStore.cpp: Columnar storage for per-face section results
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "SectionResultStore.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+#define NODE(n) SECTION_NODE_BIT(SECTION_NODE_##n)
+
+static const SectionResultColumnInfo s_columnInfo[RESULT_COL_COUNT] =
+{
+    { "Area",      2, NODE(AREA_CENTROID),     "A" },
+    { "Perimeter", 1, NODE(AREA_CENTROID),     "P" },
+    { "Cx",        1, NODE(AREA_CENTROID),     "Cx" },
+    { "Cy",        1, NODE(AREA_CENTROID),     "Cy" },
+    { "Ixx (O)",   4, NODE(ORIGIN_MOMENTS),    "Ixx_o" },
+    { "Ixy (O)",   4, NODE(ORIGIN_MOMENTS),    "Ixy_o" },
+    { "Iyy (O)",   4, NODE(ORIGIN_MOMENTS),    "Iyy_o" },
+    { "Izz (O)",   4, NODE(ORIGIN_MOMENTS),    "Izz_o" },
+    { "Ix",        4, NODE(CENTROID_MOMENTS),  "Ix" },
+    { "Iy",        4, NODE(CENTROID_MOMENTS),  "Iy" },
+    { "Ixy",       4, NODE(CENTROID_MOMENTS),  "Ixy" },
+    { "I1",        4, NODE(PRINCIPAL),         "I1" },
+    { "I2",        4, NODE(PRINCIPAL),         "I2" },
+    { "Iz",        4, NODE(CENTROID_MOMENTS),  "Iz" },
+    { "Angle",     0, NODE(PRINCIPAL),         "theta" },
+    { "Rx",        1, NODE(RADII),             "Rx" },
+    { "Ry",        1, NODE(RADII),             "Ry" },
+    { "Sx",        3, NODE(SECTION_MODULUS),   "Sx" },
+    { "Sy",        3, NODE(SECTION_MODULUS),   "Sy" },
+    { "c_x",       1, NODE(EXTREME_FIBERS),    "c_x" },
+    { "c_y",       1, NODE(EXTREME_FIBERS),    "c_y" },
+};
+
+#undef NODE
+
+// Struct field backing each column, for gather/scatter
+static double ImGuiAreaMomentsResult::* const s_columnFields[RESULT_COL_COUNT] =
+{
+    &ImGuiAreaMomentsResult::area,
+    &ImGuiAreaMomentsResult::perimeter,
+    &ImGuiAreaMomentsResult::Cx,
+    &ImGuiAreaMomentsResult::Cy,
+    &ImGuiAreaMomentsResult::Ixx_origin,
+    &ImGuiAreaMomentsResult::Ixy_origin,
+    &ImGuiAreaMomentsResult::Iyy_origin,
+    &ImGuiAreaMomentsResult::J_origin,
+    &ImGuiAreaMomentsResult::Ix_centroid,
+    &ImGuiAreaMomentsResult::Iy_centroid,
+    &ImGuiAreaMomentsResult::Ixy_centroid,
+    &ImGuiAreaMomentsResult::Ix_principal,
+    &ImGuiAreaMomentsResult::Iy_principal,
+    &ImGuiAreaMomentsResult::J_centroid,
+    &ImGuiAreaMomentsResult::theta_deg,
+    &ImGuiAreaMomentsResult::Rx,
+    &ImGuiAreaMomentsResult::Ry,
+    &ImGuiAreaMomentsResult::Sx_min,
+    &ImGuiAreaMomentsResult::Sy_min,
+    &ImGuiAreaMomentsResult::cx_max,
+    &ImGuiAreaMomentsResult::cy_max,
+};
+
+CSectionResultStore::CSectionResultStore()
+    : m_version(0)
+{
+    Clear();
+}
+
+const SectionResultColumnInfo& CSectionResultStore::GetColumnInfo(int column)
+{
+    return s_columnInfo[column];
+}
+
+double CSectionResultStore::GetResultValue(const ImGuiAreaMomentsResult& result, int column)
+{
+    return result.*s_columnFields[column];
+}
+
+void CSectionResultStore::SetResultValue(ImGuiAreaMomentsResult& result, int column, double value)
+{
+    result.*s_columnFields[column] = value;
+}
+
+void CSectionResultStore::Clear()
+{
+    m_version++;
+    for (int c = 0; c < RESULT_COL_COUNT; c++)
+        m_columns[c].clear();
+    m_computed.clear();
+    m_faceTypes.clear();
+    m_flags.clear();
+    m_faces.clear();
+    m_lineageKeys.clear();
+    m_graphs.clear();
+    m_nameArena.clear();
+    m_nameOffsets.clear();
+
+    // ID 0 is the generic type so unset rows still resolve to a name
+    m_faceTypeNames.clear();
+    m_faceTypeNames.push_back("Face");
+}
+
+void CSectionResultStore::Reserve(int rows, size_t nameBytes)
+{
+    for (int c = 0; c < RESULT_COL_COUNT; c++)
+        m_columns[c].reserve(rows);
+    m_computed.reserve(rows);
+    m_faceTypes.reserve(rows);
+    m_flags.reserve(rows);
+    m_faces.reserve(rows);
+    m_lineageKeys.reserve(rows);
+    m_graphs.reserve(rows);
+    m_nameOffsets.reserve(rows);
+    m_nameArena.reserve(nameBytes);
+}
+
+int CSectionResultStore::AddRow(const char* name, void* pFace)
+{
+    int row = GetRowCount();
+
+    m_version++;
+    for (int c = 0; c < RESULT_COL_COUNT; c++)
+        m_columns[c].push_back(0.0);
+    m_computed.push_back(0);
+    m_faceTypes.push_back(0);
+    m_flags.push_back(0);
+    m_faces.push_back(pFace);
+    m_lineageKeys.push_back(0);
+    m_graphs.push_back(nullptr);
+    m_nameOffsets.push_back(0);
+
+    SetName(row, name);
+    return row;
+}
+
+int CSectionResultStore::AddFaceRows(void* const* faces, int count)
+{
+    int first = GetRowCount();
+    int total = first + count;
+
+    m_version++;
+    for (int c = 0; c < RESULT_COL_COUNT; c++)
+        m_columns[c].resize(total, 0.0);
+    m_computed.resize(total, 0);
+    m_faceTypes.resize(total, 0);
+    m_flags.resize(total, ROW_NUMBERED_NAME);
+    m_faces.insert(m_faces.end(), faces, faces + count);
+    m_lineageKeys.resize(total, 0);
+    m_graphs.resize(total);
+    m_nameOffsets.resize(total, 0);
+
+    // "Face " plus up to six digits and the terminator
+    m_nameArena.reserve(m_nameArena.size() + (size_t)count * 12);
+    for (int row = first; row < total; row++)
+        SetNumberedName(row, 0);
+    return first;
+}
+
+void CSectionResultStore::SetNumberedName(int row, uint16_t faceType)
+{
+    const std::string& typeName = m_faceTypeNames[faceType];
+
+    char digits[12];
+    int length = 0;
+    for (unsigned int n = (unsigned int)row + 1; n != 0; n /= 10)
+        digits[length++] = (char)('0' + n % 10);
+
+    m_nameOffsets[row] = (uint32_t)m_nameArena.size();
+    m_nameArena.insert(m_nameArena.end(), typeName.begin(), typeName.end());
+    m_nameArena.push_back(' ');
+    while (length > 0)
+        m_nameArena.push_back(digits[--length]);
+    m_nameArena.push_back('\0');
+}
+
+void CSectionResultStore::SetName(int row, const char* name)
+{
+    // Names are append-only; a renamed row leaves its old bytes behind
+    // until the next Clear()
+    m_version++;
+    m_flags[row] &= ~ROW_NUMBERED_NAME;
+    size_t len = strlen(name);
+    m_nameOffsets[row] = (uint32_t)m_nameArena.size();
+    m_nameArena.insert(m_nameArena.end(), name, name + len + 1);
+}
+
+bool CSectionResultStore::HasAnyResult() const
+{
+    for (size_t i = 0; i < m_flags.size(); i++)
+    {
+        if (m_flags[i] & ROW_HAS_RESULT)
+            return true;
+    }
+    return false;
+}
+
+uint16_t CSectionResultStore::InternFaceType(const std::string& faceType)
+{
+    for (size_t i = 0; i < m_faceTypeNames.size(); i++)
+    {
+        if (m_faceTypeNames[i] == faceType)
+            return (uint16_t)i;
+    }
+    m_faceTypeNames.push_back(faceType);
+    return (uint16_t)(m_faceTypeNames.size() - 1);
+}
+
+void CSectionResultStore::SetResult(int row, const ImGuiAreaMomentsResult& result,
+                                    std::unique_ptr<CSectionPropertyGraph> graph)
+{
+    StoreResult(row, result);
+    if (!result.faceType.empty())
+    {
+        uint16_t faceType = InternFaceType(result.faceType);
+        if ((m_flags[row] & ROW_NUMBERED_NAME) && faceType != m_faceTypes[row])
+            SetNumberedName(row, faceType);
+        m_faceTypes[row] = faceType;
+    }
+    m_graphs[row] = std::move(graph);
+    m_flags[row] |= ROW_HAS_RESULT;
+}
+
+void CSectionResultStore::StoreResult(int row, const ImGuiAreaMomentsResult& result)
+{
+    m_version++;
+    WriteColumns(row, result);
+}
+
+void CSectionResultStore::WriteColumns(int row, const ImGuiAreaMomentsResult& result)
+{
+    for (int c = 0; c < RESULT_COL_COUNT; c++)
+        m_columns[c][row] = result.*s_columnFields[c];
+    m_computed[row] = result.computed;
+}
+
+void CSectionResultStore::LoadResult(int row, ImGuiAreaMomentsResult& result) const
+{
+    // Face type is not gathered; it is only needed when a result is stored
+    for (int c = 0; c < RESULT_COL_COUNT; c++)
+        result.*s_columnFields[c] = m_columns[c][row];
+    result.computed = m_computed[row];
+}
+
+void CSectionResultStore::ReadRow(int row, SectionResultRow& view) const
+{
+    view.name = GetName(row);
+    view.pFace = m_faces[row];
+    view.hasResult = HasResult(row);
+    view.quick = IsQuickResult(row);
+    LoadResult(row, view.result);
+}
+
+void CSectionResultStore::ClearResult(int row)
+{
+    m_version++;
+    for (int c = 0; c < RESULT_COL_COUNT; c++)
+        m_columns[c][row] = 0.0;
+    m_computed[row] = 0;
+    m_graphs[row].reset();
+    m_flags[row] &= ~ROW_HAS_RESULT;
+}
+
+void CSectionResultStore::RequireNodes(int row, unsigned int nodeMask)
+{
+    CSectionPropertyGraph* graph = m_graphs[row].get();
+    if (graph == nullptr || (m_computed[row] & nodeMask) == nodeMask)
+        return;
+
+    // Filling in lazily evaluated nodes does not bump the version: values
+    // that were already visible (and sorted or filtered on) do not change
+    ImGuiAreaMomentsResult result;
+    LoadResult(row, result);
+    if (graph->Require(nodeMask, result) != 0)
+        WriteColumns(row, result);
+}
+
+void CSectionResultStore::ConvertColumn(int column, double lengthFactor, double* out) const
+{
+    double factor = 1.0;
+    for (int p = 0; p < s_columnInfo[column].lengthPower; p++)
+        factor *= lengthFactor;
+
+    // Plain contiguous loop; the compiler vectorizes this
+    const double* in = m_columns[column].data();
+    int count = GetRowCount();
+    for (int i = 0; i < count; i++)
+        out[i] = in[i] * factor;
+}
+
+void CSectionResultStore::SortedOrder(int column, bool ascending, std::vector<int>& order) const
+{
+    // Sort (key, row) pairs so comparisons touch one contiguous array
+    // instead of chasing row indices into the column
+    int count = GetRowCount();
+    const double* keys = m_columns[column].data();
+
+    std::vector<std::pair<double, int>> pairs(count);
+    for (int i = 0; i < count; i++)
+        pairs[i] = std::make_pair(ascending ? keys[i] : -keys[i], i);
+
+    std::stable_sort(pairs.begin(), pairs.end(),
+        [](const std::pair<double, int>& a, const std::pair<double, int>& b) { return a.first < b.first; });
+
+    order.resize(count);
+    for (int i = 0; i < count; i++)
+        order[i] = pairs[i].second;
+}
+
+void CSectionResultStore::FilterRows(const SectionResultFilter* filters, int filterCount,
+                                     std::vector<int>& rows) const
+{
+    int count = GetRowCount();
+
+    // Build a pass mask column by column so each filter is one linear scan
+    std::vector<uint8_t> pass(count);
+    for (int i = 0; i < count; i++)
+        pass[i] = (uint8_t)(m_flags[i] & ROW_HAS_RESULT);
+
+    for (int f = 0; f < filterCount; f++)
+    {
+        const double* values = m_columns[filters[f].column].data();
+        double lo = filters[f].minValue;
+        double hi = filters[f].maxValue;
+        for (int i = 0; i < count; i++)
+            pass[i] &= (uint8_t)(values[i] >= lo && values[i] <= hi);
+    }
+
+    rows.clear();
+    for (int i = 0; i < count; i++)
+    {
+        if (pass[i])
+            rows.push_back(i);
+    }
+}
+
+void CSectionResultStore::SortRows(const SectionResultSortKey* keys, int keyCount,
+                                   std::vector<int>& rows) const
+{
+    // Least significant key first; every pass is a stable sort on gathered
+    // (key, row) pairs, so earlier keys win ties of later ones
+    std::vector<std::pair<double, int>> pairs(rows.size());
+    for (int k = keyCount - 1; k >= 0; k--)
+    {
+        const double* values = keys[k].values ? keys[k].values : m_columns[keys[k].column].data();
+        double sign = keys[k].ascending ? 1.0 : -1.0;
+
+        for (size_t i = 0; i < rows.size(); i++)
+            pairs[i] = std::make_pair(sign * values[rows[i]], rows[i]);
+
+        std::stable_sort(pairs.begin(), pairs.end(),
+            [](const std::pair<double, int>& a, const std::pair<double, int>& b) { return a.first < b.first; });
+
+        for (size_t i = 0; i < rows.size(); i++)
+            rows[i] = pairs[i].second;
+    }
+}
+
+void CSectionResultStore::RequireColumn(int column)
+{
+    unsigned int node = s_columnInfo[column].node;
+    for (int row = 0; row < GetRowCount(); row++)
+        RequireNodes(row, node);
+}
+
+size_t CSectionResultStore::GetMemoryBytes() const
+{
+    size_t bytes = 0;
+    for (int c = 0; c < RESULT_COL_COUNT; c++)
+        bytes += m_columns[c].capacity() * sizeof(double);
+    bytes += m_computed.capacity() * sizeof(unsigned int);
+    bytes += m_faceTypes.capacity() * sizeof(uint16_t);
+    bytes += m_flags.capacity() * sizeof(uint8_t);
+    bytes += m_faces.capacity() * sizeof(void*);
+    bytes += m_lineageKeys.capacity() * sizeof(uint64_t);
+    bytes += m_graphs.capacity() * sizeof(std::unique_ptr<CSectionPropertyGraph>);
+    for (const auto& graph : m_graphs)
+    {
+        if (graph)
+            bytes += sizeof(CSectionPropertyGraph) + graph->GetMeshBytes();
+    }
+    bytes += m_nameArena.capacity() + m_nameOffsets.capacity() * sizeof(uint32_t);
+    return bytes;
+}
@@ -0,0 +1,183 @@
+// SectionResultStore.h: Columnar storage for per-face section results
+//////////////////////////////////////////////////////////////////////
+
+#ifndef SECTION_RESULT_STORE_H
+#define SECTION_RESULT_STORE_H
+
+#include "SectionPropertyGraph.h"
+#include <vector>
+#include <string>
+#include <memory>
+#include <cstdint>
+
+// Numeric result columns. Order follows ImGuiAreaMomentsResult.
+enum SectionResultColumn
+{
+    RESULT_COL_AREA = 0,
+    RESULT_COL_PERIMETER,
+    RESULT_COL_CX,
+    RESULT_COL_CY,
+    RESULT_COL_IXX_ORIGIN,
+    RESULT_COL_IXY_ORIGIN,
+    RESULT_COL_IYY_ORIGIN,
+    RESULT_COL_J_ORIGIN,
+    RESULT_COL_IX,
+    RESULT_COL_IY,
+    RESULT_COL_IXY,
+    RESULT_COL_I1,
+    RESULT_COL_I2,
+    RESULT_COL_J,
+    RESULT_COL_THETA,
+    RESULT_COL_RX,
+    RESULT_COL_RY,
+    RESULT_COL_SX,
+    RESULT_COL_SY,
+    RESULT_COL_CX_MAX,
+    RESULT_COL_CY_MAX,
+    RESULT_COL_COUNT
+};
+
+// Static description of a column
+struct SectionResultColumnInfo
+{
+    const char* name;       // Short label, e.g. "Ix"
+    int lengthPower;        // Unit dimension: length^lengthPower (0 = unitless)
+    unsigned int node;      // SECTION_NODE_BIT of the graph node producing it
+    const char* identifier; // Name in custom column expressions, e.g. "Izz_o"
+};
+
+// Inclusive range filter on one column, in internal (cm based) units
+struct SectionResultFilter
+{
+    int column;
+    double minValue;
+    double maxValue;
+};
+
+// Sort key for multi-column ordering
+struct SectionResultSortKey
+{
+    int column;
+    bool ascending;
+    const double* values = nullptr;     // Per-row keys of a column kept outside
+                                        // the store (custom columns), if set
+};
+
+// Row-oriented view of one stored result. Holds the gathered values so
+// existing code can keep reading fields by name.
+struct SectionResultRow
+{
+    const char* name = "";
+    void* pFace = nullptr;
+    bool hasResult = false;
+    bool quick = false;
+    ImGuiAreaMomentsResult result;
+};
+
+// Results of all selected faces stored column by column: one contiguous
+// array per property, face types interned to small IDs and names packed
+// into a single character arena. Rows are appended in selection order.
+class CSectionResultStore
+{
+public:
+    CSectionResultStore();
+
+    static const SectionResultColumnInfo& GetColumnInfo(int column);
+
+    // Field of a row-shaped result backing a column
+    static double GetResultValue(const ImGuiAreaMomentsResult& result, int column);
+    static void SetResultValue(ImGuiAreaMomentsResult& result, int column, double value);
+
+    // Rows
+    void Clear();
+    void Reserve(int rows, size_t nameBytes);
+    int AddRow(const char* name, void* pFace);
+
+    // Append one row per face in a single pass, returning the first new row.
+    // Rows are named "Face <row + 1>" until a stored result names their
+    // type, then "<type> <row + 1>", so the type lookup can wait for the
+    // calculation instead of slowing down selection.
+    int AddFaceRows(void* const* faces, int count);
+    int GetRowCount() const { return (int)m_faces.size(); }
+
+    // Per-row fields
+    const char* GetName(int row) const { return &m_nameArena[m_nameOffsets[row]]; }
+    void SetName(int row, const char* name);
+    void* GetFace(int row) const { return m_faces[row]; }
+    bool HasResult(int row) const { return (m_flags[row] & ROW_HAS_RESULT) != 0; }
+    bool IsQuickResult(int row) const { return HasResult(row) && !m_graphs[row]; }
+    bool HasAnyResult() const;
+    unsigned int GetComputed(int row) const { return m_computed[row]; }
+    CSectionPropertyGraph* GetGraph(int row) const { return m_graphs[row].get(); }
+    uint16_t GetFaceTypeId(int row) const { return m_faceTypes[row]; }
+    uint64_t GetLineageKey(int row) const { return m_lineageKeys[row]; }
+    void SetLineageKey(int row, uint64_t key) { m_lineageKeys[row] = key; }
+
+    // Face type interning
+    uint16_t InternFaceType(const std::string& faceType);
+    const std::string& GetFaceTypeName(uint16_t id) const { return m_faceTypeNames[id]; }
+
+    // Column access
+    double Get(int column, int row) const { return m_columns[column][row]; }
+    const double* GetColumn(int column) const { return m_columns[column].data(); }
+
+    // Scatter a row-shaped result into the columns / gather it back
+    void SetResult(int row, const ImGuiAreaMomentsResult& result,
+                   std::unique_ptr<CSectionPropertyGraph> graph);
+    void StoreResult(int row, const ImGuiAreaMomentsResult& result);
+    void LoadResult(int row, ImGuiAreaMomentsResult& result) const;
+    void ReadRow(int row, SectionResultRow& view) const;
+    void ClearResult(int row);
+
+    // Evaluate pending graph nodes for a row and write them back
+    void RequireNodes(int row, unsigned int nodeMask);
+
+    // Convert a whole column to display units:
+    // out[i] = column[i] * lengthFactor^lengthPower
+    void ConvertColumn(int column, double lengthFactor, double* out) const;
+
+    // Index permutation ordering the rows by a column
+    void SortedOrder(int column, bool ascending, std::vector<int>& order) const;
+
+    // Rows with a result that pass every filter, in row order
+    void FilterRows(const SectionResultFilter* filters, int filterCount, std::vector<int>& rows) const;
+
+    // Stable reorder of a row permutation by several keys (first key is primary)
+    void SortRows(const SectionResultSortKey* keys, int keyCount, std::vector<int>& rows) const;
+
+    // Evaluate the node behind a column for every row, e.g. before sorting on it
+    void RequireColumn(int column);
+
+    // Bumped on every change to row data, so views can cache derived orderings
+    unsigned int GetVersion() const { return m_version; }
+
+    // Approximate heap footprint, for diagnostics
+    size_t GetMemoryBytes() const;
+
+private:
+    void WriteColumns(int row, const ImGuiAreaMomentsResult& result);
+    void SetNumberedName(int row, uint16_t faceType);
+
+    enum RowFlags
+    {
+        ROW_HAS_RESULT = 0x01,
+        ROW_NUMBERED_NAME = 0x02    // Name follows the face type
+    };
+
+    std::vector<double> m_columns[RESULT_COL_COUNT];
+    std::vector<unsigned int> m_computed;
+    std::vector<uint16_t> m_faceTypes;
+    std::vector<uint8_t> m_flags;
+    std::vector<void*> m_faces;
+    std::vector<uint64_t> m_lineageKeys;
+    std::vector<std::unique_ptr<CSectionPropertyGraph>> m_graphs;
+
+    std::vector<char> m_nameArena;
+    std::vector<uint32_t> m_nameOffsets;
+
+    std::vector<std::string> m_faceTypeNames;
+
+    unsigned int m_version;
+};
+
+#endif // SECTION_RESULT_STORE_H
@@ -0,0 +1,224 @@
+// SharedMetrics.cpp: Versioned metrics block in named shared memory
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "SharedMetrics.h"
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+static std::atomic<SharedMetricsBlock*> s_block(nullptr);
+static char s_name[64];
+
+#ifdef _WIN32
+static HANDLE s_mapping = nullptr;
+
+static uint32_t CurrentProcessId()
+{
+    return (uint32_t)::GetCurrentProcessId();
+}
+
+// Returns the zeroed view, or nullptr if 'name' is taken or unavailable
+static SharedMetricsBlock* MapSegment(const char* name)
+{
+    HANDLE mapping = ::CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                          0, sizeof(SharedMetricsBlock), name);
+    if (mapping == nullptr)
+        return nullptr;
+    if (::GetLastError() == ERROR_ALREADY_EXISTS)
+    {
+        ::CloseHandle(mapping);
+        return nullptr;
+    }
+
+    void* view = ::MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(SharedMetricsBlock));
+    if (view == nullptr)
+    {
+        ::CloseHandle(mapping);
+        return nullptr;
+    }
+    s_mapping = mapping;
+    return (SharedMetricsBlock*)view;
+}
+
+static void UnmapSegment(SharedMetricsBlock* block)
+{
+    ::UnmapViewOfFile(block);
+    ::CloseHandle(s_mapping);
+    s_mapping = nullptr;
+}
+#else
+static uint32_t CurrentProcessId()
+{
+    return (uint32_t)getpid();
+}
+
+// POSIX segments outlive their process, so one left by a process that no
+// longer runs is taken over; one owned by a live process is not
+static SharedMetricsBlock* MapSegment(const char* name)
+{
+    int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0 && errno == EEXIST)
+    {
+        fd = shm_open(name, O_RDWR, 0644);
+        if (fd < 0)
+            return nullptr;
+
+        // magic, version, blockSize, processId
+        uint32_t header[4] = {};
+        bool live = pread(fd, header, sizeof(header), 0) == (ssize_t)sizeof(header) &&
+                    header[0] == SHARED_METRICS_MAGIC && kill((pid_t)header[3], 0) == 0;
+        if (live)
+        {
+            close(fd);
+            return nullptr;
+        }
+    }
+    if (fd < 0 || ftruncate(fd, sizeof(SharedMetricsBlock)) != 0)
+    {
+        if (fd >= 0)
+            close(fd);
+        return nullptr;
+    }
+
+    void* view = mmap(nullptr, sizeof(SharedMetricsBlock), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED)
+        return nullptr;
+
+    memset(view, 0, sizeof(SharedMetricsBlock));
+    return (SharedMetricsBlock*)view;
+}
+
+static void UnmapSegment(SharedMetricsBlock* block)
+{
+    munmap(block, sizeof(SharedMetricsBlock));
+    shm_unlink(s_name);
+}
+#endif
+
+bool CSharedMetrics::Open()
+{
+    if (s_block.load() != nullptr)
+        return true;
+
+    snprintf(s_name, sizeof(s_name), "%s", SHARED_METRICS_NAME);
+    SharedMetricsBlock* block = MapSegment(s_name);
+    if (block == nullptr)
+    {
+        // Another instance publishes under the plain name
+        snprintf(s_name, sizeof(s_name), "%s.%u", SHARED_METRICS_NAME, CurrentProcessId());
+        block = MapSegment(s_name);
+    }
+    if (block == nullptr)
+    {
+        s_name[0] = '\0';
+        return false;
+    }
+
+    block->version = SHARED_METRICS_VERSION;
+    block->blockSize = sizeof(SharedMetricsBlock);
+    block->processId = CurrentProcessId();
+    block->startTime = (uint64_t)time(nullptr);
+
+    // Readers treat the block as valid once the magic appears
+    std::atomic_thread_fence(std::memory_order_release);
+    block->magic = SHARED_METRICS_MAGIC;
+
+    s_block.store(block, std::memory_order_release);
+    return true;
+}
+
+void CSharedMetrics::Close()
+{
+    SharedMetricsBlock* block = s_block.exchange(nullptr);
+    if (block == nullptr)
+        return;
+
+    UnmapSegment(block);
+    s_name[0] = '\0';
+}
+
+const char* CSharedMetrics::GetName()
+{
+    return s_name;
+}
+
+int CSharedMetrics::LatencyBucket(uint64_t ns)
+{
+    uint64_t us = ns / 1000;
+    int bucket = 0;
+    while (us != 0 && bucket < METRICS_LATENCY_BUCKETS - 1)
+    {
+        us >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+void CSharedMetrics::Record(uint64_t time, uint16_t type, uint32_t arg0, uint64_t arg1, uint64_t arg2)
+{
+    SharedMetricsBlock* block = s_block.load(std::memory_order_acquire);
+    if (block == nullptr)
+        return;
+
+    const std::memory_order relaxed = std::memory_order_relaxed;
+    switch (type)
+    {
+    case EVENT_STAGE:
+        if (arg0 < (uint32_t)METRICS_STAGE_COUNT)
+        {
+            block->stageCount[arg0].fetch_add(1, relaxed);
+            block->stageTotalNs[arg0].fetch_add(arg1, relaxed);
+            block->stageLatency[arg0][LatencyBucket(arg1)].fetch_add(1, relaxed);
+        }
+        break;
+    case EVENT_TESSELLATION:
+        block->tessellations.fetch_add(1, relaxed);
+        block->triangles.fetch_add(arg1, relaxed);
+        break;
+    case EVENT_CACHE:
+        if (arg0 < (uint32_t)METRICS_CACHE_COUNT)
+        {
+            block->cacheLookups[arg0].fetch_add(1, relaxed);
+            if (arg1 != 0)
+                block->cacheHits[arg0].fetch_add(1, relaxed);
+        }
+        break;
+    case EVENT_ERROR:
+        block->errors.fetch_add(1, relaxed);
+        break;
+    default:
+        return;
+    }
+
+    block->updateTime.store(time, relaxed);
+    block->sequence.fetch_add(1, std::memory_order_release);
+    (void)arg2;
+}
+
+void CSharedMetrics::SetGauge(int gauge, uint64_t value)
+{
+    SharedMetricsBlock* block = s_block.load(std::memory_order_acquire);
+    if (block == nullptr || gauge < 0 || gauge >= GAUGE_COUNT)
+        return;
+
+    block->gauges[gauge].store(value, std::memory_order_relaxed);
+    block->updateTime.store(CEventLog::Now(), std::memory_order_relaxed);
+    block->sequence.fetch_add(1, std::memory_order_release);
+}
@@ -0,0 +1,118 @@
+// SharedMetrics.h: Versioned metrics block in named shared memory
+//////////////////////////////////////////////////////////////////////
+
+#ifndef SHARED_METRICS_H
+#define SHARED_METRICS_H
+
+#include "EventLog.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Counters live in memory shared with other processes, so they must be
+// plain 64-bit words that every compiler updates without a lock
+static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t), "atomic counters must be plain words");
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "atomic counters must be lock free");
+
+static const uint32_t SHARED_METRICS_MAGIC = 0x544D4D41;   // "AMMT"
+static const uint32_t SHARED_METRICS_VERSION = 1;
+
+// Segment name: Windows file mapping, or POSIX shm object on Linux.
+// A second process falls back to the name with ".<pid>" appended.
+#ifdef _WIN32
+#define SHARED_METRICS_NAME "Local\\AreaMomentToolMetrics"
+#else
+#define SHARED_METRICS_NAME "/AreaMomentToolMetrics"
+#endif
+
+// Point-in-time values
+enum SharedMetricsGauge
+{
+    GAUGE_QUEUE_DEPTH = 0,      // Selected faces still waiting for a result
+    GAUGE_RESULT_BYTES,         // Result store
+    GAUGE_HISTORY_BYTES,        // Result history
+    GAUGE_UI_LIVE_BYTES,        // ImGui allocations
+    GAUGE_UI_RESERVED_BYTES,
+    GAUGE_COUNT
+};
+
+enum
+{
+    METRICS_STAGE_COUNT = STAGE_FRAME + 1,      // Indexed by EventLogStage
+    METRICS_CACHE_COUNT = CACHE_RESULT + 1,     // Indexed by EventLogCache
+    METRICS_LATENCY_BUCKETS = 32
+};
+
+// Shared layout. Readers check magic, version and blockSize; fields are only
+// ever appended, with a version bump. Latency bucket 0 counts stages under
+// 1 us and bucket b counts [2^(b-1), 2^b) us, the last one everything above.
+struct SharedMetricsBlock
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t blockSize;         // sizeof(SharedMetricsBlock)
+    uint32_t processId;
+    uint64_t startTime;         // Wall clock, seconds since the epoch
+
+    std::atomic<uint64_t> sequence;             // Bumped by every update
+    std::atomic<uint64_t> updateTime;           // CEventLog::Now() of the last update
+
+    std::atomic<uint64_t> stageCount[METRICS_STAGE_COUNT];
+    std::atomic<uint64_t> stageTotalNs[METRICS_STAGE_COUNT];
+    std::atomic<uint64_t> stageLatency[METRICS_STAGE_COUNT][METRICS_LATENCY_BUCKETS];
+
+    std::atomic<uint64_t> tessellations;
+    std::atomic<uint64_t> triangles;
+    std::atomic<uint64_t> cacheLookups[METRICS_CACHE_COUNT];
+    std::atomic<uint64_t> cacheHits[METRICS_CACHE_COUNT];
+    std::atomic<uint64_t> errors;
+
+    std::atomic<uint64_t> gauges[GAUGE_COUNT];
+};
+
+// Publishes add-on health for external monitoring. The block is fed from
+// the event log's instrumentation points (CEventLog::Write calls Record),
+// plus gauges set by the command and window, with relaxed atomic adds, so
+// it costs nothing when no segment is open.
+class CSharedMetrics
+{
+public:
+    // Create the segment; returns false if none could be created
+    static bool Open();
+
+    // Unmap the segment; call once no thread can record any more
+    static void Close();
+
+    // Name of the open segment, or "" if none
+    static const char* GetName();
+
+    // Fold one event log record into the counters ('time' from CEventLog::Now())
+    static void Record(uint64_t time, uint16_t type, uint32_t arg0, uint64_t arg1, uint64_t arg2);
+    static void SetGauge(int gauge, uint64_t value);
+
+    static int LatencyBucket(uint64_t ns);
+
+    // Upper bound, in microseconds, of the bucket holding the given fraction
+    // of a stage's samples (e.g. 0.99 for p99); 0 if there are none
+    static double LatencyPercentileUs(const SharedMetricsBlock& block, int stage, double fraction)
+    {
+        uint64_t total = 0;
+        for (int b = 0; b < METRICS_LATENCY_BUCKETS; b++)
+            total += block.stageLatency[stage][b].load(std::memory_order_relaxed);
+        if (total == 0)
+            return 0;
+
+        uint64_t target = (uint64_t)(fraction * (double)total + 0.5);
+        uint64_t seen = 0;
+        for (int b = 0; b < METRICS_LATENCY_BUCKETS; b++)
+        {
+            seen += block.stageLatency[stage][b].load(std::memory_order_relaxed);
+            if (seen >= target && seen > 0)
+                return (double)(1ull << b);
+        }
+        return (double)(1ull << (METRICS_LATENCY_BUCKETS - 1));
+    }
+};
+
+#endif // SHARED_METRICS_H
@@ -0,0 +1,276 @@
+// TessellationCache.cpp: Face meshes kept between calculations, spilled to disk
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "TessellationCache.h"
+#include "FacetCodec.h"
+#include "SectionBoundary.h"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+static const uint32_t SPILL_FILE_MAGIC = 0x43544D41;  // "AMTC"
+static const uint32_t SPILL_FILE_VERSION = 1;
+
+// Offsets are seeked with a long
+static const size_t MAX_SPILL_BYTES = 1u << 30;
+static const size_t LIST_NODE_BYTES = sizeof(uint64_t) + 2 * sizeof(void*);  // Entry in the recency list
+
+struct SpillFileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+};
+
+// Precedes each coded mesh
+struct SpillRecordHeader
+{
+    uint64_t key;
+    uint32_t size;
+    uint32_t reserved;
+};
+
+static FILE* OpenSpillFileRaw(const char* path)
+{
+#ifdef _MSC_VER
+    FILE* file = nullptr;
+    return (fopen_s(&file, path, "w+b") == 0) ? file : nullptr;
+#else
+    return fopen(path, "w+b");
+#endif
+}
+
+CTessellationCache::CTessellationCache()
+    : m_spillFile(nullptr)
+    , m_memoryBudget((size_t)DEFAULT_MEMORY_MB << 20)
+    , m_spillBudget(((size_t)DEFAULT_MEMORY_MB << 20) * SPILL_BUDGET_FACTOR)
+    , m_meshBytes(0)
+    , m_spillBytes(0)
+    , m_hits(0)
+    , m_spillHits(0)
+    , m_misses(0)
+{
+}
+
+CTessellationCache::~CTessellationCache()
+{
+    if (m_spillFile != nullptr)
+    {
+        fclose(m_spillFile);
+        remove(m_spillPath.c_str());
+    }
+}
+
+uint64_t CTessellationCache::MakeKey(const void* faceKey, size_t faceKeyBytes, double timeStamp,
+                                     double surfaceTolerance)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    const uint8_t* bytes = (const uint8_t*)faceKey;
+    for (size_t i = 0; i < faceKeyBytes; i++)
+        hash = (hash ^ bytes[i]) * 1099511628211ULL;
+
+    double values[2] = { timeStamp, surfaceTolerance };
+    for (int i = 0; i < 2; i++)
+    {
+        uint64_t bits;
+        memcpy(&bits, &values[i], sizeof(bits));
+        hash = (hash ^ bits) * 1099511628211ULL;
+    }
+    return (hash != 0) ? hash : 1;
+}
+
+bool CTessellationCache::OpenSpillFile(const char* path)
+{
+    if (m_spillFile != nullptr)
+    {
+        fclose(m_spillFile);
+        remove(m_spillPath.c_str());
+    }
+
+    m_spillPath = path;
+    m_spillFile = OpenSpillFileRaw(path);
+    ResetSpillFile();
+    return m_spillFile != nullptr;
+}
+
+void CTessellationCache::SetBudget(size_t memoryBytes, size_t spillBytes)
+{
+    m_memoryBudget = memoryBytes;
+    m_spillBudget = std::min(spillBytes, MAX_SPILL_BYTES);
+    MakeRoom(0);
+    if (m_spillBytes > m_spillBudget)
+        ResetSpillFile();
+}
+
+const TessellationMesh* CTessellationCache::Find(uint64_t key)
+{
+    auto found = m_meshes.find(key);
+    if (found != m_meshes.end())
+    {
+        m_hits++;
+        m_recency.splice(m_recency.begin(), m_recency, found->second.recency);
+        return &found->second.mesh;
+    }
+
+    // Read back a spilled mesh; its record stays, so evicting it again
+    // costs no write
+    auto spilled = m_spilled.find(key);
+    if (spilled != m_spilled.end())
+    {
+        TessellationMesh mesh;
+        if (ReadSpilled(key, spilled->second, mesh))
+        {
+            m_spillHits++;
+            size_t bytes = mesh.GetMemoryBytes();
+            MakeRoom(bytes);
+            CachedMesh& entry = m_meshes[key];
+            entry.mesh = std::move(mesh);
+            m_recency.push_front(key);
+            entry.recency = m_recency.begin();
+            m_meshBytes += bytes;
+            return &entry.mesh;
+        }
+        m_spilled.erase(spilled);
+    }
+
+    m_misses++;
+    return nullptr;
+}
+
+const TessellationMesh& CTessellationCache::Insert(uint64_t key, TessellationMesh mesh)
+{
+    // Facet data repeats every shared corner
+    std::vector<int> weld, first;
+    CSectionBoundary::WeldVertices(mesh.vertices2D, weld, first);
+    std::vector<double> welded(first.size() * 2);
+    for (size_t v = 0; v < first.size(); v++)
+    {
+        welded[v * 2] = mesh.vertices2D[first[v] * 2];
+        welded[v * 2 + 1] = mesh.vertices2D[first[v] * 2 + 1];
+    }
+    mesh.vertices2D.swap(welded);
+    for (int& index : mesh.indices)
+        index = weld[index];
+    mesh.indices.shrink_to_fit();
+
+    auto found = m_meshes.find(key);
+    if (found != m_meshes.end())
+    {
+        m_meshBytes -= found->second.mesh.GetMemoryBytes();
+        m_recency.erase(found->second.recency);
+        m_meshes.erase(found);
+    }
+    m_spilled.erase(key);
+
+    size_t bytes = mesh.GetMemoryBytes();
+    MakeRoom(bytes);
+    CachedMesh& entry = m_meshes[key];
+    entry.mesh = std::move(mesh);
+    m_recency.push_front(key);
+    entry.recency = m_recency.begin();
+    m_meshBytes += bytes;
+    return entry.mesh;
+}
+
+void CTessellationCache::Clear()
+{
+    m_meshes.clear();
+    m_recency.clear();
+    m_meshBytes = 0;
+    ResetSpillFile();
+}
+
+size_t CTessellationCache::GetMemoryBytes() const
+{
+    return m_meshBytes + m_meshes.size() * (sizeof(std::pair<const uint64_t, CachedMesh>) + LIST_NODE_BYTES) +
+           m_spilled.size() * sizeof(std::pair<const uint64_t, SpilledMesh>);
+}
+
+void CTessellationCache::MakeRoom(size_t incoming)
+{
+    // The least recently used mesh is at the back of m_recency
+    while (!m_recency.empty() && m_meshBytes + incoming > m_memoryBudget)
+    {
+        auto oldest = m_meshes.find(m_recency.back());
+        if (m_spilled.find(oldest->first) == m_spilled.end())
+            Spill(oldest->first, oldest->second.mesh);
+        m_meshBytes -= oldest->second.mesh.GetMemoryBytes();
+        m_meshes.erase(oldest);
+        m_recency.pop_back();
+    }
+}
+
+bool CTessellationCache::Spill(uint64_t key, const TessellationMesh& mesh)
+{
+    if (m_spillFile == nullptr)
+        return false;
+
+    std::vector<uint8_t> blob;
+    if (!CFacetCodec::Encode(mesh.vertices2D, mesh.indices, CFacetCodec::DEFAULT_TOLERANCE, blob))
+        return false;
+
+    SpillRecordHeader record = { key, (uint32_t)blob.size(), 0 };
+    size_t recordBytes = sizeof(record) + blob.size();
+    if (recordBytes > m_spillBudget)
+        return false;
+    if (m_spillBytes + recordBytes > m_spillBudget)
+        ResetSpillFile();
+    if (m_spillFile == nullptr)
+        return false;
+
+    if (fseek(m_spillFile, (long)m_spillBytes, SEEK_SET) != 0 ||
+        fwrite(&record, sizeof(record), 1, m_spillFile) != 1 ||
+        fwrite(blob.data(), blob.size(), 1, m_spillFile) != 1)
+    {
+        ResetSpillFile();
+        return false;
+    }
+
+    SpilledMesh& spilled = m_spilled[key];
+    spilled.offset = m_spillBytes;
+    spilled.size = (uint32_t)blob.size();
+    spilled.perimeter = mesh.perimeter;
+    spilled.normal = mesh.normal;
+    spilled.origin = mesh.origin;
+    m_spillBytes += recordBytes;
+    return true;
+}
+
+bool CTessellationCache::ReadSpilled(uint64_t key, const SpilledMesh& spilled, TessellationMesh& mesh)
+{
+    if (m_spillFile == nullptr)
+        return false;
+
+    SpillRecordHeader record;
+    std::vector<uint8_t> blob(spilled.size);
+    if (fseek(m_spillFile, (long)spilled.offset, SEEK_SET) != 0 ||
+        fread(&record, sizeof(record), 1, m_spillFile) != 1 || record.key != key || record.size != spilled.size ||
+        fread(blob.data(), blob.size(), 1, m_spillFile) != 1)
+        return false;
+
+    if (!CFacetCodec::Decode(blob.data(), blob.size(), mesh.vertices2D, mesh.indices))
+        return false;
+    mesh.perimeter = spilled.perimeter;
+    mesh.normal = spilled.normal;
+    mesh.origin = spilled.origin;
+    return true;
+}
+
+void CTessellationCache::ResetSpillFile()
+{
+    m_spilled.clear();
+    m_spillBytes = 0;
+    if (m_spillFile == nullptr)
+        return;
+
+    // Start over at the header; records past it are dead
+    SpillFileHeader header = { SPILL_FILE_MAGIC, SPILL_FILE_VERSION };
+    if (fseek(m_spillFile, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, m_spillFile) == 1)
+        m_spillBytes = sizeof(header);
+}
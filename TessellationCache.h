@@ -0,0 +1,118 @@
+// TessellationCache.h: Face meshes kept between calculations, spilled to disk
+//////////////////////////////////////////////////////////////////////
+
+#ifndef TESSELLATION_CACHE_H
+#define TESSELLATION_CACHE_H
+
+#include "AreaMomentsCalculator.h"
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+
+// One face's tessellation, welded and projected to the face plane
+struct TessellationMesh
+{
+    std::vector<double> vertices2D;
+    std::vector<int> indices;
+    double perimeter = 0;
+    Vector3D normal, origin;    // Plane frame the vertices are in
+
+    size_t GetMemoryBytes() const
+    {
+        return vertices2D.capacity() * sizeof(double) + indices.capacity() * sizeof(int);
+    }
+};
+
+// Meshes by face, face time stamp and surface tolerance, so the facet
+// data of a face is fetched once however often it is recalculated,
+// reselected or upgraded from quick mode.
+//
+// Meshes are kept in memory up to a byte budget. Past it, the least
+// recently used ones are coded with CFacetCodec and appended to a spill
+// file, from which a later hit reads them back (on a grid of
+// CFacetCodec::DEFAULT_TOLERANCE). The spill file is restarted when it
+// outgrows its own budget. Without a spill file, evicted meshes are
+// dropped.
+class CTessellationCache
+{
+public:
+    enum
+    {
+        DEFAULT_MEMORY_MB = 64,
+        SPILL_BUDGET_FACTOR = 4     // Spill file budget over memory budget
+    };
+
+    CTessellationCache();
+    ~CTessellationCache();
+
+    // Key of a face's tessellation: the face's persistent key bytes, its
+    // modification time stamp and the facet surface tolerance. Never 0.
+    static uint64_t MakeKey(const void* faceKey, size_t faceKeyBytes, double timeStamp, double surfaceTolerance);
+
+    // Create (or empty) the spill file; it is deleted by the destructor
+    bool OpenSpillFile(const char* path);
+
+    // Memory and spill file budgets; a memory budget of 0 disables the cache
+    void SetBudget(size_t memoryBytes, size_t spillBytes);
+    size_t GetMemoryBudget() const { return m_memoryBudget; }
+    bool IsEnabled() const { return m_memoryBudget > 0; }
+
+    // Cached mesh, read back from the spill file if need be; null on a
+    // miss. Valid until the next Find or Insert.
+    const TessellationMesh* Find(uint64_t key);
+
+    // Weld 'mesh' and store it, evicting older meshes to fit the budget
+    const TessellationMesh& Insert(uint64_t key, TessellationMesh mesh);
+
+    void Clear();
+
+    // Statistics
+    int GetCount() const { return (int)m_meshes.size(); }
+    int GetSpilledCount() const { return (int)m_spilled.size(); }
+    uint64_t GetHits() const { return m_hits; }
+    uint64_t GetSpillHits() const { return m_spillHits; }
+    uint64_t GetMisses() const { return m_misses; }
+    size_t GetMeshBytes() const { return m_meshBytes; }
+    size_t GetSpillBytes() const { return m_spillBytes; }
+    size_t GetMemoryBytes() const;
+
+private:
+    struct CachedMesh
+    {
+        TessellationMesh mesh;
+        std::list<uint64_t>::iterator recency;     // Position in m_recency
+    };
+
+    // Where a spilled mesh's record is, and what the codec does not keep
+    struct SpilledMesh
+    {
+        uint64_t offset = 0;
+        uint32_t size = 0;
+        double perimeter = 0;
+        Vector3D normal, origin;
+    };
+
+    // Evict least recently used meshes until 'incoming' more bytes fit
+    void MakeRoom(size_t incoming);
+    bool Spill(uint64_t key, const TessellationMesh& mesh);
+    bool ReadSpilled(uint64_t key, const SpilledMesh& spilled, TessellationMesh& mesh);
+    void ResetSpillFile();
+
+    std::unordered_map<uint64_t, CachedMesh> m_meshes;
+    std::list<uint64_t> m_recency;              // Keys of m_meshes, most recently used first
+    std::unordered_map<uint64_t, SpilledMesh> m_spilled;
+    std::string m_spillPath;
+    FILE* m_spillFile;
+    size_t m_memoryBudget;
+    size_t m_spillBudget;
+    size_t m_meshBytes;
+    size_t m_spillBytes;
+    uint64_t m_hits;
+    uint64_t m_spillHits;
+    uint64_t m_misses;
+};
+
+#endif // TESSELLATION_CACHE_H
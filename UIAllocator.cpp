@@ -0,0 +1,187 @@
+// UIAllocator.cpp: Pooled, instrumented allocator for Dear ImGui
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "UIAllocator.h"
+
+#include "imgui/imgui.h"
+
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+// Block sizes, roughly 1.5x apart
+static const size_t s_classSizes[] =
+{
+    16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048, 3072, 4096
+};
+static const int SIZE_CLASS_COUNT = sizeof(s_classSizes) / sizeof(s_classSizes[0]);
+static const int LOOKUP_GRANULE = 16;
+static const uint32_t LARGE_BLOCK = 0xFFFFFFFF;
+
+// Precedes every block; keeps the payload 16-byte aligned
+struct alignas(16) UIBlockHeader
+{
+    size_t size;            // Requested size
+    uint32_t sizeClass;     // Index into s_classSizes, or LARGE_BLOCK
+};
+
+struct UIFreeBlock
+{
+    UIFreeBlock* next;
+};
+
+// ImGui may allocate from any thread that owns a context, so all state is
+// behind one lock; it is uncontended in practice (one render thread)
+static std::mutex s_allocMutex;
+static UIFreeBlock* s_freeLists[SIZE_CLASS_COUNT];
+static std::vector<void*> s_chunks;
+static unsigned char s_classLookup[CUIAllocator::MAX_POOLED_SIZE / LOOKUP_GRANULE + 1];
+static UIAllocatorStats s_stats;
+static uint32_t s_frameAllocs;
+static uint32_t s_frameFrees;
+static uint32_t s_frameHeapAllocs;
+static size_t s_liveBlocks;
+
+static int SizeClassOf(size_t size)
+{
+    if (size > CUIAllocator::MAX_POOLED_SIZE)
+        return -1;
+    return s_classLookup[(size + LOOKUP_GRANULE - 1) / LOOKUP_GRANULE];
+}
+
+// Carve a new chunk into free blocks of one class (caller holds the lock)
+static bool RefillClass(int sizeClass)
+{
+    size_t blockSize = sizeof(UIBlockHeader) + s_classSizes[sizeClass];
+    unsigned char* chunk = (unsigned char*)malloc(CUIAllocator::CHUNK_SIZE);
+    if (chunk == nullptr)
+        return false;
+
+    s_chunks.push_back(chunk);
+    s_stats.heapAllocs++;
+    s_stats.reservedBytes += CUIAllocator::CHUNK_SIZE;
+    s_frameHeapAllocs++;
+
+    for (size_t offset = 0; offset + blockSize <= CUIAllocator::CHUNK_SIZE; offset += blockSize)
+    {
+        UIFreeBlock* block = (UIFreeBlock*)(chunk + offset + sizeof(UIBlockHeader));
+        block->next = s_freeLists[sizeClass];
+        s_freeLists[sizeClass] = block;
+    }
+    return true;
+}
+
+void CUIAllocator::Install()
+{
+    {
+        std::lock_guard<std::mutex> lock(s_allocMutex);
+        int sizeClass = 0;
+        for (int i = 0; i <= MAX_POOLED_SIZE / LOOKUP_GRANULE; i++)
+        {
+            while (s_classSizes[sizeClass] < (size_t)i * LOOKUP_GRANULE)
+                sizeClass++;
+            s_classLookup[i] = (unsigned char)sizeClass;
+        }
+    }
+    ImGui::SetAllocatorFunctions(&CUIAllocator::Alloc, &CUIAllocator::Free, nullptr);
+}
+
+void CUIAllocator::BeginFrame()
+{
+    std::lock_guard<std::mutex> lock(s_allocMutex);
+    s_stats.frameAllocs = s_frameAllocs;
+    s_stats.frameFrees = s_frameFrees;
+    s_stats.frameHeapAllocs = s_frameHeapAllocs;
+    s_frameAllocs = 0;
+    s_frameFrees = 0;
+    s_frameHeapAllocs = 0;
+}
+
+UIAllocatorStats CUIAllocator::GetStats()
+{
+    std::lock_guard<std::mutex> lock(s_allocMutex);
+    return s_stats;
+}
+
+void CUIAllocator::ReleaseUnused()
+{
+    std::lock_guard<std::mutex> lock(s_allocMutex);
+    if (s_liveBlocks != 0)
+        return;
+
+    for (size_t i = 0; i < s_chunks.size(); i++)
+        free(s_chunks[i]);
+    s_stats.reservedBytes -= s_chunks.size() * CHUNK_SIZE;
+    s_chunks.clear();
+    for (int c = 0; c < SIZE_CLASS_COUNT; c++)
+        s_freeLists[c] = nullptr;
+}
+
+void* CUIAllocator::Alloc(size_t size, void* userData)
+{
+    (void)userData;
+    std::lock_guard<std::mutex> lock(s_allocMutex);
+
+    UIBlockHeader* header;
+    int sizeClass = SizeClassOf(size);
+    if (sizeClass < 0)
+    {
+        header = (UIBlockHeader*)malloc(sizeof(UIBlockHeader) + size);
+        if (header == nullptr)
+            return nullptr;
+        header->sizeClass = LARGE_BLOCK;
+        s_stats.heapAllocs++;
+        s_stats.reservedBytes += sizeof(UIBlockHeader) + size;
+        s_frameHeapAllocs++;
+    }
+    else
+    {
+        if (s_freeLists[sizeClass] == nullptr && !RefillClass(sizeClass))
+            return nullptr;
+        UIFreeBlock* block = s_freeLists[sizeClass];
+        s_freeLists[sizeClass] = block->next;
+        header = (UIBlockHeader*)block - 1;
+        header->sizeClass = (uint32_t)sizeClass;
+    }
+    header->size = size;
+
+    s_liveBlocks++;
+    s_stats.totalAllocs++;
+    s_stats.liveBytes += size;
+    if (s_stats.liveBytes > s_stats.peakBytes)
+        s_stats.peakBytes = s_stats.liveBytes;
+    s_frameAllocs++;
+    return header + 1;
+}
+
+void CUIAllocator::Free(void* ptr, void* userData)
+{
+    (void)userData;
+    if (ptr == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> lock(s_allocMutex);
+    UIBlockHeader* header = (UIBlockHeader*)ptr - 1;
+
+    s_liveBlocks--;
+    s_stats.liveBytes -= header->size;
+    s_frameFrees++;
+
+    if (header->sizeClass == LARGE_BLOCK)
+    {
+        s_stats.reservedBytes -= sizeof(UIBlockHeader) + header->size;
+        free(header);
+        return;
+    }
+
+    UIFreeBlock* block = (UIFreeBlock*)ptr;
+    block->next = s_freeLists[header->sizeClass];
+    s_freeLists[header->sizeClass] = block;
+}
@@ -0,0 +1,55 @@
+// UIAllocator.h: Pooled, instrumented allocator for Dear ImGui
+//////////////////////////////////////////////////////////////////////
+
+#ifndef UI_ALLOCATOR_H
+#define UI_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Allocation statistics. Byte counts are requested sizes unless noted.
+struct UIAllocatorStats
+{
+    uint64_t totalAllocs = 0;       // Since Install()
+    uint32_t frameAllocs = 0;       // During the last completed frame
+    uint32_t frameFrees = 0;
+    uint32_t frameHeapAllocs = 0;   // Last frame's allocations that reached the heap
+    uint64_t heapAllocs = 0;        // Pool chunks and large blocks taken from the heap
+    size_t liveBytes = 0;
+    size_t peakBytes = 0;
+    size_t reservedBytes = 0;       // Heap memory held: pool chunks plus large blocks
+};
+
+// Allocator handed to ImGui::SetAllocatorFunctions. Requests up to
+// MAX_POOLED_SIZE bytes are served from per size-class free lists carved out
+// of 64 KB chunks; ImGui's buffers keep their capacity from frame to frame,
+// so once the pools have warmed up a frame makes no heap calls at all.
+// Larger requests (font atlas pixels, big vertex buffers) go to the heap.
+// Chunks are kept until ReleaseUnused() finds nothing left alive.
+class CUIAllocator
+{
+public:
+    enum
+    {
+        MAX_POOLED_SIZE = 4096,
+        CHUNK_SIZE = 64 * 1024
+    };
+
+    // Route ImGui allocations here; call before ImGui::CreateContext()
+    static void Install();
+
+    // Mark a frame boundary for the per-frame counters (before NewFrame)
+    static void BeginFrame();
+
+    static UIAllocatorStats GetStats();
+
+    // Return pool chunks to the heap once every block is free,
+    // e.g. after ImGui::DestroyContext()
+    static void ReleaseUnused();
+
+    // ImGuiMemAllocFunc / ImGuiMemFreeFunc
+    static void* Alloc(size_t size, void* userData);
+    static void Free(void* ptr, void* userData);
+};
+
+#endif // UI_ALLOCATOR_H
@@ -0,0 +1,31 @@
+// UIFont.cpp: Embedded UI font and DPI scaling of UI sizes
+//////////////////////////////////////////////////////////////////////
+
+#include "stdafx.h"
+#include "UIFont.h"
+#include "UIFontData.h"
+
+#include "imgui/imgui.h"
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+ImFont* CUIFont::AddToAtlas(ImFontAtlas* atlas, float sizePixels)
+{
+    // The atlas decompresses its own copy (about 21 KB). Horizontal
+    // oversampling buys little for UI text at this size.
+    ImFontConfig config;
+    config.OversampleH = 1;
+    config.OversampleV = 1;
+    ImFont* font = atlas->AddFontFromMemoryCompressedTTF(g_uiFontCompressedData, (int)g_uiFontCompressedSize,
+                                                         sizePixels, &config);
+    return font != nullptr ? font : atlas->AddFontDefault();
+}
+
+float CUIFont::Scale(float pixels)
+{
+    return pixels * ImGui::GetStyle().FontScaleDpi;
+}
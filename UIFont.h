@@ -0,0 +1,28 @@
+// UIFont.h: Embedded UI font and DPI scaling of UI sizes
+//////////////////////////////////////////////////////////////////////
+
+#ifndef UI_FONT_H
+#define UI_FONT_H
+
+struct ImFont;
+struct ImFontAtlas;
+
+// UI font size in pixels at 96 DPI
+static const float UI_FONT_SIZE = 32.0f;
+
+// The UI font is compiled in (UIFontData.cpp), so opening a window never
+// waits on the disk. With a renderer that supports dynamic textures, ImGui
+// rasterizes glyphs on first use, so no atlas is baked up front.
+class CUIFont
+{
+public:
+    // Add the embedded font to 'atlas' at 'sizePixels', falling back to the
+    // built-in font if it cannot be decoded
+    static ImFont* AddToAtlas(ImFontAtlas* atlas, float sizePixels);
+
+    // A layout size given in pixels at 96 DPI, scaled by the same factor as
+    // the font (ImGuiStyle::FontScaleDpi, set by the host window)
+    static float Scale(float pixels);
+};
+
+#endif // UI_FONT_H
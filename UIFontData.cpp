@@ -0,0 +1,682 @@
+// UIFontData.cpp: Compressed UI font compiled into the add-on
+//////////////////////////////////////////////////////////////////////
+//
+// Area Moments Sans is Lato Regular 1.105 cut down to Basic Latin, Latin-1
+// Supplement and U+2026, without hinting, kerning or layout tables. It is
+// renamed because "Lato" is a Reserved Font Name.
+//
+// Copyright (c) 2010-2013 by tyPoland Lukasz Dziedzic (http://www.typoland.com/)
+// with Reserved Font Name "Lato". Licensed under the SIL Open Font License,
+// Version 1.1 (Res/UIFont-OFL.txt, installed next to the add-on).
+//
+// The data is the stb_compress stream that AddFontFromMemoryCompressedTTF
+// reads, as written by binary_to_compressed_c -u8: 21388 bytes of TTF,
+// 15572 compressed. To regenerate, subset with fontTools:
+//   pyftsubset Lato-Regular.ttf --unicodes=U+0020-007E,U+00A0-00FF,U+2026
+//       --no-hinting --notdef-outline --layout-features=
+//       --drop-tables+=kern,GPOS,GSUB,GDEF,DSIG,gasp
+//       --name-IDs=0-6,8,9,11-14 --name-languages=*
+// set name IDs 1, 3, 4 and 6 to the new family, then compress the result.
+
+#include "stdafx.h"
+#include "UIFontData.h"
+
+#ifdef _DEBUG
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#define new DEBUG_NEW
+#endif
+
+const unsigned int g_uiFontCompressedSize = 15572;
+const unsigned char g_uiFontCompressedData[15572] =
+{
+    87,188,0,0,0,0,0,0,0,0,83,140,0,4,0,0,55,0,1,0,0,0,10,0,
+    128,0,3,0,32,79,83,47,50,120,68,63,141,0,0,1,40,130,21,44,96,99,109,97,
+    112,1,212,33,108,0,0,4,172,130,15,56,68,103,108,121,102,200,239,19,191,0,0,6,
+    136,0,0,71,72,104,101,97,100,24,108,48,204,130,27,131,31,33,54,104,130,16,35,15,
+    104,6,221,130,11,32,228,130,3,40,36,104,109,116,120,50,68,73,33,130,79,130,47,41,
+    3,34,108,111,99,97,251,255,15,47,130,79,32,240,130,19,40,152,109,97,120,112,0,215,
+    0,199,130,11,32,8,130,47,59,32,110,97,109,101,140,12,167,222,0,0,77,208,0,0,
+    5,154,112,111,115,116,255,119,0,120,0,0,83,130,131,33,0,32,132,171,45,1,26,160,
+    90,164,72,13,95,15,60,245,0,27,7,130,39,37,0,0,202,147,94,112,131,7,43,230,
+    250,109,46,255,200,254,147,7,231,7,45,130,14,34,9,0,2,131,21,131,51,37,0,0,
+    7,182,254,86,130,5,38,246,255,200,255,202,7,231,132,73,139,0,32,198,132,17,40,203,
+    0,99,0,5,0,98,0,4,142,31,32,2,130,15,36,3,4,18,1,144,130,29,36,0,
+    5,120,5,20,130,82,32,24,133,7,50,3,186,0,120,1,244,8,3,2,15,5,2,2,
+    2,4,3,2,3,128,130,20,139,60,51,116,121,80,76,0,64,0,32,32,38,6,74,254,
+    122,1,144,7,182,1,170,133,147,130,40,34,245,5,153,132,217,38,2,4,39,0,45,1,
+    130,130,106,42,174,0,218,3,26,0,152,4,136,0,54,130,3,48,106,6,36,0,72,5,
+    126,0,82,1,204,0,152,2,88,0,134,130,3,36,74,3,32,0,96,130,27,38,100,1,
+    168,0,94,2,182,132,7,36,88,2,234,255,244,130,19,32,60,130,3,32,202,130,3,32,
+    104,130,3,32,108,130,3,32,40,134,7,131,3,32,110,130,3,131,55,36,148,1,248,0,
+    128,131,3,131,11,130,3,32,150,130,3,58,238,3,28,0,34,6,108,0,86,5,80,0,
+    10,5,14,0,174,5,90,0,90,5,226,0,174,4,138,130,3,32,108,130,15,32,188,130,
+    15,52,232,0,174,2,102,0,210,3,120,0,60,5,82,0,194,4,4,0,174,7,48,130,
+    27,130,23,39,6,60,0,92,4,198,0,194,131,7,33,5,8,130,27,42,36,0,58,4,
+    156,0,28,5,180,0,160,130,83,48,8,7,246,0,14,5,6,0,14,4,234,0,8,4,
+    224,0,86,130,199,36,142,2,238,255,236,130,7,32,90,130,127,34,158,3,20,130,251,36,
+    102,0,38,3,246,130,71,38,94,0,152,3,166,0,74,130,7,56,72,4,24,0,74,2,
+    162,0,26,3,254,0,50,4,88,0,146,2,0,0,130,1,252,255,200,130,23,32,152,130,
+    11,36,166,6,106,0,146,131,23,130,3,34,72,4,80,130,7,130,51,43,3,38,0,146,
+    3,100,0,62,2,234,0,44,130,23,44,122,4,0,0,18,5,252,0,14,3,240,0,28,
+    130,11,36,14,3,156,0,70,130,119,32,44,130,3,32,230,130,3,32,88,130,127,32,116,
+    65,123,7,130,11,32,138,130,3,32,52,130,3,32,132,130,3,132,35,35,3,238,0,114,
+    130,155,32,14,130,219,38,68,2,172,0,92,3,158,132,35,32,148,65,123,3,132,19,38,
+    102,0,20,3,26,0,70,130,19,36,100,2,152,0,82,130,3,32,84,130,19,32,196,131,
+    123,39,5,58,0,42,2,34,0,124,130,15,32,132,130,23,34,120,2,250,130,159,38,158,
+    0,150,5,144,0,102,132,3,38,146,0,68,3,28,0,44,65,119,4,146,3,35,7,66,
+    255,232,65,139,3,65,135,4,138,3,35,2,102,255,204,130,83,32,154,130,7,32,239,130,
+    3,36,242,6,42,0,50,65,135,7,143,3,130,151,32,126,131,7,65,139,4,138,3,65,
+    139,4,38,198,0,194,4,194,0,186,65,119,3,147,3,33,6,96,130,7,65,139,3,32,
+    24,141,3,39,2,0,255,249,2,0,0,151,130,7,32,210,130,3,36,225,4,82,0,76,
+    65,135,8,143,3,34,136,0,100,130,7,32,64,65,139,4,139,3,34,0,0,14,65,179,
+    4,130,7,130,75,32,166,130,207,66,3,3,32,106,130,3,36,18,5,174,0,88,130,215,
+    42,212,255,240,0,162,255,236,0,118,0,26,67,137,6,67,93,5,32,20,130,5,67,65,
+    3,36,20,0,4,0,48,130,7,32,8,130,1,131,27,38,126,0,255,32,38,255,255,67,
+    83,4,32,160,131,9,37,255,225,255,192,224,158,67,207,12,32,90,130,1,9,195,142,0,
+    182,1,26,1,144,2,14,2,127,2,151,2,199,2,247,3,68,3,93,3,139,3,152,3,
+    184,3,205,4,11,4,46,4,123,4,226,5,12,5,81,5,152,5,187,6,31,6,109,6,
+    166,6,238,7,19,7,39,7,74,7,157,8,36,8,78,8,143,8,213,9,3,9,28,9,
+    50,9,127,9,150,9,162,9,201,10,3,10,19,10,80,10,121,10,185,10,226,11,47,11,
+    104,11,187,11,206,11,246,12,27,12,99,12,152,12,192,12,220,12,245,13,11,13,36,13,
+    71,13,84,13,106,13,188,13,246,14,52,14,110,14,177,14,223,15,96,15,131,15,171,15,
+    232,16,30,16,44,16,105,16,143,16,197,17,0,17,59,17,96,17,178,17,230,18,13,18,
+    50,18,127,18,178,18,221,18,253,19,82,19,95,19,180,19,223,19,223,20,19,20,104,20,
+    191,21,19,21,78,21,97,21,220,22,22,22,154,22,232,23,46,23,62,23,75,23,193,23,
+    206,24,8,24,40,24,107,24,193,24,215,25,6,25,39,25,71,25,117,25,146,25,195,26,
+    3,26,81,26,186,27,66,27,151,27,163,27,175,27,187,27,199,27,211,27,223,28,15,28,
+    122,28,134,28,146,28,158,28,170,28,181,28,192,28,203,28,214,29,14,29,26,29,38,29,
+    50,29,62,29,74,29,86,29,120,29,213,29,225,29,237,29,249,30,5,30,17,30,60,30,
+    156,30,168,30,180,30,192,30,204,30,216,30,228,31,101,31,202,31,214,31,226,31,238,31,
+    250,32,5,32,16,32,27,32,38,32,143,32,155,32,167,32,179,32,191,32,203,32,215,33,
+    24,33,108,33,120,33,132,33,144,33,156,33,168,33,224,33,236,33,250,34,21,34,69,34,
+    110,34,194,34,216,35,18,35,42,35,73,35,121,35,164,0,4,0,45,0,0,3,251,5,
+    153,0,37,0,53,0,57,0,61,0,0,19,62,3,51,50,30,2,21,20,14,4,7,7,
+    35,39,38,62,4,53,52,38,35,34,14,2,35,34,39,19,52,54,134,27,130,13,37,38,
+    1,33,17,33,55,130,3,8,117,250,25,57,68,79,46,63,103,73,41,30,45,54,48,35,
+    4,17,122,12,4,26,45,55,48,32,73,57,41,56,40,28,11,25,12,99,62,48,22,40,
+    29,17,17,29,40,22,48,62,254,161,3,206,252,50,50,3,99,252,157,4,117,22,38,29,
+    17,35,64,91,56,55,80,59,43,38,37,23,105,117,34,51,43,40,46,58,40,51,60,18,
+    22,18,22,252,251,47,64,17,30,41,23,23,40,30,17,63,4,164,250,103,54,5,44,0,
+    2,0,218,255,241,1,211,130,179,33,13,0,70,229,3,32,17,130,141,41,7,35,46,3,
+    53,17,3,52,62,2,137,159,40,46,2,1,174,3,6,9,6,121,130,3,43,3,43,19,
+    33,46,26,26,46,34,19,19,34,131,7,51,33,19,5,153,253,196,45,86,87,91,52,52,
+    91,87,86,45,2,60,250,213,130,29,33,20,20,130,29,33,27,45,131,37,32,45,130,103,
+    36,152,3,153,2,128,130,103,34,10,0,21,131,103,34,7,6,6,130,245,35,39,39,17,
+    33,137,10,43,1,51,16,3,28,31,26,29,6,16,1,232,135,9,43,5,153,254,222,155,
+    32,35,35,32,155,1,34,137,9,130,79,36,54,0,0,4,81,130,79,34,62,0,66,130,
+    79,32,3,130,65,38,53,52,54,55,19,35,3,130,77,33,35,19,134,14,41,55,51,19,
+    35,55,54,54,51,51,19,131,4,42,3,51,19,51,50,22,21,20,7,3,51,131,115,33,
+    35,3,132,13,35,6,7,7,37,130,38,8,51,3,22,84,81,23,32,1,1,71,247,71,
+    8,45,29,79,85,146,23,26,1,1,8,204,65,232,13,5,36,39,158,72,6,43,30,80,
+    84,247,84,79,25,33,1,73,212,13,5,37,38,138,65,179,24,130,33,8,83,9,253,156,
+    247,65,247,1,167,254,89,34,27,4,7,5,1,90,254,157,37,31,1,167,23,28,5,12,
+    6,57,1,70,74,29,28,1,102,30,34,254,90,1,166,30,24,8,5,254,157,75,29,27,
+    254,186,23,29,5,11,6,57,131,1,70,0,3,0,106,255,18,4,36,6,103,0,56,0,
+    67,0,78,0,0,5,38,38,39,131,177,43,50,30,2,23,19,46,3,53,52,62,2,55,
+    132,193,37,7,22,22,23,7,6,65,137,3,35,39,3,30,3,65,149,3,32,7,132,196,
+    33,1,52,131,17,35,62,3,1,20,131,49,8,177,14,3,1,242,121,199,72,53,7,26,
+    14,19,48,70,97,68,37,70,135,107,65,57,109,160,104,10,2,26,22,66,14,105,152,60,
+    43,20,26,14,41,58,76,49,33,72,140,112,69,60,115,167,107,12,2,27,21,66,1,152,
+    37,64,86,49,34,65,101,69,35,253,213,34,60,80,47,30,65,95,61,30,12,11,97,75,
+    82,11,14,38,49,46,8,2,19,21,53,85,129,97,73,139,108,69,4,144,19,30,198,13,
+    82,58,66,30,25,33,33,7,254,28,22,52,82,123,92,90,158,120,75,6,176,19,29,2,
+    133,50,72,52,38,16,254,14,6,45,70,93,2,208,48,71,54,40,16,1,195,6,40,60,
+    75,0,5,0,72,255,239,5,219,5,167,0,19,0,39,0,49,0,69,0,89,0,0,1,
+    66,94,6,32,53,66,110,6,32,7,130,206,67,32,3,32,21,130,206,36,51,50,62,2,
+    1,131,251,32,1,132,232,158,41,60,2,195,52,87,116,63,68,115,86,48,48,86,115,68,
+    67,117,85,49,139,28,49,65,37,37,65,48,27,27,48,131,7,50,49,28,2,128,13,29,
+    24,128,251,233,10,28,19,132,5,53,52,87,115,137,46,35,116,86,48,138,143,46,8,44,
+    4,63,84,133,91,48,48,91,133,84,86,134,92,48,48,92,134,86,66,92,59,26,26,59,
+    92,66,65,91,57,25,25,57,91,1,119,17,19,250,132,13,16,1,82,84,132,131,40,35,
+    132,84,86,135,131,40,43,135,86,66,93,58,26,26,58,93,66,65,90,131,40,46,90,0,
+    2,0,82,255,240,5,120,5,169,0,63,0,75,130,245,130,191,65,205,4,35,38,39,46,
+    3,135,196,32,23,130,235,65,234,4,35,6,6,7,1,131,26,34,39,6,6,135,240,34,
+    55,38,38,131,6,65,228,3,8,148,51,50,54,55,1,6,6,2,148,79,130,95,55,4,
+    111,5,4,13,23,5,7,31,49,69,46,50,80,57,31,17,34,54,38,1,156,38,45,8,
+    2,20,18,110,2,70,66,1,44,172,29,36,22,144,94,245,147,80,154,121,74,47,83,114,
+    68,61,58,53,100,143,254,204,48,78,100,52,112,178,68,254,89,106,107,5,169,51,84,111,
+    60,22,1,14,18,26,56,46,30,32,57,77,45,35,64,65,69,38,254,93,67,147,74,19,
+    22,115,222,97,254,208,14,22,145,91,106,54,103,148,93,70,125,106,84,30,77,146,78,73,
+    128,95,55,251,227,65,99,68,35,82,68,1,171,57,159,130,210,67,225,3,33,1,51,67,
+    225,4,67,223,11,67,212,9,67,202,11,131,47,40,134,254,219,2,1,6,15,0,28,130,
+    12,35,20,18,23,22,67,139,5,66,243,6,132,14,8,57,7,6,2,1,33,110,104,6,
+    4,14,11,79,75,105,65,30,30,65,105,75,79,11,14,10,105,109,2,117,214,254,109,183,
+    11,16,8,14,18,7,48,115,226,228,231,122,121,232,227,226,116,49,7,18,14,15,19,182,
+    254,108,131,95,36,74,254,219,1,197,134,95,34,52,2,39,68,16,5,67,58,6,32,39,
+    65,79,3,40,54,55,54,18,1,42,109,105,10,141,94,35,4,6,104,110,130,95,36,1,
+    148,182,19,15,130,94,43,49,116,226,227,232,121,122,231,228,226,115,48,130,94,37,8,16,
+    11,183,1,147,131,95,38,96,3,95,2,188,5,226,71,189,3,32,1,131,76,130,188,36,
+    39,55,54,55,38,130,245,130,190,32,23,130,97,33,53,51,130,195,32,54,130,117,35,23,
+    7,6,6,67,192,3,32,23,131,120,61,39,22,21,21,1,98,5,7,20,33,172,44,172,
+    36,37,20,35,18,173,44,173,35,22,9,7,88,14,11,27,17,130,19,37,17,33,18,18,
+    33,17,130,20,8,34,18,28,11,16,3,95,197,19,34,16,25,20,99,75,100,21,3,2,
+    11,12,101,75,100,20,32,18,37,20,198,197,41,31,15,22,11,130,22,37,11,12,2,2,
+    11,11,130,23,36,11,22,16,33,39,76,7,3,40,100,0,174,4,34,4,142,0,11,130,
+    153,8,33,17,33,21,33,17,35,17,33,53,33,17,2,139,1,151,254,105,146,254,107,1,
+    149,4,142,254,85,135,254,82,1,174,135,1,171,131,203,43,94,254,241,1,80,0,236,0,
+    30,0,0,55,69,248,10,130,174,37,53,52,55,62,3,55,66,135,3,8,52,94,17,31,
+    44,26,30,47,31,16,26,48,71,45,30,13,14,10,31,32,27,6,13,26,42,31,17,123,
+    23,41,31,18,22,39,51,30,45,97,95,90,38,29,12,16,13,14,11,37,48,58,33,18,
+    33,45,131,141,37,2,12,2,82,2,163,72,245,3,32,19,130,140,39,100,1,238,254,18,
+    2,163,151,130,25,36,88,255,241,1,81,130,117,32,19,141,117,131,108,32,88,70,99,15,
+    32,110,70,82,15,46,0,1,255,244,255,166,2,246,5,193,0,9,0,0,23,68,34,4,
+    67,61,3,48,161,14,55,29,75,2,89,13,48,33,75,21,35,34,5,217,32,70,45,3,
+    38,60,255,241,4,76,5,169,68,121,4,35,0,1,20,2,66,157,4,36,38,2,53,52,
+    18,130,50,35,50,22,22,18,68,77,15,60,4,76,81,140,191,109,110,189,140,80,80,140,
+    189,110,109,191,140,81,185,55,93,122,66,66,122,92,55,55,92,131,7,8,33,93,55,2,
+    204,188,254,237,180,88,88,180,1,19,188,188,1,20,181,88,88,181,254,236,188,164,223,136,
+    59,59,136,223,164,164,222,131,7,32,222,130,229,48,202,0,0,4,31,5,156,0,18,0,
+    0,37,33,17,52,55,5,67,26,6,33,1,51,65,155,3,8,36,1,31,1,52,3,255,
+    0,10,20,9,15,24,6,56,1,170,145,1,26,253,0,136,3,209,44,45,219,8,7,13,
+    9,77,1,113,250,236,136,130,69,32,104,130,69,32,36,130,193,32,51,68,61,5,65,157,
+    4,131,239,37,33,50,22,21,21,33,66,127,3,35,1,62,3,53,134,197,67,125,7,8,
+    96,62,3,2,89,91,158,115,66,48,82,107,60,254,135,40,82,38,1,224,29,34,252,68,
+    15,17,1,203,57,94,67,36,40,70,94,54,54,92,71,49,10,8,32,26,5,11,7,93,
+    14,80,123,159,5,169,54,103,148,94,80,136,125,117,61,254,126,11,13,34,27,108,61,19,
+    40,17,1,205,58,107,108,111,63,63,95,62,31,32,57,78,47,29,26,1,1,16,98,151,
+    102,53,130,140,37,0,108,255,240,4,46,130,153,32,74,138,153,67,189,3,65,200,5,33,
+    39,55,65,96,3,37,23,22,22,23,30,3,65,88,3,132,162,32,53,148,170,8,48,108,
+    91,154,111,62,35,65,92,57,140,141,75,130,173,99,114,162,112,72,25,76,21,21,20,31,
+    8,2,4,2,14,40,68,101,75,75,113,75,38,31,81,143,112,91,129,82,37,39,68,93,
+    131,188,36,48,12,8,32,25,137,188,8,52,52,96,136,83,68,107,81,56,17,37,174,131,
+    99,158,111,59,57,100,137,80,32,9,17,18,4,9,5,29,73,64,44,49,78,96,47,58,
+    96,70,40,129,1,38,66,92,56,62,92,60,30,32,57,79,46,137,206,44,2,0,40,0,
+    0,4,96,5,153,0,16,0,22,130,207,37,51,21,20,6,35,35,67,63,3,65,177,5,
+    32,3,65,103,3,8,44,33,3,135,217,19,20,178,157,253,133,20,29,4,18,2,185,166,
+    157,3,5,253,247,2,1,2,5,102,16,22,254,135,1,121,23,17,91,3,157,254,187,26,
+    60,32,253,59,65,33,6,33,3,254,130,83,32,46,130,12,130,79,33,33,3,73,249,10,
+    65,33,6,66,117,5,65,20,5,8,86,6,7,39,19,33,3,210,48,57,254,62,66,112,
+    95,112,171,116,59,80,139,188,109,63,116,100,86,33,54,18,30,19,51,72,97,67,75,120,
+    85,46,39,79,118,79,54,116,62,112,116,2,167,5,75,38,49,254,136,24,66,116,158,93,
+    114,184,131,70,25,42,54,30,76,26,31,38,31,48,89,124,77,67,108,76,42,18,20,33,
+    2,158,76,123,3,130,137,33,4,50,130,137,32,26,132,139,138,132,66,64,4,71,107,4,
+    33,54,54,70,101,5,135,141,8,95,14,2,2,138,86,154,116,68,72,129,182,109,108,175,
+    124,67,84,91,1,107,14,50,32,158,254,15,51,124,254,214,40,77,111,71,72,116,83,45,
+    44,80,112,67,72,116,81,43,3,110,57,109,159,102,99,170,126,72,69,127,181,112,94,212,
+    122,1,233,18,25,253,139,35,39,254,76,69,114,82,45,46,82,112,66,70,113,79,42,49,
+    83,109,0,1,0,110,0,0,4,60,130,141,32,18,130,139,69,252,3,71,231,5,8,48,
+    54,54,55,33,34,38,53,53,4,60,15,8,253,175,13,46,39,127,2,90,13,27,17,253,
+    20,17,27,5,153,80,34,44,15,251,83,26,37,4,158,25,42,19,27,17,121,0,3,0,
+    96,130,211,43,38,5,169,0,31,0,51,0,71,0,0,5,134,205,71,49,5,65,104,5,
+    32,6,66,144,6,32,39,138,213,67,233,3,32,19,142,15,8,120,2,67,107,178,128,70,
+    144,134,113,115,62,114,159,98,97,160,114,62,116,112,134,144,71,127,178,107,70,111,77,41,
+    49,83,108,59,59,108,83,49,41,77,111,70,70,99,62,28,33,65,97,64,64,97,65,33,
+    28,62,99,16,57,106,151,94,138,179,38,42,167,116,79,138,102,58,58,102,138,79,116,167,
+    42,38,179,138,94,151,106,57,142,39,71,99,60,74,105,66,31,31,66,105,74,60,99,71,
+    39,2,176,43,71,92,49,50,88,66,38,38,66,88,50,49,92,71,43,65,155,3,36,148,
+    0,0,4,54,134,199,33,0,1,72,233,10,67,235,5,65,27,7,34,6,6,1,72,249,
+    15,8,94,37,81,145,110,65,70,126,174,104,103,168,120,65,23,44,61,39,254,163,13,48,
+    31,164,1,180,22,38,17,55,138,1,25,43,76,105,63,66,109,77,42,39,73,105,65,72,
+    111,76,40,2,76,54,105,153,99,94,164,122,70,68,122,170,103,62,111,106,105,56,254,8,
+    19,23,2,59,29,52,26,44,46,1,163,67,109,76,41,43,76,106,63,68,107,74,38,47,
+    78,102,130,155,38,128,255,241,1,121,3,218,69,63,5,69,171,15,32,17,142,15,32,128,
+    69,187,15,69,203,31,33,3,9,76,47,17,33,128,254,133,113,34,30,0,50,70,147,26,
+    76,165,15,32,134,70,163,24,32,6,143,132,70,180,26,33,2,252,143,143,40,1,0,148,
+    0,234,3,154,4,87,66,171,3,32,19,66,172,4,32,5,71,210,5,33,5,22,71,206,
+    3,8,40,148,3,6,16,20,254,63,20,45,25,25,45,20,1,193,20,16,252,250,2,198,
+    1,145,127,17,25,10,228,11,15,6,5,16,10,227,10,26,16,128,1,146,130,217,42,150,
+    1,183,3,241,3,141,0,3,0,7,71,17,5,70,6,3,36,150,3,91,252,165,131,3,
+    37,2,62,135,1,214,135,68,53,3,32,238,130,113,32,243,133,113,32,55,66,208,3,33,
+    37,54,72,92,4,32,37,72,88,3,35,1,21,238,16,131,103,35,43,25,25,43,131,119,
+    38,16,3,5,234,128,16,26,130,101,44,16,5,6,15,11,228,10,25,17,127,254,111,74,
+    130,109,42,34,255,241,2,248,5,169,0,40,0,60,78,143,16,33,53,52,78,144,3,66,
+    76,5,78,145,4,65,76,13,8,35,34,31,75,89,103,60,79,135,98,56,45,69,82,71,
+    51,4,18,122,12,45,69,79,69,45,34,58,79,45,61,87,60,37,12,25,14,149,78,10,
+    16,8,35,25,29,52,40,23,46,84,120,75,76,110,83,61,54,54,33,153,166,11,42,65,
+    57,57,69,88,60,43,70,49,26,30,36,30,23,251,160,65,237,17,47,86,255,17,6,28,
+    5,79,0,81,0,97,0,0,37,34,38,74,250,10,70,61,3,34,3,6,21,68,147,14,
+    36,21,20,18,22,22,75,10,3,41,54,51,50,23,23,6,4,35,34,36,71,206,3,33,
+    62,4,130,192,32,4,131,192,32,37,130,44,33,55,19,79,108,4,8,172,21,20,22,4,
+    143,78,98,13,58,136,78,60,88,59,29,65,128,191,125,67,101,45,93,19,18,31,41,23,
+    49,88,67,39,89,155,211,122,134,234,174,100,107,185,249,143,152,233,85,15,12,21,10,25,
+    107,254,239,173,173,254,214,219,125,55,100,140,172,198,108,92,176,157,132,95,53,61,107,145,
+    254,2,31,63,59,49,17,76,39,46,75,125,90,51,66,186,75,78,81,70,41,73,100,58,
+    85,173,139,88,21,20,254,151,75,49,36,47,27,10,56,102,143,87,138,208,139,69,102,180,
+    246,145,170,254,255,174,88,66,51,9,24,66,72,82,110,207,1,44,190,109,202,175,145,103,
+    57,40,78,115,149,183,107,108,183,134,76,120,20,50,86,65,1,39,9,63,102,132,69,72,
+    87,68,9,3,36,10,0,0,5,73,79,147,4,35,21,0,0,33,71,30,3,33,3,33,
+    78,215,4,36,1,51,1,33,3,65,28,3,8,54,7,5,73,150,26,32,8,134,253,125,
+    134,7,34,25,150,2,61,197,254,146,2,23,225,22,21,11,21,10,26,20,1,90,254,166,
+    18,28,5,153,252,123,2,71,54,81,41,69,26,0,3,0,174,0,0,4,160,130,83,41,
+    20,0,31,0,42,0,0,51,17,33,71,171,14,32,1,130,17,65,95,3,34,38,35,37,
+    135,8,8,84,33,174,1,201,132,191,123,59,33,67,101,68,157,160,67,129,187,120,254,199,
+    1,54,83,119,77,36,157,159,254,203,1,0,82,120,79,38,152,160,254,249,5,153,52,96,
+    139,87,53,98,84,66,21,31,164,134,91,150,108,59,2,141,254,13,38,69,95,57,111,129,
+    138,36,64,91,54,126,118,0,1,0,90,255,240,5,9,5,169,70,121,5,33,23,23,73,
+    130,10,32,36,65,227,3,72,8,4,33,46,4,68,216,11,8,85,55,54,4,160,16,13,
+    76,88,251,177,155,252,178,98,105,190,1,9,160,158,229,89,63,7,18,17,13,29,40,54,
+    74,98,64,115,191,138,77,77,133,182,105,64,102,87,75,38,17,1,40,13,83,102,114,107,
+    193,1,14,162,162,1,14,194,107,98,84,89,10,13,19,28,32,28,19,79,146,210,130,134,
+    210,145,76,15,32,49,34,15,65,97,3,42,174,0,0,5,136,5,153,0,12,0,25,74,
+    15,5,34,4,35,33,130,255,32,4,74,8,6,131,11,8,53,62,2,5,136,102,186,254,
+    252,158,253,232,2,24,158,1,4,186,102,199,72,132,188,115,254,171,1,85,115,188,132,72,
+    2,204,161,254,248,188,103,5,153,103,189,254,248,161,132,208,144,76,251,161,76,143,208,130,
+    231,130,91,33,4,33,130,91,75,125,3,67,220,5,132,3,52,4,33,253,80,2,45,253,
+    211,2,176,252,141,5,153,158,254,36,152,254,23,158,130,38,138,49,32,9,137,49,32,35,
+    133,47,35,76,253,180,195,131,44,35,11,158,253,152,133,43,65,69,3,38,64,5,169,0,
+    52,0,0,66,226,4,32,17,80,234,3,36,53,33,17,14,3,67,2,6,65,78,4,78,
+    94,6,78,93,10,8,64,3,45,58,97,86,76,38,222,19,23,1,184,54,117,133,152,89,
+    156,254,252,188,105,103,191,1,15,168,85,146,125,106,46,55,17,27,16,19,25,62,89,121,
+    83,121,196,138,74,77,140,192,141,11,22,31,20,1,60,22,16,110,253,218,39,58,39,19,
+    65,87,4,55,164,1,14,193,106,25,47,67,42,88,27,11,14,40,37,26,79,147,209,130,
+    136,213,148,78,134,197,33,5,56,133,247,34,33,35,17,131,194,32,51,130,5,52,51,5,
+    56,195,252,252,195,195,3,4,195,2,140,253,116,5,153,253,129,2,127,130,45,32,210,130,
+    50,32,148,130,45,32,3,132,45,36,51,1,148,194,194,130,13,38,1,0,60,255,240,2,
+    201,130,9,32,23,80,27,7,32,39,79,21,5,33,50,22,67,254,4,8,41,17,51,2,
+    201,59,115,168,109,97,105,2,6,3,2,21,21,18,60,50,66,103,71,37,193,1,239,120,
+    190,131,70,28,29,57,28,17,21,18,40,84,131,90,3,130,142,34,1,0,194,130,147,32,
+    58,130,77,78,112,3,79,56,4,80,78,6,69,185,3,32,1,73,124,4,34,1,46,3,
+    73,224,4,8,68,51,1,131,73,38,45,20,1,221,22,41,32,165,253,222,21,37,21,28,
+    42,23,2,58,168,19,26,19,16,8,254,17,11,19,25,33,24,88,193,193,3,37,19,23,
+    2,28,25,21,253,151,23,32,10,9,36,27,253,89,6,10,16,9,2,57,12,17,12,5,
+    253,112,132,193,130,120,33,3,220,130,9,32,5,75,239,3,33,21,33,130,89,39,112,2,
+    108,252,210,194,163,163,65,237,8,33,6,129,130,10,32,35,130,12,130,134,32,54,134,149,
+    130,131,73,131,3,33,6,35,130,242,130,23,32,21,131,147,32,50,130,165,8,70,3,111,
+    14,21,10,10,22,14,1,229,13,28,26,143,170,2,2,254,21,25,45,28,45,25,254,10,
+    3,3,170,143,26,28,13,1,239,2,6,24,53,27,28,51,26,3,113,23,10,250,103,4,
+    29,21,48,25,252,128,45,45,3,131,26,50,21,251,227,5,153,10,23,252,142,65,161,11,
+    74,217,3,131,90,35,38,38,53,17,130,119,33,34,38,136,112,8,41,1,18,26,25,16,
+    3,62,3,2,170,98,23,31,15,252,195,2,2,170,100,5,153,13,20,251,200,26,49,23,
+    3,247,250,103,16,19,4,55,25,48,20,252,3,131,203,38,2,0,92,255,241,5,225,77,
+    87,11,32,4,66,133,11,32,4,77,87,17,51,5,225,102,186,254,251,158,158,254,252,186,
+    102,102,186,1,4,158,158,1,5,67,89,5,41,116,115,188,133,72,72,133,188,115,116,67,
+    93,6,8,32,243,194,107,107,194,1,13,161,161,1,13,195,108,108,195,254,243,161,132,210,
+    145,78,78,145,210,132,132,209,145,77,77,145,209,130,127,36,194,0,0,4,127,130,138,32,
+    14,67,199,4,130,193,68,213,7,33,35,39,70,45,5,8,45,38,35,35,1,131,193,1,
+    167,136,201,132,65,70,135,200,129,230,230,83,127,86,44,169,171,230,2,24,253,232,5,153,
+    63,116,164,101,100,166,120,67,154,44,79,110,66,137,154,131,209,34,254,216,6,77,103,3,
+    32,28,79,215,4,73,121,4,69,128,4,68,157,3,158,217,45,41,78,112,70,1,112,160,
+    36,56,23,252,57,123,67,161,226,44,101,182,157,128,47,254,115,20,25,1,18,18,20,158,
+    234,134,235,32,229,130,235,32,24,66,57,4,138,235,32,7,66,203,4,35,39,1,38,38,
+    142,245,8,70,149,136,198,129,62,48,91,131,83,36,28,1,162,172,53,25,254,140,17,40,
+    40,147,203,85,129,87,44,169,167,212,2,86,253,170,5,153,55,104,147,91,76,132,105,74,
+    19,21,40,253,199,41,2,0,24,21,141,41,75,104,63,128,130,0,1,0,58,255,240,3,
+    219,5,169,86,201,3,32,1,71,144,5,134,240,32,6,86,181,6,84,170,7,133,117,33,
+    46,6,71,175,8,8,41,140,9,20,16,17,45,69,97,69,65,100,67,34,59,97,123,129,
+    123,97,59,64,123,179,114,139,229,81,56,8,23,14,21,54,81,115,83,69,108,75,40,59,
+    96,130,26,8,59,96,59,59,112,165,107,120,198,74,4,185,15,15,34,41,34,35,60,81,
+    47,60,79,56,41,44,55,84,122,89,94,165,122,70,101,86,92,11,15,45,54,45,38,69,
+    96,59,65,83,56,39,41,54,86,129,95,76,142,110,66,76,72,130,165,38,28,0,0,4,
+    126,5,153,73,77,3,32,1,80,235,6,46,4,126,254,49,194,254,47,5,153,163,251,10,
+    4,246,163,130,24,37,0,160,255,239,5,21,130,37,32,25,69,55,5,66,248,3,76,250,
+    7,131,10,8,37,30,2,2,219,89,140,97,51,193,79,147,212,132,132,212,148,79,193,51,
+    97,141,154,60,108,150,90,3,103,252,153,124,212,155,88,88,155,212,124,130,11,36,154,90,
+    150,108,61,130,79,36,8,0,0,5,71,76,187,5,86,85,3,32,23,67,202,11,8,41,
+    1,35,8,155,26,32,8,1,149,14,23,11,9,21,14,1,147,7,34,25,156,253,184,175,
+    5,153,26,20,252,13,34,80,43,43,80,34,3,243,17,29,250,103,131,153,36,14,0,0,
+    7,231,130,73,32,40,146,73,132,14,138,87,32,1,71,252,4,8,49,1,35,14,161,26,
+    34,6,1,40,8,13,6,7,14,9,1,81,6,35,25,56,26,33,7,1,79,18,14,6,
+    10,8,1,41,5,35,25,151,254,65,174,254,149,11,9,5,9,5,254,147,174,132,121,42,
+    28,27,62,34,34,63,26,3,228,17,29,131,13,35,52,67,33,60,130,12,44,18,28,250,
+    103,4,69,31,41,20,37,15,251,187,134,143,33,4,246,130,143,32,27,130,12,32,1,132,
+    129,135,126,67,9,4,32,1,77,167,7,8,62,251,254,39,193,21,20,8,1,118,7,14,
+    1,97,9,21,15,185,254,37,1,235,192,22,25,8,254,128,7,11,254,138,9,23,21,180,
+    2,224,2,185,14,13,253,194,21,25,2,12,14,17,253,80,253,23,23,14,2,89,21,19,
+    253,207,14,23,65,67,5,33,4,228,72,147,4,66,207,4,32,1,143,253,8,44,2,214,
+    193,253,243,170,26,30,11,1,72,20,27,11,11,26,20,1,71,9,31,25,172,2,58,253,
+    198,2,58,3,95,26,19,253,211,35,62,30,31,62,34,2,45,16,29,130,79,32,86,130,
+    79,70,83,3,32,13,78,79,4,34,7,1,33,81,24,3,62,55,1,33,53,4,148,21,
+    252,213,3,50,251,208,19,3,44,252,231,5,153,72,34,30,251,141,158,76,30,27,4,118,
+    91,89,3,38,142,254,223,1,254,5,253,131,55,34,19,17,33,79,242,5,130,139,54,21,
+    21,142,1,112,27,22,169,169,22,27,254,223,7,30,70,22,25,249,205,25,23,70,130,92,
+    37,255,236,255,166,2,239,82,121,5,88,69,3,67,127,3,51,38,39,20,76,33,48,13,
+    2,89,75,29,56,13,5,193,34,32,250,39,34,67,168,3,33,0,90,130,93,32,202,133,
+    93,33,23,52,69,232,4,71,177,5,33,33,90,133,91,45,1,112,254,144,219,20,28,6,
+    51,27,20,70,248,226,131,49,36,158,3,19,3,221,130,199,32,17,130,12,32,51,132,90,
+    37,3,38,38,39,6,7,74,3,4,8,35,2,4,115,1,102,129,17,24,8,196,13,19,
+    7,14,23,194,8,23,20,136,5,153,253,122,20,14,1,96,23,43,21,44,43,254,160,14,
+    65,80,3,39,0,0,254,227,3,20,255,91,71,97,3,42,5,21,33,53,3,20,252,236,
+    165,120,120,131,25,38,38,4,139,1,179,5,169,131,189,32,19,130,188,32,23,132,97,50,
+    207,33,32,14,149,102,21,26,14,234,5,169,21,23,242,13,15,1,2,69,225,5,40,240,
+    3,122,4,7,0,41,0,57,74,139,6,32,39,72,106,3,86,150,6,90,206,8,130,22,
+    68,10,5,33,21,1,72,149,3,34,53,14,3,72,116,4,8,97,122,79,26,32,5,20,
+    40,76,84,95,58,59,103,76,45,66,147,238,172,101,99,65,89,65,47,23,18,27,8,32,
+    84,194,118,85,132,90,46,254,50,47,78,69,63,30,123,172,108,49,26,44,60,16,26,94,
+    36,57,39,20,33,66,101,69,60,111,86,55,4,79,118,121,33,41,33,19,14,57,81,80,
+    56,100,142,85,253,229,19,35,50,32,211,4,31,50,68,42,40,58,37,17,131,163,42,152,
+    255,242,4,22,5,193,0,22,0,37,74,217,3,34,51,17,54,91,90,11,40,39,7,6,
+    35,1,34,6,7,17,76,48,4,76,64,3,8,63,152,179,63,163,105,88,142,100,54,60,
+    113,163,102,98,137,51,9,8,38,1,81,87,131,55,48,117,72,142,152,35,66,96,5,193,
+    253,162,73,89,66,131,193,126,112,193,141,81,76,68,92,38,3,119,80,73,254,22,66,54,
+    202,187,99,142,91,42,86,93,4,37,255,242,3,127,4,5,75,75,3,69,27,13,69,12,
+    4,32,51,74,224,6,76,194,10,8,70,69,8,16,15,15,35,54,77,56,74,114,77,39,
+    42,76,109,68,65,84,56,36,18,23,11,50,66,198,110,95,163,120,69,63,121,178,115,106,
+    164,63,3,65,11,12,25,30,25,53,100,142,88,92,143,97,51,31,38,31,17,65,81,75,
+    70,133,194,124,113,192,139,78,69,63,131,239,32,72,130,123,32,197,135,239,34,33,34,39,
+    77,45,14,43,17,51,17,37,50,54,55,17,38,38,35,34,77,56,4,40,3,91,38,10,
+    16,65,167,108,87,132,242,39,162,103,93,132,52,178,254,61,130,240,46,49,117,71,142,152,
+    34,66,96,37,123,79,95,67,130,194,130,238,46,142,81,63,57,2,50,250,63,130,80,73,
+    1,234,66,53,130,239,32,141,131,239,32,2,132,239,32,199,130,239,32,36,92,229,3,82,
+    57,5,34,6,35,33,83,211,5,131,237,66,20,9,8,65,23,34,6,7,33,52,46,2,
+    2,35,91,154,112,63,18,25,253,94,2,48,84,116,72,67,97,70,47,17,22,12,50,33,
+    92,105,112,55,105,177,129,72,65,122,176,114,129,148,18,2,39,34,66,95,4,5,61,115,
+    169,108,42,28,96,142,95,47,31,36,130,242,50,40,59,38,19,71,137,202,131,106,184,135,
+    77,131,149,132,62,103,75,41,130,118,95,67,3,35,2,148,5,174,86,167,3,33,51,17,
+    87,196,3,33,53,51,133,245,76,62,4,65,129,4,32,21,73,115,3,8,47,186,112,21,
+    27,160,49,91,128,80,68,58,4,1,32,29,31,46,75,54,29,1,37,254,225,3,93,13,
+    5,21,20,73,98,87,135,93,48,20,89,20,8,24,54,88,65,93,129,252,160,95,147,3,
+    44,50,254,147,3,222,4,6,0,57,0,77,0,93,73,33,5,36,33,21,20,7,7,84,
+    202,6,34,39,6,6,70,249,9,82,98,11,134,6,35,1,52,46,4,133,35,90,184,5,
+    71,136,6,65,129,5,8,172,1,231,66,115,47,1,19,42,115,34,57,101,139,83,71,63,
+    32,33,58,96,122,127,122,96,58,65,122,176,111,111,167,110,55,95,83,43,51,16,33,48,
+    32,75,85,57,102,141,1,144,42,72,94,104,108,49,57,71,35,72,109,74,72,114,79,42,
+    254,196,54,83,56,28,113,108,107,113,29,56,82,4,6,29,28,66,33,9,16,65,80,74,
+    121,86,46,17,20,46,22,36,37,16,4,9,22,50,88,70,65,122,95,57,44,74,97,53,
+    75,105,31,20,67,56,22,47,46,42,16,42,139,93,74,121,85,46,251,195,38,46,25,12,
+    5,6,8,27,78,54,34,59,43,25,26,48,66,2,78,30,54,75,45,93,110,110,93,45,
+    75,54,30,0,1,0,146,0,0,3,221,5,193,78,117,3,67,69,10,74,152,3,131,199,
+    8,48,7,17,146,178,65,158,103,83,127,85,44,178,105,108,79,137,58,5,193,253,172,69,
+    83,55,101,142,86,253,123,2,133,115,127,76,65,253,22,0,2,0,130,0,0,1,128,5,
+    179,0,3,75,195,4,130,61,32,19,91,185,14,59,1,88,178,218,21,35,46,26,26,45,
+    35,20,20,35,45,26,26,46,35,21,3,245,252,11,3,245,1,62,136,19,32,47,131,7,
+    39,47,0,0,2,255,200,254,148,132,79,32,20,71,33,3,94,161,4,72,121,8,67,208,
+    4,146,95,47,32,69,109,76,33,54,27,8,2,14,15,8,18,13,78,66,146,110,47,251,
+    192,61,105,78,45,10,10,96,13,7,1,73,81,4,64,145,122,40,1,0,152,0,0,3,
+    248,5,193,66,109,3,33,1,17,76,62,18,32,38,73,115,4,76,61,3,8,60,1,75,
+    46,20,26,16,1,64,15,30,25,162,254,139,14,27,17,18,29,13,1,140,160,22,31,14,
+    254,179,15,30,30,50,179,5,193,252,157,11,17,1,87,16,20,254,115,17,26,10,12,31,
+    20,254,12,17,18,1,159,21,13,254,28,130,97,34,1,0,166,130,99,32,88,130,9,32,
+    3,71,11,6,37,88,178,5,193,250,63,130,16,65,151,5,33,5,239,68,107,5,32,51,
+    130,135,33,23,23,132,251,32,23,81,204,6,65,159,6,32,14,65,169,12,8,47,106,38,
+    10,13,56,139,92,103,127,28,21,69,86,97,50,80,125,87,46,178,104,99,44,79,60,35,
+    178,98,94,66,113,47,3,245,37,104,69,88,114,97,55,80,52,24,51,98,143,92,65,193,
+    3,37,119,123,31,60,91,60,131,9,37,122,120,71,61,253,13,66,17,7,130,121,32,23,
+    139,121,32,30,143,105,35,14,66,163,107,66,22,9,130,90,34,110,73,90,66,22,14,68,
+    181,5,33,4,14,130,75,32,19,74,191,4,86,123,12,34,62,2,19,69,153,3,32,38,
+    85,135,8,8,59,44,111,179,125,67,67,125,179,111,111,179,126,68,68,126,179,111,150,148,
+    148,150,76,112,75,37,37,75,112,4,5,74,136,193,119,120,192,136,73,73,136,192,120,119,
+    193,136,74,252,120,201,180,181,202,52,98,143,90,90,142,97,52,131,107,38,146,254,169,4,
+    15,4,7,69,33,5,32,19,139,185,66,62,6,32,17,70,17,13,131,197,35,15,65,167,
+    109,69,33,4,39,112,163,102,94,133,51,1,17,69,32,4,33,72,141,70,17,3,41,254,
+    169,5,76,37,120,79,96,67,131,69,36,3,39,141,81,62,57,254,64,4,206,70,19,13,
+    130,225,35,254,169,3,197,135,117,65,197,3,69,151,13,35,55,54,51,1,69,151,13,36,
+    197,178,64,163,105,69,149,7,39,98,137,54,12,10,38,254,167,130,118,33,48,118,69,151,
+    5,39,3,245,250,180,1,237,74,90,69,155,7,37,70,64,79,37,252,141,69,154,3,33,
+    64,55,69,154,6,65,163,4,33,2,250,132,117,65,163,4,32,22,66,30,7,94,95,4,
+    65,163,5,8,35,102,29,22,4,12,52,153,103,42,68,29,23,7,24,14,58,52,93,125,
+    42,3,245,22,27,158,106,119,19,17,133,25,19,108,103,253,123,130,73,38,62,255,240,3,
+    15,4,5,84,41,3,32,1,75,238,43,8,46,2,214,12,25,15,38,55,76,52,45,72,
+    51,27,45,74,94,99,94,74,45,50,98,142,93,106,172,60,42,8,22,18,18,40,57,81,
+    61,52,78,52,25,45,74,95,99,95,74,45,95,73,3,8,52,100,159,58,3,78,22,22,
+    27,23,23,40,53,31,39,52,38,29,33,40,60,87,61,70,119,87,50,69,54,68,13,14,
+    28,34,28,27,46,60,34,42,55,39,29,32,41,62,91,65,58,107,81,48,63,55,130,150,
+    39,0,44,255,240,2,186,5,62,98,173,3,35,5,34,38,53,73,76,5,32,55,97,223,
+    4,81,56,4,33,20,22,71,127,9,44,1,197,120,129,122,16,22,166,41,2,22,17,90,
+    98,63,3,8,38,62,49,28,41,30,21,8,14,11,52,46,130,16,134,126,2,108,19,20,
+    71,21,1,57,15,19,254,163,129,253,160,64,62,15,18,15,17,85,43,49,131,103,38,122,
+    255,240,3,197,3,245,68,195,5,131,84,33,54,55,79,43,4,71,108,8,40,17,1,44,
+    106,107,78,138,58,178,67,0,4,59,164,106,83,127,86,43,3,245,253,122,115,126,74,66,
+    2,235,252,11,37,109,73,89,55,100,142,86,2,134,130,77,36,18,0,0,3,237,130,77,
+    76,45,21,8,39,18,146,21,28,6,1,1,14,16,7,8,18,14,1,4,6,27,20,139,
+    254,99,161,3,245,22,15,253,116,36,72,35,35,72,36,2,140,16,21,252,11,75,157,6,
+    35,5,239,3,247,83,69,3,132,73,32,19,133,73,32,19,76,45,6,139,14,78,20,3,
+    74,56,4,74,57,3,8,49,35,35,14,140,22,28,5,194,8,14,5,8,20,11,214,5,
+    25,19,77,20,26,5,209,11,17,8,5,16,9,198,5,28,19,134,254,184,141,26,10,224,
+    8,10,5,5,10,8,227,11,30,134,134,127,50,67,34,34,67,36,2,144,15,20,20,15,
+    253,112,35,68,33,33,72,31,133,141,42,34,2,175,23,47,23,23,48,23,253,82,95,207,
+    4,32,28,130,227,32,210,130,227,76,55,8,32,19,135,135,79,65,6,74,191,5,8,57,
+    1,127,254,171,171,22,20,8,248,9,17,218,10,20,15,164,254,171,1,99,171,22,25,8,
+    255,7,14,236,10,23,20,159,2,7,1,238,14,13,254,132,28,28,1,64,14,17,254,28,
+    253,239,23,14,1,141,29,23,254,167,76,51,4,36,14,254,169,3,240,130,101,32,22,73,
+    119,5,33,35,19,76,53,16,49,1,187,9,27,28,132,185,254,94,154,23,26,6,1,15,
+    9,13,5,77,35,3,58,7,6,29,17,142,254,213,20,24,1,146,3,186,23,14,253,130,
+    22,44,23,23,44,23,2,125,16,21,130,85,32,70,130,187,32,85,130,85,32,15,91,161,
+    4,76,57,6,130,79,8,35,33,53,33,3,85,14,11,253,220,2,41,253,5,13,12,2,
+    39,253,223,2,240,3,169,19,35,14,253,38,139,74,13,35,16,2,223,140,131,251,47,44,
+    254,223,2,0,5,253,0,64,0,0,19,52,38,35,53,68,85,5,67,31,4,92,66,5,
+    67,240,5,79,173,4,96,130,5,34,21,20,22,65,176,3,33,21,21,68,33,7,60,181,
+    70,67,67,70,16,19,16,41,83,123,82,53,28,12,20,77,89,14,18,14,22,41,55,33,
+    33,55,41,22,130,10,41,89,77,20,12,28,53,82,123,83,41,130,36,8,53,1,169,63,
+    81,107,80,64,50,98,98,100,52,69,116,84,46,79,20,18,101,86,56,104,99,98,50,38,
+    65,51,37,9,9,37,52,64,37,50,98,99,104,56,87,100,18,20,80,47,84,116,69,52,
+    99,99,98,131,169,36,230,254,169,1,112,130,169,95,141,3,41,51,17,35,230,138,138,5,
+    253,248,172,131,25,32,88,130,195,32,44,133,195,32,1,134,171,34,35,35,53,76,177,3,
+    137,205,32,55,97,158,5,80,97,4,67,120,3,69,82,7,131,205,36,21,34,6,1,163,
+    130,155,33,42,82,157,192,33,82,42,130,36,131,236,33,1,169,130,162,32,99,131,191,37,
+    47,80,20,18,100,87,132,191,34,37,64,52,131,191,34,51,65,38,132,191,37,86,101,18,
+    20,79,46,131,191,39,100,98,98,50,64,80,107,81,130,169,36,116,1,158,4,18,130,192,
+    66,105,3,35,50,54,55,51,70,71,6,68,235,3,32,35,72,3,6,46,2,247,65,73,
+    1,144,37,69,102,64,52,102,95,86,36,133,12,33,101,65,131,12,44,2,101,85,70,67,
+    112,80,44,32,39,33,84,71,130,8,35,45,33,39,33,69,189,3,38,218,254,169,1,212,
+    4,5,103,9,7,131,237,35,51,30,3,21,103,9,17,32,6,103,9,8,38,213,19,34,
+    45,27,26,45,88,205,3,32,45,88,205,4,49,254,169,2,29,45,85,87,92,52,52,92,
+    87,85,45,253,227,4,223,88,227,6,32,27,88,243,6,130,103,45,138,255,21,4,2,4,
+    230,0,46,0,55,0,0,5,101,227,17,101,228,6,71,221,3,32,22,68,197,3,101,231,
+    5,34,3,20,22,101,222,3,41,2,49,92,155,113,63,66,126,184,119,101,183,4,56,16,
+    82,132,54,46,8,15,14,12,33,45,63,42,52,63,85,59,38,16,11,18,5,48,60,185,
+    101,214,5,8,58,231,135,121,52,76,115,78,39,11,10,79,132,182,114,111,187,138,81,3,
+    179,20,29,233,12,63,49,62,11,11,17,24,24,7,253,6,4,31,34,28,9,7,63,72,
+    74,7,175,19,29,2,229,162,192,23,2,248,6,57,99,136,66,17,3,40,52,0,0,4,
+    91,5,168,0,62,66,213,3,130,159,91,232,7,133,164,100,187,8,79,50,5,131,4,32,
+    7,130,197,32,33,65,39,4,32,33,95,226,3,8,104,17,35,52,32,29,134,54,110,164,
+    110,78,121,94,69,24,72,10,21,10,14,25,11,20,41,51,66,45,63,96,64,32,1,185,
+    30,22,254,123,57,50,29,57,30,2,164,11,20,28,18,252,60,34,62,48,29,195,2,160,
+    26,36,1,5,94,165,123,71,39,68,90,52,46,6,5,11,14,25,47,35,21,42,78,110,
+    68,254,249,72,18,30,243,75,109,45,5,7,76,14,27,23,14,115,10,34,51,69,46,1,
+    65,191,4,40,132,0,224,4,4,4,96,0,35,65,87,3,130,175,34,55,39,55,71,9,
+    6,33,55,23,88,228,4,35,6,7,23,7,69,189,4,39,38,39,7,39,55,38,38,55,
+    90,83,14,59,223,33,29,153,91,151,44,104,58,57,102,43,153,89,151,31,34,33,29,152,
+    91,152,44,104,57,57,101,44,130,15,52,30,34,132,35,62,81,47,47,83,61,36,36,61,
+    83,47,47,81,62,35,2,160,131,26,33,90,152,130,42,33,30,153,130,42,32,103,131,58,
+    35,151,92,152,30,130,58,133,15,33,46,81,131,45,40,81,46,47,82,62,35,35,62,82,
+    68,43,4,35,0,0,4,83,86,147,5,33,19,33,68,189,17,32,33,76,192,3,99,179,
+    7,8,35,53,33,146,1,50,254,104,149,26,31,10,1,20,14,20,7,7,18,14,1,19,
+    8,33,25,150,254,103,1,51,254,172,1,84,254,172,179,133,6,62,2,113,3,40,25,20,
+    253,202,35,58,29,29,59,34,2,54,17,28,252,216,102,105,103,254,197,1,59,103,105,0,
+    2,67,247,10,32,7,67,249,5,32,17,67,253,5,67,255,3,37,252,230,254,225,252,229,
+    65,67,3,42,114,255,131,3,135,5,167,0,72,0,90,72,3,17,95,69,7,72,9,20,
+    95,112,9,130,207,102,205,3,32,54,68,52,3,77,17,3,33,3,49,72,29,6,8,45,
+    48,77,53,28,49,79,102,105,102,79,49,78,84,49,62,50,97,143,92,106,172,60,41,8,
+    23,17,18,40,58,85,63,50,79,54,28,50,82,104,110,104,82,50,86,93,50,63,72,37,
+    6,49,253,183,70,109,132,62,54,48,30,52,70,79,84,40,66,54,4,241,72,53,3,50,
+    25,42,56,31,38,57,47,43,46,55,71,92,61,81,127,38,37,98,69,72,59,9,8,45,
+    35,28,25,45,62,38,45,66,51,42,44,51,70,93,64,78,125,35,38,105,75,58,107,80,
+    48,62,55,253,164,51,71,57,53,31,26,75,47,36,56,46,38,35,35,20,30,73,130,245,
+    38,14,4,154,2,86,5,123,86,197,5,76,77,15,32,5,142,15,50,239,18,32,41,23,
+    22,40,31,18,18,31,40,22,23,41,32,18,1,103,92,72,3,36,23,41,30,18,18,107,
+    94,3,38,41,31,18,5,9,23,40,131,13,35,40,23,23,42,131,39,33,42,23,142,15,
+    46,0,3,0,68,255,242,5,249,5,168,0,46,0,74,0,69,152,3,66,169,5,80,52,
+    14,32,7,80,89,17,32,1,92,227,9,32,4,130,27,36,4,55,20,30,4,65,133,6,
+    91,59,4,8,57,4,6,8,11,6,11,8,6,61,57,166,116,98,161,115,63,69,122,167,
+    98,108,152,57,46,5,16,12,14,31,50,76,59,70,113,79,43,43,76,106,62,48,66,48,
+    37,252,82,52,95,134,162,186,101,101,187,162,134,95,52,131,11,35,187,101,101,186,131,11,
+    55,100,44,82,114,140,162,88,132,231,171,99,45,82,115,140,163,88,132,230,170,98,1,207,
+    5,130,144,8,46,64,66,73,68,122,168,100,101,169,121,67,68,55,65,6,12,22,27,23,
+    45,84,120,75,77,121,82,43,12,20,24,1,9,101,187,163,133,96,52,52,96,133,163,187,
+    101,100,187,162,133,11,130,100,50,89,164,143,116,83,45,100,173,233,134,89,166,143,118,83,
+    46,101,175,235,82,95,4,40,3,63,2,84,5,170,0,41,0,100,76,3,82,95,36,32,
+    54,82,94,5,8,93,22,2,84,60,18,18,8,12,24,46,50,56,34,38,65,48,27,38,
+    88,145,107,58,57,38,50,37,29,16,14,20,5,22,52,121,73,54,84,58,30,254,225,51,
+    74,36,70,97,60,26,52,3,72,11,18,49,21,32,23,11,20,41,60,41,34,67,53,35,
+    2,37,63,60,18,21,17,15,10,42,49,46,34,60,84,51,254,214,38,35,105,2,17,27,
+    35,21,42,34,131,155,40,138,0,129,3,1,3,162,0,20,130,157,35,0,19,53,19,104,
+    148,5,34,3,6,7,73,103,4,130,10,32,7,148,20,48,138,249,58,14,14,10,159,14,
+    14,15,13,159,5,5,28,58,47,142,15,58,2,6,23,1,133,28,7,22,13,17,16,254,
+    251,24,13,14,22,254,251,8,18,8,28,13,28,1,133,150,24,96,127,3,37,1,59,3,
+    240,2,227,90,85,3,32,19,68,28,4,43,148,3,92,151,253,59,2,227,254,88,1,33,
+    103,101,26,32,4,66,105,8,36,27,0,51,0,73,85,35,3,32,19,66,66,30,32,5,
+    131,94,109,26,5,32,22,130,212,74,69,5,88,90,7,36,46,2,35,35,68,66,54,45,
+    63,230,156,1,32,172,166,107,106,17,25,11,228,148,33,16,201,9,25,26,80,116,55,77,
+    47,21,19,43,70,52,132,2,204,66,49,42,8,38,224,254,158,3,124,125,122,94,132,25,
+    10,30,20,254,178,25,1,46,13,14,114,21,40,58,38,37,56,36,18,0,1,0,20,4,
+    207,2,82,5,68,65,5,7,49,20,2,62,253,194,5,68,117,0,2,0,70,3,39,2,
+    210,5,170,67,227,6,71,210,14,70,9,15,40,70,50,88,119,69,69,119,88,50,135,7,
+    8,34,127,30,54,73,42,42,72,54,30,30,54,72,42,42,73,54,30,4,104,67,118,87,
+    50,50,87,118,67,66,117,87,51,51,87,117,65,130,21,33,31,31,131,37,37,74,55,31,
+    31,55,74,66,63,3,40,100,0,80,4,34,4,178,0,11,74,87,4,105,137,10,69,228,
+    3,105,141,10,52,254,107,3,190,252,66,4,178,254,136,136,254,144,1,112,136,1,120,252,
+    37,135,130,205,38,82,3,132,2,81,6,101,83,113,9,109,244,3,75,232,5,103,243,6,
+    32,55,103,72,3,77,228,4,103,70,6,39,54,54,1,90,52,85,60,33,102,2,3,8,
+    67,162,23,47,21,195,21,23,254,1,10,12,221,25,44,32,19,60,45,46,57,14,8,19,
+    17,4,9,5,71,15,138,6,101,30,54,77,47,40,69,62,58,30,165,6,8,22,20,77,
+    43,13,28,12,219,25,52,53,53,27,51,55,48,42,14,16,1,1,12,106,106,130,133,36,
+    84,3,124,2,82,130,133,32,61,135,133,103,221,15,103,217,12,33,54,54,141,144,8,47,
+    62,3,1,98,51,82,59,32,119,66,69,42,69,91,48,57,84,61,43,15,55,15,14,29,
+    11,6,18,30,43,32,31,47,32,16,17,39,65,47,87,71,58,48,48,57,12,8,17,15,
+    130,156,8,48,67,7,44,65,84,6,101,29,51,68,40,128,45,19,78,62,55,84,57,29,
+    25,49,72,47,24,6,23,13,32,28,19,20,31,40,21,30,43,28,14,87,1,60,52,50,
+    52,47,40,16,15,130,169,35,53,79,53,27,130,171,36,196,4,139,2,85,86,217,5,32,
+    1,76,109,4,70,167,3,50,2,85,233,14,27,21,106,148,14,33,32,5,169,254,254,15,
+    13,242,23,75,243,3,32,122,79,173,3,35,3,245,0,29,77,225,20,33,38,39,93,18,
+    4,78,98,3,35,1,44,108,105,77,232,7,48,67,141,87,74,112,39,7,6,89,38,41,
+    3,245,253,110,109,120,77,236,7,43,72,68,51,46,42,87,38,254,233,40,36,5,130,80,
+    39,0,42,255,55,5,22,5,153,106,219,3,33,1,21,104,65,4,130,3,69,218,7,8,
+    33,5,22,219,157,254,235,157,104,166,117,63,63,117,166,104,5,153,153,250,55,5,201,250,
+    55,3,93,61,105,142,81,86,141,101,56,130,65,38,124,1,189,1,167,2,232,131,65,66,
+    175,15,50,124,23,41,54,30,31,56,40,24,24,40,56,31,30,54,41,23,2,81,139,13,
+    130,29,130,63,38,132,254,161,1,239,0,10,131,223,32,23,71,170,4,75,197,4,34,39,
+    55,51,71,198,12,8,48,172,6,16,22,32,21,42,43,22,41,60,38,43,112,24,90,81,
+    32,57,80,48,41,74,31,17,6,247,7,9,7,33,26,19,26,18,12,5,141,80,20,69,
+    54,32,51,36,19,17,14,55,103,172,3,39,0,120,3,132,2,68,6,95,66,215,3,35,
+    19,51,17,55,96,107,4,130,89,62,17,51,21,33,173,147,4,107,12,14,23,9,39,222,
+    108,130,254,105,3,217,1,184,43,88,9,14,56,190,253,122,85,81,35,4,35,3,60,2,
+    177,94,49,4,32,31,82,5,25,8,34,6,21,20,22,1,126,70,113,80,44,44,80,113,
+    70,71,114,81,44,44,81,114,71,84,83,83,84,87,83,83,5,169,43,80,115,71,104,108,
+    3,49,43,81,116,72,71,115,80,43,253,253,105,100,100,104,104,100,100,105,131,97,40,150,
+    0,129,3,13,3,162,0,18,81,133,3,32,55,102,45,4,34,19,54,55,89,67,3,130,
+    9,37,55,19,21,37,21,3,143,20,48,236,58,28,10,159,13,14,12,15,159,10,28,58,
+    249,1,40,249,139,15,47,129,28,13,28,17,17,1,5,24,12,11,26,1,5,17,17,130,
+    14,38,254,123,23,23,23,254,123,145,24,48,0,0,4,0,102,0,0,5,124,5,154,0,
+    16,0,32,0,38,94,69,4,78,2,5,34,21,35,53,106,69,6,32,37,65,50,14,38,
+    5,52,54,55,3,51,5,108,194,8,49,5,15,109,14,13,82,109,254,206,18,21,2,10,
+    1,86,124,251,140,65,83,12,62,4,7,2,3,241,236,253,16,19,44,29,76,3,50,18,
+    46,32,77,1,11,65,11,15,176,176,16,12,57,1,212,59,65,112,10,44,195,19,44,23,
+    254,185,214,31,22,5,92,29,32,86,227,3,131,155,32,93,130,155,34,45,0,61,105,43,
+    3,68,85,41,143,178,32,19,136,172,33,4,102,68,111,37,33,252,156,140,196,32,235,137,
+    189,33,2,225,68,137,35,32,51,138,215,33,253,118,134,210,34,4,0,68,130,209,42,125,
+    5,160,0,16,0,78,0,84,0,94,65,109,18,68,180,53,65,146,15,32,16,65,146,13,
+    33,252,66,68,212,51,33,3,130,65,185,4,32,20,65,185,21,33,2,199,68,242,48,33,
+    252,92,65,225,13,42,2,0,44,254,156,3,2,4,5,0,41,69,175,3,32,5,73,74,
+    8,36,4,55,55,51,23,71,240,3,90,161,9,34,22,23,1,68,86,14,37,3,2,31,
+    75,88,104,103,241,25,38,38,12,14,17,7,254,113,103,243,15,32,212,103,242,3,54,44,
+    82,118,75,76,106,76,54,48,49,33,154,167,12,44,62,50,47,60,80,59,44,69,103,242,
+    4,35,12,11,4,16,103,243,14,33,255,255,102,229,5,35,6,246,2,38,77,9,3,39,
+    0,7,0,197,1,107,0,0,146,23,32,199,140,23,32,220,136,23,34,200,1,118,138,23,
+    32,210,136,23,32,202,140,23,32,242,136,23,32,198,139,23,33,7,45,136,23,34,201,1,
+    115,130,7,38,2,255,232,0,0,6,218,95,209,4,34,24,0,0,71,161,3,32,19,134,
+    3,103,124,7,131,6,8,32,7,2,221,3,253,253,19,60,2,47,253,228,61,2,97,252,
+    252,49,253,212,179,11,37,26,148,1,218,1,209,94,12,29,14,101,218,8,44,1,136,254,
+    165,20,25,2,20,2,241,41,69,31,94,7,5,32,161,102,255,4,32,75,130,127,69,143,
+    11,33,46,2,103,4,30,84,204,5,32,7,69,182,12,33,2,131,69,183,10,36,36,139,
+    226,159,86,103,30,32,39,16,16,13,76,83,233,162,16,69,226,21,38,118,12,117,191,1,
+    0,153,103,56,27,37,13,83,97,112,6,55,70,9,11,33,255,255,102,187,5,65,173,4,
+    32,38,65,197,6,33,55,0,147,23,32,199,140,23,32,220,136,23,34,200,1,66,138,23,
+    32,242,136,23,32,198,133,23,37,255,204,0,0,1,188,132,71,32,42,130,23,35,6,0,
+    197,248,131,45,36,154,0,0,2,138,138,21,32,199,131,21,33,255,239,130,21,32,123,132,
+    91,133,21,33,200,3,131,21,32,242,130,21,32,120,132,89,133,21,32,198,94,215,4,36,
+    50,0,0,5,209,111,231,4,32,33,70,195,4,103,252,4,32,21,104,9,6,33,35,37,
+    104,5,6,32,21,104,9,5,35,50,197,2,23,99,197,4,100,188,4,36,253,233,197,4,
+    216,99,206,3,39,254,171,1,125,254,131,1,85,99,206,3,35,3,12,2,141,104,10,4,
+    104,22,4,34,2,154,50,104,18,3,39,254,16,114,254,3,76,143,208,133,223,33,5,56,
+    66,165,4,32,47,66,165,6,32,218,132,247,101,65,4,132,201,32,48,65,63,6,32,227,
+    148,23,32,199,140,23,32,220,136,23,34,200,1,238,138,23,32,210,136,23,32,202,140,23,
+    32,242,136,23,32,198,131,23,41,0,1,0,126,0,219,4,3,4,88,103,173,3,8,52,
+    9,2,7,1,1,39,1,1,55,1,1,3,249,254,168,1,98,95,254,158,254,155,95,1,
+    100,254,167,95,1,89,1,88,3,246,254,168,254,159,96,1,98,254,156,96,1,100,1,89,
+    96,254,166,1,88,70,77,3,44,92,255,147,5,225,5,218,0,33,0,45,0,56,101,255,
+    8,95,112,3,85,152,3,105,219,10,82,221,6,34,18,5,20,102,117,4,76,100,4,32,
+    52,102,117,3,102,18,10,42,108,188,79,100,22,58,29,78,191,112,123,101,53,4,51,115,
+    200,83,82,20,32,32,100,172,103,112,251,65,75,69,2,147,60,148,87,101,63,3,39,3,
+    248,65,60,253,113,116,156,102,38,10,42,49,48,136,29,26,1,4,98,1,32,179,101,65,
+    4,48,58,54,111,27,23,235,98,254,234,171,135,211,73,3,131,42,43,101,73,3,37,126,
+    201,72,252,132,70,101,75,3,33,255,255,100,13,5,65,93,4,32,54,65,117,6,33,157,
+    0,147,23,32,199,140,23,32,220,136,23,34,200,1,168,138,23,32,242,136,23,32,198,134,
+    23,98,217,4,132,71,32,58,134,71,34,57,0,0,102,175,10,32,16,84,187,4,81,132,
+    4,32,51,102,177,20,33,193,230,102,177,16,39,1,16,254,240,5,153,254,248,102,179,15,
+    42,1,0,186,255,240,4,118,5,174,0,72,71,209,8,69,230,3,32,4,81,171,21,32,
+    4,109,245,11,91,200,4,55,62,2,2,161,103,151,98,47,43,64,75,64,43,53,80,93,
+    80,53,57,100,135,79,97,158,81,154,6,8,52,55,75,53,44,70,49,26,56,84,98,84,
+    56,45,67,78,67,45,25,56,89,63,68,111,79,43,179,69,128,180,5,174,60,93,110,51,
+    60,86,66,50,48,51,32,39,52,45,47,70,102,78,78,122,85,45,89,197,9,63,64,37,
+    56,70,51,42,58,83,66,53,79,63,54,60,71,48,32,65,52,33,42,84,126,84,252,38,
+    3,224,104,170,122,66,66,163,4,38,240,3,122,5,169,2,38,123,203,3,37,0,7,0,
+    65,0,221,66,187,6,141,23,32,116,140,23,32,153,136,23,32,193,140,23,32,137,136,23,
+    32,195,140,23,32,123,136,23,32,104,140,23,32,222,136,23,34,194,0,222,127,157,4,130,
+    23,32,6,92,61,3,36,67,0,81,0,92,96,237,18,32,22,96,238,5,32,38,80,169,
+    27,83,209,3,32,1,80,166,4,131,51,33,53,1,130,27,97,21,4,8,39,4,142,82,
+    141,103,59,16,25,253,141,4,46,77,105,65,69,92,61,38,16,14,18,6,47,33,87,99,
+    106,52,117,191,55,27,87,106,119,59,69,114,83,99,43,16,40,181,113,120,146,33,54,173,
+    254,182,99,39,3,8,35,100,81,57,99,73,42,1,188,61,96,69,41,7,1,252,31,60,
+    87,4,5,64,122,175,112,41,29,91,135,90,44,29,36,29,9,8,61,97,66,3,52,113,
+    116,62,88,56,25,35,70,106,72,60,116,92,59,4,50,118,126,35,42,35,99,75,4,50,
+    102,91,88,103,253,225,5,35,56,72,42,87,80,36,74,110,74,1,239,104,191,3,34,65,
+    111,80,112,237,3,34,74,254,161,98,221,4,32,72,70,171,15,32,3,82,154,26,86,175,
+    8,70,168,11,33,1,144,70,168,10,36,37,83,141,102,58,98,232,6,32,47,99,15,20,
+    39,11,17,6,50,59,170,97,17,70,164,21,37,121,11,79,132,182,113,99,8,5,32,64,
+    99,39,15,38,9,8,65,72,74,8,58,70,159,14,98,183,4,66,67,4,32,70,66,91,
+    6,33,244,0,147,23,32,116,140,23,32,153,136,23,32,193,140,23,32,123,136,23,32,104,
+    133,23,37,255,249,0,0,1,134,132,71,32,192,70,93,4,33,65,211,131,45,36,151,0,
+    0,2,40,138,21,32,116,131,21,33,255,210,130,21,32,54,132,91,133,21,33,193,210,131,
+    21,32,225,130,21,32,41,132,89,133,21,33,104,211,130,16,41,0,76,255,243,4,5,5,
+    134,0,52,67,213,4,85,91,3,32,55,113,253,3,133,8,32,22,86,211,3,82,107,4,
+    90,76,5,84,51,11,130,36,32,7,116,215,3,32,55,109,251,9,8,129,1,161,4,5,
+    23,103,45,101,57,18,25,5,20,96,180,81,167,35,8,22,97,60,99,70,39,62,123,183,
+    120,98,170,125,72,62,116,165,104,100,177,65,20,117,94,184,95,71,115,81,46,3,16,52,
+    75,99,62,75,113,76,39,46,80,105,4,41,7,13,6,22,15,72,20,34,14,5,27,23,
+    15,14,62,16,60,48,122,57,13,11,21,16,67,49,124,155,185,110,143,228,160,86,66,123,
+    178,112,94,167,126,74,86,87,136,190,64,135,252,140,54,109,165,111,43,81,63,37,50,87,
+    119,68,81,127,86,45,130,231,98,93,6,67,157,3,32,79,67,157,5,102,96,3,130,23,
+    96,23,4,65,43,4,32,80,65,161,6,32,251,148,23,32,116,140,23,32,153,136,23,32,
+    193,140,23,32,137,136,23,32,195,140,23,32,123,136,23,32,104,131,23,41,0,3,0,100,
+    0,189,4,34,4,128,98,167,4,32,43,82,47,5,32,1,116,217,30,32,100,81,167,3,
+    35,1,98,19,33,89,245,11,116,223,3,141,15,36,2,227,135,1,166,74,240,14,33,253,
+    83,142,16,130,119,40,64,255,180,4,45,4,73,0,33,130,127,84,253,3,67,55,9,71,
+    65,4,87,81,10,71,64,4,35,1,20,23,1,68,100,4,100,91,5,38,39,1,22,3,
+    144,61,66,97,37,3,42,76,131,54,55,22,59,29,67,145,66,70,97,44,3,8,33,79,
+    135,56,68,20,32,32,90,252,201,59,1,180,73,111,76,116,79,40,1,55,75,115,79,40,
+    52,254,79,70,3,116,68,191,118,97,61,3,40,34,32,74,29,25,196,69,194,124,97,66,
+    3,59,38,35,91,27,23,253,177,160,97,2,78,56,54,100,145,254,36,53,100,143,90,151,
+    96,253,183,48,255,255,95,11,5,65,137,4,32,86,65,161,6,32,245,65,89,4,143,23,
+    32,116,140,23,32,153,136,23,32,193,140,23,32,123,136,23,32,104,134,23,93,211,4,132,
+    71,32,90,134,71,33,228,0,97,197,8,35,5,193,0,20,98,49,3,32,19,103,215,16,
+    97,195,15,35,178,63,164,105,97,192,7,33,95,132,97,192,15,36,7,24,253,161,74,103,
+    212,8,35,69,63,254,51,97,192,13,136,135,32,123,136,135,32,104,132,135,99,155,6,33,
+    3,245,99,155,10,100,174,5,131,27,36,0,4,145,2,100,106,115,6,34,35,34,47,24,
+    65,149,6,59,19,51,2,100,119,21,19,128,17,16,129,6,22,12,123,223,166,4,145,14,
+    126,17,17,126,5,9,1,8,131,217,38,106,4,107,1,251,5,222,81,5,5,84,141,17,
+    133,210,78,145,3,8,49,106,32,55,72,40,41,73,56,32,32,56,73,41,40,72,55,32,
+    100,54,47,45,55,55,45,47,54,5,35,42,68,50,27,27,50,68,42,41,68,48,27,27,
+    48,68,41,44,56,56,44,45,56,73,136,3,39,0,18,4,174,2,89,5,137,103,47,3,
+    93,33,13,93,32,8,53,1,161,36,39,1,108,25,47,65,40,35,61,54,48,23,72,2,
+    111,26,48,66,39,130,11,47,47,5,45,42,44,47,79,56,31,29,34,29,88,48,79,57,
+    131,7,130,249,36,88,255,241,5,86,125,171,4,34,39,0,59,120,3,17,32,37,158,15,
+    125,207,16,33,4,5,143,17,33,253,253,120,39,31,32,27,158,15,130,236,39,255,212,6,
+    10,1,196,6,246,106,219,12,51,37,157,32,32,20,211,139,21,24,17,254,217,6,246,13,
+    20,203,7,12,217,77,241,3,38,240,6,22,2,118,6,242,89,247,37,32,204,89,221,3,
+    33,21,39,89,199,3,33,39,21,89,237,3,53,1,170,18,30,40,22,23,40,30,17,17,
+    30,40,23,22,40,30,18,6,130,22,39,131,13,33,39,22,90,13,7,142,15,39,0,1,
+    0,162,6,10,2,146,130,159,97,204,3,80,94,4,59,55,62,3,51,2,146,254,218,17,
+    26,21,138,211,10,17,18,22,17,6,246,216,12,8,203,10,12,8,3,130,207,32,236,130,
+    47,36,120,6,220,0,16,89,29,7,108,8,3,68,30,5,8,41,51,2,120,135,12,28,
+    9,130,8,4,8,4,130,9,28,12,135,238,176,6,10,7,6,95,4,4,6,2,95,6,
+    7,210,0,2,0,118,5,205,1,241,7,45,66,103,33,49,118,31,51,68,38,39,69,53,
+    30,30,53,69,39,38,68,51,31,89,66,103,7,43,6,123,39,66,47,26,26,47,66,39,
+    38,64,65,150,3,37,64,38,43,57,57,43,66,103,6,38,26,6,8,2,86,6,210,95,
+    137,27,8,43,1,171,35,37,1,98,22,42,62,40,35,64,59,52,24,34,37,1,100,23,
+    43,63,39,35,64,58,52,6,127,41,37,43,72,53,29,26,31,26,43,36,43,73,52,30,
+    130,8,32,0,130,0,35,13,0,162,0,130,251,32,4,85,197,3,32,20,69,171,4,131,
+    11,36,1,0,34,1,20,134,11,36,2,0,14,1,54,134,11,36,3,0,94,1,68,134,
+    11,35,4,0,50,1,135,59,36,5,0,92,1,212,134,11,36,6,0,46,2,48,134,11,
+    36,8,0,48,2,94,134,11,36,9,0,30,2,142,134,11,32,11,130,23,32,172,134,11,
+    36,12,0,100,2,220,134,11,36,13,1,132,3,64,134,11,62,14,0,52,4,196,0,67,
+    0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,40,0,99,0,41,
+    130,7,36,50,0,48,0,49,130,3,32,45,134,9,32,51,130,19,32,98,130,43,32,32,
+    130,37,34,121,0,80,130,57,38,108,0,97,0,110,0,100,130,17,36,76,0,117,0,107,
+    130,13,34,115,0,122,130,13,32,68,130,5,34,105,0,101,130,25,131,7,32,99,130,17,
+    32,119,130,7,32,116,130,95,34,32,0,82,130,23,32,115,130,3,34,114,0,118,132,33,
+    34,32,0,70,130,73,32,110,132,121,32,78,130,65,32,109,130,21,34,32,0,34,130,81,
+    32,97,130,19,32,111,130,9,32,46,132,95,131,71,32,101,130,39,32,115,134,53,32,117,
+    132,121,131,71,131,143,32,104,132,53,34,83,0,73,130,41,34,32,0,79,130,211,131,43,
+    139,91,141,65,32,44,130,17,32,86,132,61,32,115,130,23,131,35,32,32,130,225,32,46,
+    132,3,32,65,130,21,32,101,130,125,34,32,0,77,130,25,131,143,131,65,32,115,132,95,
+    131,239,32,115,132,195,32,103,130,129,131,255,32,114,162,47,32,32,142,49,32,59,130,17,
+    32,115,130,13,32,98,132,139,131,157,34,111,0,102,132,163,133,243,135,139,34,48,0,53,
+    178,93,149,215,131,75,161,119,32,102,130,5,65,81,3,151,117,135,23,141,21,135,137,32,
+    45,142,137,66,39,47,157,29,66,157,3,38,116,0,112,0,58,0,47,130,1,32,119,132,
+    1,32,46,132,99,32,112,138,99,32,46,130,41,131,155,32,47,176,47,66,77,3,65,53,
+    3,32,103,130,23,65,65,5,32,47,140,145,32,95,144,145,32,47,67,63,104,32,40,176,
+    205,32,41,67,117,172,145,225,32,115,130,55,65,85,3,32,112,66,97,4,32,46,132,49,
+    32,108,130,7,66,159,3,32,103,130,31,32,79,130,101,32,76,130,229,32,46,180,55,24,
+    82,23,8,35,255,116,0,120,24,82,127,14,132,0,5,250,76,214,13,186,
+};
@@ -0,0 +1,12 @@
+// UIFontData.h: Compressed UI font compiled into the add-on
+//////////////////////////////////////////////////////////////////////
+
+#ifndef UI_FONT_DATA_H
+#define UI_FONT_DATA_H
+
+// Area Moments Sans (a Lato subset, SIL OFL 1.1) in the stb_compress format
+// read by ImFontAtlas::AddFontFromMemoryCompressedTTF
+extern const unsigned int g_uiFontCompressedSize;
+extern const unsigned char g_uiFontCompressedData[];
+
+#endif // UI_FONT_DATA_H
@@ -0,0 +1,305 @@
+// UIBench.cpp: Headless frame benchmark for the Area Moments panel
+//////////////////////////////////////////////////////////////////////
+//
+// Drives CAreaMomentsPanel through the ImGui core with a null renderer, so
+// UI cost can be measured without a window, D3D9 or Alibre. Reports time to
+// first frame, CPU time per NewFrame / panel / Render, draw list sizes and
+// ImGui allocations per frame for each result view, and the per-face cost of
+// selection ingestion with a stand-in selection source. While it runs, frame
+// timings and UI memory are published in the shared metrics block, which
+// tools/MetricsDump can read.
+//
+// Build (from the repository root, as one command):
+//   g++ -std=c++14 -O2 -Ibench -I. -o ui_bench bench/UIBench.cpp
+//       AreaMomentsPanel.cpp ResultComparisonTable.cpp SectionResultStore.cpp
+//       SectionPropertyGraph.cpp SectionHistory.cpp SectionLibrary.cpp
+//       SectionKern.cpp ColumnBuckling.cpp MemberCapacity.cpp
+//       SectionBoundary.cpp SectionOptimizer.cpp SectionOffset.cpp
+//       MeshSimplifier.cpp TessellationCache.cpp FacetCodec.cpp ResultCache.cpp
+//       SectionExpression.cpp SectionCustomColumns.cpp
+//       AreaMomentsCalculator.cpp MomentInvariants.cpp UIFont.cpp UIFontData.cpp
+//       UIAllocator.cpp EventLog.cpp SharedMetrics.cpp imgui/imgui.cpp
+//       imgui/imgui_draw.cpp imgui/imgui_tables.cpp imgui/imgui_widgets.cpp
+//       -lpthread
+//
+// Run:
+//   ./ui_bench [rows=1000] [frames=300]
+
+#include "stdafx.h"
+#include "AreaMomentsPanel.h"
+#include "UIFont.h"
+#include "UIAllocator.h"
+#include "EventLog.h"
+#include "SharedMetrics.h"
+
+#include "imgui/imgui.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+static const unsigned int BENCH_PROPERTY_NODES =
+    SECTION_NODE_BIT(SECTION_NODE_AREA_CENTROID) |
+    SECTION_NODE_BIT(SECTION_NODE_CENTROID_MOMENTS) |
+    SECTION_NODE_BIT(SECTION_NODE_PRINCIPAL) |
+    SECTION_NODE_BIT(SECTION_NODE_SECTION_MODULUS);
+
+static const int WARMUP_FRAMES = 10;
+static const int INGEST_FACES = 20000;
+
+static double NowMs()
+{
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Null renderer: accept every texture request the way a real backend would
+static void ProcessTextures(ImDrawData* drawData)
+{
+    if (drawData->Textures == nullptr)
+        return;
+
+    for (int i = 0; i < drawData->Textures->Size; i++)
+    {
+        ImTextureData* tex = (*drawData->Textures)[i];
+        if (tex->Status == ImTextureStatus_WantCreate || tex->Status == ImTextureStatus_WantUpdates)
+        {
+            tex->SetTexID((ImTextureID)(intptr_t)(i + 1));
+            tex->SetStatus(ImTextureStatus_OK);
+        }
+        else if (tex->Status == ImTextureStatus_WantDestroy)
+        {
+            tex->SetTexID(ImTextureID_Invalid);
+            tex->SetStatus(ImTextureStatus_Destroyed);
+        }
+    }
+}
+
+// Rectangles and hollow boxes of varying size, as the command would store them
+static void AddSyntheticResults(CAreaMomentsPanel& panel, int rows)
+{
+    std::lock_guard<std::mutex> lock(panel.GetMutex());
+    CSectionResultStore& results = panel.GetResults();
+    results.Reserve(rows, (size_t)rows * 16);
+
+    for (int i = 0; i < rows; i++)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "Face %d", i + 1);
+        int row = results.AddRow(name, nullptr);
+
+        double w = 1.0 + (i % 37) * 0.5;
+        double h = 1.0 + (i % 11) * 0.75;
+        std::vector<double> vertices;
+        std::vector<int> indices;
+        if (i % 2 == 0)
+        {
+            double v[] = { 0, 0, w, 0, w, h, 0, h };
+            int t[] = { 0, 1, 2, 0, 2, 3 };
+            vertices.assign(v, v + 8);
+            indices.assign(t, t + 6);
+        }
+        else
+        {
+            double s = 0.2;
+            double v[] = { 0, 0, w, 0, w, h, 0, h,
+                           s, s, w - s, s, w - s, h - s, s, h - s };
+            int t[] = { 0, 1, 5, 0, 5, 4, 1, 2, 6, 1, 6, 5,
+                        2, 3, 7, 2, 7, 6, 3, 0, 4, 3, 4, 7 };
+            vertices.assign(v, v + 16);
+            indices.assign(t, t + 24);
+        }
+
+        ImGuiAreaMomentsResult r;
+        std::unique_ptr<CSectionPropertyGraph> graph(new CSectionPropertyGraph());
+        graph->SetMesh(std::move(vertices), std::move(indices), 2 * (w + h), r);
+        graph->Require(BENCH_PROPERTY_NODES, r);
+        r.faceType = (i % 2 == 0) ? "Planar Face" : "Planar Face (hollow)";
+        results.SetResult(row, r, std::move(graph));
+
+        uint64_t key = CSectionHistory::MakeLineageKey(nullptr, 0, 0, 0, 1, 0, 0, (double)(i % 64));
+        results.SetLineageKey(row, key);
+        panel.GetHistory().Record(key, r, (uint32_t)i);
+    }
+}
+
+// Selection ingestion: the former per-face path (format a name, lock, append)
+// against the bulk path. Faces are stand-in pointers; COM lookups are not part
+// of the measurement.
+static void RunIngestion(int count)
+{
+    std::vector<int> selection(count);
+    std::vector<void*> faces(count);
+    for (int i = 0; i < count; i++)
+        faces[i] = &selection[i];
+
+    std::mutex mutex;
+    CSectionResultStore perFace;
+    double t0 = NowMs();
+    for (int i = 0; i < count; i++)
+    {
+        char name[128];
+        snprintf(name, sizeof(name), "%s %d", "Planar Face", i + 1);
+        std::lock_guard<std::mutex> lock(mutex);
+        perFace.AddRow(name, faces[i]);
+    }
+    double perFaceMs = NowMs() - t0;
+
+    CSectionResultStore bulk;
+    t0 = NowMs();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        bulk.AddFaceRows(&faces[0], count);
+    }
+    double bulkMs = NowMs() - t0;
+
+    // Deferred type naming, paid by the calculation instead
+    ImGuiAreaMomentsResult r;
+    r.faceType = "Planar Face";
+    t0 = NowMs();
+    for (int i = 0; i < count; i++)
+        bulk.SetResult(i, r, nullptr);
+    double namingMs = NowMs() - t0;
+
+    printf("ingestion of %d faces\n", count);
+    printf("  per face  %8.1f ns/face\n", 1e6 * perFaceMs / count);
+    printf("  bulk      %8.1f ns/face (+ %.1f ns/face naming at calculation)\n\n",
+           1e6 * bulkMs / count, 1e6 * namingMs / count);
+}
+
+// One frame of the host loop; returns the three phase times in ms
+static void RunFrame(CAreaMomentsPanel& panel, double& newFrameMs, double& panelMs, double& renderMs)
+{
+    CEventLogScope scope(STAGE_FRAME);
+    ImGui::GetIO().DeltaTime = 1.0f / 60.0f;
+    CUIAllocator::BeginFrame();
+
+    double t0 = NowMs();
+    ImGui::NewFrame();
+    double t1 = NowMs();
+    panel.Render();
+    double t2 = NowMs();
+    ImGui::Render();
+    ProcessTextures(ImGui::GetDrawData());
+    double t3 = NowMs();
+
+    newFrameMs = t1 - t0;
+    panelMs = t2 - t1;
+    renderMs = t3 - t2;
+
+    UIAllocatorStats stats = CUIAllocator::GetStats();
+    CSharedMetrics::SetGauge(GAUGE_UI_LIVE_BYTES, stats.liveBytes);
+    CSharedMetrics::SetGauge(GAUGE_UI_RESERVED_BYTES, stats.reservedBytes);
+}
+
+static void PrintStats(const char* label, std::vector<double>& samples)
+{
+    std::sort(samples.begin(), samples.end());
+    double sum = 0;
+    for (size_t i = 0; i < samples.size(); i++)
+        sum += samples[i];
+
+    size_t n = samples.size();
+    printf("  %-10s mean %8.3f  p50 %8.3f  p99 %8.3f  max %8.3f ms\n", label,
+           sum / n, samples[n / 2], samples[std::min(n - 1, n * 99 / 100)], samples[n - 1]);
+}
+
+static void RunScenario(CAreaMomentsPanel& panel, int view, const char* name, int frames)
+{
+    double a, b, c;
+    panel.SelectView(view);
+    for (int f = 0; f < WARMUP_FRAMES; f++)
+        RunFrame(panel, a, b, c);
+
+    std::vector<double> newFrame, ui, render;
+    uint64_t allocs = 0, heapAllocs = 0;
+    uint32_t maxAllocs = 0;
+    for (int f = 0; f < frames; f++)
+    {
+        RunFrame(panel, a, b, c);
+        newFrame.push_back(a);
+        ui.push_back(b);
+        render.push_back(c);
+
+        // Close the frame to read its allocation counters
+        CUIAllocator::BeginFrame();
+        UIAllocatorStats stats = CUIAllocator::GetStats();
+        allocs += stats.frameAllocs;
+        heapAllocs += stats.frameHeapAllocs;
+        maxAllocs = std::max(maxAllocs, stats.frameAllocs);
+    }
+
+    ImDrawData* drawData = ImGui::GetDrawData();
+    int commands = 0;
+    for (int i = 0; i < drawData->CmdListsCount; i++)
+        commands += drawData->CmdLists[i]->CmdBuffer.Size;
+
+    printf("%s view, %d frames\n", name, frames);
+    PrintStats("NewFrame", newFrame);
+    PrintStats("Panel", ui);
+    PrintStats("Render", render);
+    printf("  draw lists %d, commands %d, vertices %d, indices %d\n",
+           drawData->CmdListsCount, commands, drawData->TotalVtxCount, drawData->TotalIdxCount);
+
+    UIAllocatorStats stats = CUIAllocator::GetStats();
+    printf("  allocations per frame mean %.1f, max %u; heap allocations %llu\n",
+           (double)allocs / frames, maxAllocs, (unsigned long long)heapAllocs);
+    printf("  ImGui memory %.1f KB live, %.1f KB peak, %.1f KB reserved\n\n",
+           stats.liveBytes / 1024.0, stats.peakBytes / 1024.0, stats.reservedBytes / 1024.0);
+}
+
+int main(int argc, char* argv[])
+{
+    int rows = (argc > 1) ? atoi(argv[1]) : 1000;
+    int frames = (argc > 2) ? atoi(argv[2]) : 300;
+    if (rows < 0 || frames <= 0)
+    {
+        fprintf(stderr, "usage: ui_bench [rows] [frames]\n");
+        return 1;
+    }
+
+    // As the add-on does on load
+    CSharedMetrics::Open();
+
+    // Startup as in ImGuiAreaMomentsWindow::Create, up to the first frame
+    double start = NowMs();
+
+    IMGUI_CHECKVERSION();
+    CUIAllocator::Install();
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2(800, 1000);
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+
+    ImGui::StyleColorsDark();
+    ImGui::GetStyle().FontSizeBase = UI_FONT_SIZE;
+    CUIFont::AddToAtlas(io.Fonts, UI_FONT_SIZE);
+
+    CAreaMomentsPanel panel;
+    panel.SetAutoCalculate(false);
+
+    double a, b, c;
+    RunFrame(panel, a, b, c);
+    double firstFrame = NowMs() - start;
+
+    double populateStart = NowMs();
+    AddSyntheticResults(panel, rows);
+    double populate = NowMs() - populateStart;
+
+    printf("ImGui %s, %d rows\n", ImGui::GetVersion(), rows);
+    printf("time to first frame %.2f ms (embedded font)\n", firstFrame);
+    printf("populate %.2f ms\n", populate);
+    printf("metrics segment %s\n\n", CSharedMetrics::GetName()[0] ? CSharedMetrics::GetName() : "unavailable");
+
+    RunIngestion(INGEST_FACES);
+    RunScenario(panel, PANEL_VIEW_DETAILS, "Details", frames);
+    RunScenario(panel, PANEL_VIEW_COMPARE, "Compare", frames);
+
+    ImGui::DestroyContext();
+    CUIAllocator::ReleaseUnused();
+    CSharedMetrics::Close();
+    return 0;
+}
@@ -0,0 +1,18 @@
+// stdafx.h: Stand-in for the MFC precompiled header in non-Windows bench builds
+//////////////////////////////////////////////////////////////////////
+//
+// The portable sources include "stdafx.h" first like the rest of the add-on.
+// Bench builds put this directory on the include path so they pick up this
+// file instead of the MFC one in the project root.
+
+#ifndef BENCH_STDAFX_H
+#define BENCH_STDAFX_H
+
+#include <cstddef>
+#include <cstdint>
+
+#ifndef TRACE
+#define TRACE(...) ((void)0)
+#endif
+
+#endif // BENCH_STDAFX_H
@@ -0,0 +1,85 @@
+// SectionOptimizerTest.cpp: Regression checks for the section sizing optimizer
+//////////////////////////////////////////////////////////////////////
+//
+// Builds sides from boundaries that hold loops the optimizer skips and
+// checks that the sides of the loops after them still link up.
+//
+// Build (from the repository root):
+//   Linux:   g++ -std=c++14 -O1 -g -fsanitize=address -Ibench -I. -o section_optimizer_test
+//            tests/SectionOptimizerTest.cpp SectionOptimizer.cpp SectionBoundary.cpp
+//   Windows: cl /EHsc /Ibench /I. tests\SectionOptimizerTest.cpp SectionOptimizer.cpp SectionBoundary.cpp
+//
+// Run:
+//   ./section_optimizer_test       (exit code 0 when every check passes)
+
+#include "SectionOptimizer.h"
+
+#include <cmath>
+#include <cstdio>
+
+static int s_failures = 0;
+
+static void Check(bool condition, const char* what)
+{
+    if (!condition)
+    {
+        printf("FAILED: %s\n", what);
+        s_failures++;
+    }
+}
+
+static SectionBoundaryLoop MakeSquare(double x0, double y0, double size, bool hole)
+{
+    SectionBoundaryLoop loop;
+    double x1 = x0 + size, y1 = y0 + size;
+    if (hole)
+        loop.points = { x0, y0, x0, y1, x1, y1, x1, y0 };
+    else
+        loop.points = { x0, y0, x1, y0, x1, y1, x0, y1 };
+    loop.hole = hole;
+    return loop;
+}
+
+// A loop too short to have sides, then one that is only repeated points,
+// ahead of a square tube
+static void TestSkippedLoops()
+{
+    std::vector<SectionBoundaryLoop> loops;
+    SectionBoundaryLoop degenerate;
+    degenerate.points = { 5, 5, 6, 5, 5, 5 };
+    loops.push_back(degenerate);
+    SectionBoundaryLoop repeated;
+    repeated.points = { 7, 0, 7, 0, 8, 0, 8, 0, 7, 0 };
+    loops.push_back(repeated);
+    loops.push_back(MakeSquare(0, 0, 2, false));
+    loops.push_back(MakeSquare(0.5, 0.5, 1, true));
+
+    CSectionOptimizer optimizer;
+    optimizer.SetBoundary(loops);
+    Check(optimizer.GetSideCount() == 8, "a side per square edge");
+
+    int holeSides = 0;
+    for (int s = 0; s < optimizer.GetSideCount(); s++)
+        holeSides += optimizer.GetSide(s).hole ? 1 : 0;
+    Check(holeSides == 4, "hole flags follow the input loops");
+
+    double values[SIZING_QUANTITY_COUNT];
+    std::vector<double> offsets(optimizer.GetSideCount(), 0.0);
+    Check(optimizer.Evaluate(offsets, values) && fabs(values[SIZING_AREA] - 3.0) < 1e-12, "area at zero offset");
+
+    // Push the outer square out by 0.1 on every side: 2.2^2 - 1
+    for (int s = 0; s < optimizer.GetSideCount(); s++)
+        offsets[s] = optimizer.GetSide(s).hole ? 0.0 : 0.1;
+    Check(optimizer.Evaluate(offsets, values) && fabs(values[SIZING_AREA] - 3.84) < 1e-12, "area of offset sides");
+
+    std::vector<SectionBoundaryLoop> moved;
+    Check(optimizer.BuildLoops(offsets, moved) && moved.size() == 2, "a loop per square");
+}
+
+int main()
+{
+    TestSkippedLoops();
+    if (s_failures == 0)
+        printf("OK\n");
+    return s_failures == 0 ? 0 : 1;
+}
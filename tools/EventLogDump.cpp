@@ -0,0 +1,196 @@
+// EventLogDump.cpp: Decoder for Area Moments event log files
+//////////////////////////////////////////////////////////////////////
+//
+// Prints the records of an events.bin file written by CEventLog::Flush()
+// (by default %LOCALAPPDATA%\AreaMomentTool\events.bin), followed by a
+// per-stage timing summary and error and cache totals. Needs only the
+// standard library, so logs from the field can be read on any machine.
+//
+// Build (from the repository root):
+//   g++ -std=c++14 -O2 -I. -o eventlog_dump tools/EventLogDump.cpp
+//
+// Run:
+//   ./eventlog_dump events.bin [--summary]
+
+#include "EventLog.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <vector>
+
+static const int STAGE_COUNT = STAGE_FRAME + 1;
+
+static const char* StageName(uint32_t stage)
+{
+    switch (stage)
+    {
+    case STAGE_SELECTION:  return "selection";
+    case STAGE_CALCULATE:  return "calculate";
+    case STAGE_FACE:       return "face";
+    case STAGE_FACE_QUICK: return "face-quick";
+    case STAGE_FRAME:      return "frame";
+    default:               return "unknown";
+    }
+}
+
+static const char* CacheName(uint32_t cache)
+{
+    switch (cache)
+    {
+    case CACHE_TESSELLATION: return "tessellation";
+    case CACHE_RESULT:       return "result";
+    default:                 return "unknown";
+    }
+}
+
+static const char* SiteName(uint32_t site)
+{
+    switch (site)
+    {
+    case SITE_CALCULATE_FACE:       return "calculate-face";
+    case SITE_CALCULATE_FACE_QUICK: return "calculate-face-quick";
+    case SITE_SELECTION:            return "selection";
+    default:                        return "unknown";
+    }
+}
+
+static void PrintRecord(const EventLogRecord& record)
+{
+    printf("%12.3f ms  t%-2u  ", record.time / 1e6, record.thread);
+    switch (record.type)
+    {
+    case EVENT_STAGE:
+        printf("stage         %-12s %10.3f ms  items %llu\n", StageName(record.arg0),
+               record.arg1 / 1e6, (unsigned long long)record.arg2);
+        break;
+    case EVENT_TESSELLATION:
+        printf("tessellation  row %-8u triangles %llu  bytes %llu\n", record.arg0,
+               (unsigned long long)record.arg1, (unsigned long long)record.arg2);
+        break;
+    case EVENT_CACHE:
+        printf("cache         %-12s %s  key %016llx\n", CacheName(record.arg0),
+               record.arg1 ? "hit " : "miss", (unsigned long long)record.arg2);
+        break;
+    case EVENT_ERROR:
+        printf("error         %-20s code 0x%08llx\n", SiteName(record.arg0),
+               (unsigned long long)record.arg1);
+        break;
+    default:
+        printf("type %u  %u %llu %llu\n", record.type, record.arg0,
+               (unsigned long long)record.arg1, (unsigned long long)record.arg2);
+        break;
+    }
+}
+
+static void PrintSummary(const std::vector<EventLogRecord>& records)
+{
+    std::vector<uint64_t> durations[STAGE_COUNT];
+    uint64_t triangles = 0, tessellations = 0, errors = 0;
+    uint64_t hits[CACHE_RESULT + 1] = {}, lookups[CACHE_RESULT + 1] = {};
+
+    for (size_t i = 0; i < records.size(); i++)
+    {
+        const EventLogRecord& record = records[i];
+        if (record.type == EVENT_STAGE && record.arg0 < (uint32_t)STAGE_COUNT)
+        {
+            durations[record.arg0].push_back(record.arg1);
+        }
+        else if (record.type == EVENT_TESSELLATION)
+        {
+            tessellations++;
+            triangles += record.arg1;
+        }
+        else if (record.type == EVENT_CACHE && record.arg0 <= CACHE_RESULT)
+        {
+            lookups[record.arg0]++;
+            hits[record.arg0] += record.arg1 ? 1 : 0;
+        }
+        else if (record.type == EVENT_ERROR)
+        {
+            errors++;
+        }
+    }
+
+    printf("\n%-12s %8s %12s %12s %12s\n", "stage", "count", "mean ms", "p99 ms", "max ms");
+    for (int stage = STAGE_SELECTION; stage < STAGE_COUNT; stage++)
+    {
+        std::vector<uint64_t>& d = durations[stage];
+        if (d.empty())
+            continue;
+
+        std::sort(d.begin(), d.end());
+        double total = 0;
+        for (size_t i = 0; i < d.size(); i++)
+            total += (double)d[i];
+        size_t p99 = std::min(d.size() - 1, (size_t)(d.size() * 0.99));
+        printf("%-12s %8zu %12.3f %12.3f %12.3f\n", StageName(stage), d.size(),
+               total / d.size() / 1e6, d[p99] / 1e6, d.back() / 1e6);
+    }
+
+    if (tessellations > 0)
+        printf("\nTessellations: %llu, %.1f triangles on average\n",
+               (unsigned long long)tessellations, (double)triangles / tessellations);
+    for (int cache = CACHE_TESSELLATION; cache <= CACHE_RESULT; cache++)
+    {
+        if (lookups[cache] > 0)
+            printf("Cache %s: %llu lookups, %.1f%% hits\n", CacheName(cache),
+                   (unsigned long long)lookups[cache], 100.0 * hits[cache] / lookups[cache]);
+    }
+    printf("Errors: %llu\n", (unsigned long long)errors);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: %s events.bin [--summary]\n", argv[0]);
+        return 2;
+    }
+    bool summaryOnly = argc > 2 && strcmp(argv[2], "--summary") == 0;
+
+    FILE* file = fopen(argv[1], "rb");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "Cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    EventLogFileHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || header.magic != EVENT_LOG_MAGIC)
+    {
+        fprintf(stderr, "%s is not an event log\n", argv[1]);
+        fclose(file);
+        return 1;
+    }
+    if (header.version != EVENT_LOG_VERSION || header.recordSize != sizeof(EventLogRecord))
+    {
+        fprintf(stderr, "Unsupported event log version %u (record size %u)\n",
+                header.version, header.recordSize);
+        fclose(file);
+        return 1;
+    }
+
+    std::vector<EventLogRecord> records(header.recordCount);
+    size_t read = records.empty() ? 0 : fread(&records[0], sizeof(EventLogRecord), records.size(), file);
+    fclose(file);
+    if (read != records.size())
+    {
+        fprintf(stderr, "Truncated log: %zu of %u records\n", read, header.recordCount);
+        records.resize(read);
+    }
+
+    time_t started = (time_t)header.startTime;
+    char startText[64] = "";
+    strftime(startText, sizeof(startText), "%Y-%m-%d %H:%M:%S", localtime(&started));
+    printf("Event log started %s, %zu records\n", startText, records.size());
+
+    if (!summaryOnly)
+    {
+        for (size_t i = 0; i < records.size(); i++)
+            PrintRecord(records[i]);
+    }
+    PrintSummary(records);
+    return 0;
+}
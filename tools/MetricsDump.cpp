@@ -0,0 +1,124 @@
+// MetricsDump.cpp: Reader for the Area Moments shared metrics block
+//////////////////////////////////////////////////////////////////////
+//
+// Maps the segment published by CSharedMetrics read-only and prints its
+// counters: calculation counts, mean and p99 latency per stage, cache hit
+// rates, queue depth and memory. With an interval it keeps printing, for
+// monitoring agents that scrape text.
+//
+// Build (from the repository root):
+//   Linux:   g++ -std=c++14 -O2 -I. -o metrics_dump tools/MetricsDump.cpp
+//   Windows: cl /EHsc /I. tools\MetricsDump.cpp
+//
+// Run:
+//   ./metrics_dump [segment name] [interval ms]
+
+#include "SharedMetrics.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+static const char* s_stageNames[METRICS_STAGE_COUNT] =
+{
+    "", "selection", "calculate", "face", "face-quick", "frame"
+};
+
+static const char* s_cacheNames[METRICS_CACHE_COUNT] =
+{
+    "", "tessellation", "result"
+};
+
+static const SharedMetricsBlock* MapBlock(const char* name)
+{
+#ifdef _WIN32
+    HANDLE mapping = ::OpenFileMappingA(FILE_MAP_READ, FALSE, name);
+    if (mapping == nullptr)
+        return nullptr;
+    // The view keeps the mapping alive until the process exits
+    return (const SharedMetricsBlock*)::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, sizeof(SharedMetricsBlock));
+#else
+    int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0)
+        return nullptr;
+    void* view = mmap(nullptr, sizeof(SharedMetricsBlock), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    return (view == MAP_FAILED) ? nullptr : (const SharedMetricsBlock*)view;
+#endif
+}
+
+static uint64_t Load(const std::atomic<uint64_t>& value)
+{
+    return value.load(std::memory_order_relaxed);
+}
+
+static void PrintBlock(const SharedMetricsBlock& block)
+{
+    printf("process %u, sequence %llu, last update %.3f s after start\n", block.processId,
+           (unsigned long long)block.sequence.load(std::memory_order_acquire), Load(block.updateTime) / 1e9);
+
+    printf("%-12s %10s %12s %12s\n", "stage", "count", "mean ms", "p99 ms");
+    for (int stage = STAGE_SELECTION; stage < METRICS_STAGE_COUNT; stage++)
+    {
+        uint64_t count = Load(block.stageCount[stage]);
+        double mean = count ? Load(block.stageTotalNs[stage]) / 1e6 / count : 0.0;
+        printf("%-12s %10llu %12.3f %12.3f\n", s_stageNames[stage], (unsigned long long)count, mean,
+               CSharedMetrics::LatencyPercentileUs(block, stage, 0.99) / 1000.0);
+    }
+
+    uint64_t tessellations = Load(block.tessellations);
+    printf("tessellations %llu, triangles %llu\n", (unsigned long long)tessellations,
+           (unsigned long long)Load(block.triangles));
+    for (int cache = CACHE_TESSELLATION; cache < METRICS_CACHE_COUNT; cache++)
+    {
+        uint64_t lookups = Load(block.cacheLookups[cache]);
+        printf("cache %-12s %10llu lookups %6.1f%% hits\n", s_cacheNames[cache], (unsigned long long)lookups,
+               lookups ? 100.0 * Load(block.cacheHits[cache]) / lookups : 0.0);
+    }
+    printf("errors %llu\n", (unsigned long long)Load(block.errors));
+
+    printf("queue depth %llu\n", (unsigned long long)Load(block.gauges[GAUGE_QUEUE_DEPTH]));
+    printf("memory: results %.1f KB, history %.1f KB, UI %.1f KB live / %.1f KB reserved\n\n",
+           Load(block.gauges[GAUGE_RESULT_BYTES]) / 1024.0, Load(block.gauges[GAUGE_HISTORY_BYTES]) / 1024.0,
+           Load(block.gauges[GAUGE_UI_LIVE_BYTES]) / 1024.0, Load(block.gauges[GAUGE_UI_RESERVED_BYTES]) / 1024.0);
+    fflush(stdout);
+}
+
+int main(int argc, char** argv)
+{
+    const char* name = (argc > 1) ? argv[1] : SHARED_METRICS_NAME;
+    int intervalMs = (argc > 2) ? atoi(argv[2]) : 0;
+
+    const SharedMetricsBlock* block = MapBlock(name);
+    if (block == nullptr)
+    {
+        fprintf(stderr, "No metrics segment %s\n", name);
+        return 1;
+    }
+    // Newer versions only append fields, so they read the same
+    if (block->magic != SHARED_METRICS_MAGIC || block->version < SHARED_METRICS_VERSION ||
+        block->blockSize < sizeof(SharedMetricsBlock))
+    {
+        fprintf(stderr, "Unsupported metrics block (magic %08x, version %u, size %u)\n",
+                block->magic, block->version, block->blockSize);
+        return 1;
+    }
+
+    for (;;)
+    {
+        PrintBlock(*block);
+        if (intervalMs <= 0)
+            break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(intervalMs));
+    }
+    return 0;
+}
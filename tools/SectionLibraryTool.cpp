@@ -0,0 +1,229 @@
+// SectionLibraryTool.cpp: Command line access to the section library
+//////////////////////////////////////////////////////////////////////
+//
+// Lists the sections stored in library.bin and finds the ones closest in
+// shape to a stored section, using the same index as the window. The list
+// can carry computed columns, given as "name=expression" arguments or read
+// from a columns file of the window ("@columns.txt"); they can use A, Ix,
+// Iy and Iz, the fields the library keeps.
+//
+// Build (from the repository root):
+//   Linux:   g++ -std=c++14 -O2 -Ibench -I. -o section_library tools/SectionLibraryTool.cpp SectionLibrary.cpp
+//            SectionHistory.cpp SectionExpression.cpp
+//   Windows: cl /EHsc /Ibench /I. tools\SectionLibraryTool.cpp SectionLibrary.cpp SectionHistory.cpp
+//            SectionExpression.cpp
+//
+// Run:
+//   ./section_library <library.bin> list [name=expression | @columns.txt ...]
+//   ./section_library <library.bin> query <record | name> [count]
+//   ./section_library <library.bin> stats
+
+#include "SectionLibrary.h"
+#include "SectionExpression.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Record fields columns can read, named like the window's result columns
+static const SectionExpressionSymbol s_recordSymbols[] =
+{
+    { "A", 2 }, { "Ix", 4 }, { "Iy", 4 }, { "Iz", 4 }
+};
+static const int RECORD_SYMBOL_COUNT = (int)(sizeof(s_recordSymbols) / sizeof(s_recordSymbols[0]));
+
+struct ToolColumn
+{
+    std::string name;
+    std::string expression;
+    CSectionExpression program;
+    std::vector<double> values;
+};
+
+static void PrintRecord(int index, const SectionLibraryRecord& record)
+{
+    printf("%6d  %-32s %-16s A=%-12.6g Ix=%-12.6g Iy=%-12.6g J=%.6g\n", index, record.name,
+           record.faceType, record.area, record.Ix, record.Iy, record.J);
+}
+
+// A record number, or the first record whose name contains 'text'
+static int FindRecord(const CSectionLibrary& library, const char* text)
+{
+    char* end = nullptr;
+    long index = strtol(text, &end, 10);
+    if (end != text && *end == '\0')
+        return (index >= 0 && index < library.GetCount()) ? (int)index : -1;
+
+    for (int i = 0; i < library.GetCount(); i++)
+    {
+        if (strstr(library.GetRecord(i).name, text) != nullptr)
+            return i;
+    }
+    return -1;
+}
+
+// "name=expression" arguments and "@file" columns files, in order
+static bool ReadColumnDefinitions(int argc, char** argv, std::vector<ToolColumn>& columns)
+{
+    std::string name, expression;
+    for (int a = 0; a < argc; a++)
+    {
+        if (argv[a][0] != '@')
+        {
+            if (!CSectionExpression::ParseDefinition(argv[a], name, expression))
+            {
+                fprintf(stderr, "Not a column definition: %s\n", argv[a]);
+                return false;
+            }
+            columns.push_back(ToolColumn());
+            columns.back().name = name;
+            columns.back().expression = expression;
+            continue;
+        }
+
+        FILE* file = fopen(argv[a] + 1, "r");
+        if (file == nullptr)
+        {
+            fprintf(stderr, "Cannot read %s\n", argv[a] + 1);
+            return false;
+        }
+        char line[1024];
+        while (fgets(line, sizeof(line), file) != nullptr)
+        {
+            if (!CSectionExpression::ParseDefinition(line, name, expression))
+                continue;
+            columns.push_back(ToolColumn());
+            columns.back().name = name;
+            columns.back().expression = expression;
+        }
+        fclose(file);
+    }
+    return true;
+}
+
+// Compile the columns in order, each able to read the earlier ones, and
+// drop those that do not compile against the record fields
+static void CompileColumns(std::vector<ToolColumn>& columns)
+{
+    std::vector<ToolColumn> compiled;
+    compiled.reserve(columns.size());
+    std::vector<SectionExpressionSymbol> symbols(s_recordSymbols, s_recordSymbols + RECORD_SYMBOL_COUNT);
+    for (ToolColumn& column : columns)
+    {
+        std::string error;
+        bool taken = false;
+        for (const SectionExpressionSymbol& symbol : symbols)
+            taken = taken || column.name == symbol.name;
+        if (taken)
+            error = "name already used";
+        else
+            column.program.Compile(column.expression.c_str(), symbols.data(), (int)symbols.size(), error);
+
+        if (!error.empty())
+        {
+            fprintf(stderr, "Skipping column %s: %s\n", column.name.c_str(), error.c_str());
+            continue;
+        }
+        compiled.push_back(std::move(column));
+        SectionExpressionSymbol symbol = { compiled.back().name.c_str(), compiled.back().program.GetLengthPower() };
+        symbols.push_back(symbol);
+    }
+    columns.swap(compiled);
+}
+
+// Evaluate every column over the whole library, a column at a time
+static void EvaluateColumns(const CSectionLibrary& library, std::vector<ToolColumn>& columns)
+{
+    int count = library.GetCount();
+    std::vector<double> fields[RECORD_SYMBOL_COUNT];
+    for (std::vector<double>& field : fields)
+        field.resize(count);
+    for (int i = 0; i < count; i++)
+    {
+        const SectionLibraryRecord& record = library.GetRecord(i);
+        fields[0][i] = record.area;
+        fields[1][i] = record.Ix;
+        fields[2][i] = record.Iy;
+        fields[3][i] = record.J;
+    }
+
+    std::vector<const double*> inputs;
+    for (const std::vector<double>& field : fields)
+        inputs.push_back(field.data());
+    for (ToolColumn& column : columns)
+    {
+        column.values.resize(count);
+        column.program.Evaluate(inputs.data(), count, column.values.data());
+        inputs.push_back(column.values.data());
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "Usage: %s <library.bin> list [name=expression | @columns.txt ...] | "
+                "query <record | name> [count] | stats\n", argv[0]);
+        return 2;
+    }
+
+    CSectionLibrary library;
+    if (!library.Open(argv[1]))
+    {
+        fprintf(stderr, "Unsupported library file %s\n", argv[1]);
+        return 1;
+    }
+
+    const char* command = argv[2];
+    if (strcmp(command, "list") == 0)
+    {
+        std::vector<ToolColumn> columns;
+        if (!ReadColumnDefinitions(argc - 3, argv + 3, columns))
+            return 2;
+        CompileColumns(columns);
+        EvaluateColumns(library, columns);
+
+        for (int i = 0; i < library.GetCount(); i++)
+        {
+            PrintRecord(i, library.GetRecord(i));
+            for (const ToolColumn& column : columns)
+                printf("        %s=%.6g\n", column.name.c_str(), column.values[i]);
+        }
+    }
+    else if (strcmp(command, "query") == 0 && argc > 3)
+    {
+        int index = FindRecord(library, argv[3]);
+        if (index < 0)
+        {
+            fprintf(stderr, "No record %s\n", argv[3]);
+            return 1;
+        }
+        int count = (argc > 4) ? atoi(argv[4]) : 5;
+
+        std::vector<SectionLibraryMatch> matches;
+        library.Query(library.GetRecord(index).features, count + 1, matches);
+        int printed = 0;
+        for (const SectionLibraryMatch& match : matches)
+        {
+            if (match.record == index)
+                continue;
+            if (printed++ == count)
+                break;
+            printf("%8.4f ", match.distance);
+            PrintRecord(match.record, library.GetRecord(match.record));
+        }
+    }
+    else if (strcmp(command, "stats") == 0)
+    {
+        printf("%s: %d sections, %.1f KB in memory\n", argv[1], library.GetCount(),
+               library.GetMemoryBytes() / 1024.0);
+    }
+    else
+    {
+        fprintf(stderr, "Unknown command %s\n", command);
+        return 2;
+    }
+    return 0;
+}